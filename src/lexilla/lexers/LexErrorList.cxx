@@ -77,6 +77,21 @@ bool IsBashDiagnostic(std::string_view sv) {
 	return !rest.empty() && (rest.front() == ':');
 }
 
+// Output from tools run at the same time by SciTE starts with the job number like "[2] ".
+size_t JobPrefixLength(std::string_view sv) noexcept {
+	if (sv.empty() || (sv.front() != '[')) {
+		return 0;
+	}
+	size_t position = 1;
+	while ((position < sv.length()) && Is0To9(sv[position])) {
+		position++;
+	}
+	if ((position > 1) && (sv.substr(position, 2) == "] ")) {
+		return position + 2;
+	}
+	return 0;
+}
+
 
 int RecogniseErrorListLine(const char *lineBuffer, Sci_PositionU lengthLine, Sci_Position &startValue) {
 	if (lineBuffer[0] == '>') {
@@ -351,7 +366,11 @@ void ColouriseErrorListLine(
 	bool escapeSequences) {
 	Sci_Position startValue = -1;
 	const Sci_PositionU lengthLine = lineBuffer.length();
-	const int style = RecogniseErrorListLine(lineBuffer.c_str(), lengthLine, startValue);
+	const size_t prefixLength = JobPrefixLength(lineBuffer);
+	const int style = RecogniseErrorListLine(lineBuffer.c_str() + prefixLength, lengthLine - prefixLength, startValue);
+	if (startValue >= 0) {
+		startValue += prefixLength;
+	}
 	if (escapeSequences && strstr(lineBuffer.c_str(), CSI)) {
 		const Sci_Position startPos = endPos - lengthLine;
 		const char *linePortion = lineBuffer.c_str();
@@ -55,6 +55,7 @@
 #include "EditModel.h"
 #include "MarginView.h"
 #include "EditView.h"
+#include "WrapPending.h"
 #include "Editor.h"
 
 #include "AutoComplete.h"
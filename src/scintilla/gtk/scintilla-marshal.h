@@ -1,30 +1,30 @@
-/* This file is generated, all changes will be lost */
-#ifndef __SCINTILLA_MARSHAL_MARSHAL_H__
-#define __SCINTILLA_MARSHAL_MARSHAL_H__
-
-#include <glib-object.h>
-
-G_BEGIN_DECLS
-
-/* VOID:INT,OBJECT (scintilla-marshal.list:1) */
-extern
-void scintilla_marshal_VOID__INT_OBJECT (GClosure     *closure,
-                                         GValue       *return_value,
-                                         guint         n_param_values,
-                                         const GValue *param_values,
-                                         gpointer      invocation_hint,
-                                         gpointer      marshal_data);
-
-/* VOID:INT,BOXED (scintilla-marshal.list:2) */
-extern
-void scintilla_marshal_VOID__INT_BOXED (GClosure     *closure,
-                                        GValue       *return_value,
-                                        guint         n_param_values,
-                                        const GValue *param_values,
-                                        gpointer      invocation_hint,
-                                        gpointer      marshal_data);
-
-
-G_END_DECLS
-
-#endif /* __SCINTILLA_MARSHAL_MARSHAL_H__ */
+/* This file is generated, all changes will be lost */
+#ifndef __SCINTILLA_MARSHAL_MARSHAL_H__
+#define __SCINTILLA_MARSHAL_MARSHAL_H__
+
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+/* VOID:INT,OBJECT (scintilla-marshal.list:1) */
+extern
+void scintilla_marshal_VOID__INT_OBJECT (GClosure     *closure,
+                                         GValue       *return_value,
+                                         guint         n_param_values,
+                                         const GValue *param_values,
+                                         gpointer      invocation_hint,
+                                         gpointer      marshal_data);
+
+/* VOID:INT,BOXED (scintilla-marshal.list:2) */
+extern
+void scintilla_marshal_VOID__INT_BOXED (GClosure     *closure,
+                                        GValue       *return_value,
+                                        guint         n_param_values,
+                                        const GValue *param_values,
+                                        gpointer      invocation_hint,
+                                        gpointer      marshal_data);
+
+
+G_END_DECLS
+
+#endif /* __SCINTILLA_MARSHAL_MARSHAL_H__ */
@@ -1,1491 +1,1541 @@
-/* Scintilla source code edit control */
-/** @file Scintilla.h
- ** Interface to the edit control.
- **/
-/* Copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
- * The License.txt file describes the conditions under which this software may be distributed. */
-
-/* Most of this file is automatically generated from the Scintilla.iface interface definition
- * file which contains any comments about the definitions. HFacer.py does the generation. */
-
-#ifndef SCINTILLA_H
-#define SCINTILLA_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#if defined(_WIN32)
-/* Return false on failure: */
-int Scintilla_RegisterClasses(void *hInstance);
-int Scintilla_ReleaseResources(void);
-#endif
-
-#ifdef __cplusplus
-}
-#endif
-
-// Include header that defines basic numeric types.
-#include <stdint.h>
-
-// Define uptr_t, an unsigned integer type large enough to hold a pointer.
-typedef uintptr_t uptr_t;
-// Define sptr_t, a signed integer large enough to hold a pointer.
-typedef intptr_t sptr_t;
-
-#include "Sci_Position.h"
-
-typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam);
-typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam, int *pStatus);
-
-#ifndef SCI_DISABLE_AUTOGENERATED
-
-/* ++Autogenerated -- start of section automatically generated from Scintilla.iface */
-#define INVALID_POSITION -1
-#define SCI_START 2000
-#define SCI_OPTIONAL_START 3000
-#define SCI_LEXER_START 4000
-#define SCI_ADDTEXT 2001
-#define SCI_ADDSTYLEDTEXT 2002
-#define SCI_INSERTTEXT 2003
-#define SCI_CHANGEINSERTION 2672
-#define SCI_CLEARALL 2004
-#define SCI_DELETERANGE 2645
-#define SCI_CLEARDOCUMENTSTYLE 2005
-#define SCI_GETLENGTH 2006
-#define SCI_GETCHARAT 2007
-#define SCI_GETCURRENTPOS 2008
-#define SCI_GETANCHOR 2009
-#define SCI_GETSTYLEAT 2010
-#define SCI_GETSTYLEINDEXAT 2038
-#define SCI_REDO 2011
-#define SCI_SETUNDOCOLLECTION 2012
-#define SCI_SELECTALL 2013
-#define SCI_SETSAVEPOINT 2014
-#define SCI_GETSTYLEDTEXT 2015
-#define SCI_GETSTYLEDTEXTFULL 2778
-#define SCI_CANREDO 2016
-#define SCI_MARKERLINEFROMHANDLE 2017
-#define SCI_MARKERDELETEHANDLE 2018
-#define SCI_MARKERHANDLEFROMLINE 2732
-#define SCI_MARKERNUMBERFROMLINE 2733
-#define SCI_GETUNDOCOLLECTION 2019
-#define SCWS_INVISIBLE 0
-#define SCWS_VISIBLEALWAYS 1
-#define SCWS_VISIBLEAFTERINDENT 2
-#define SCWS_VISIBLEONLYININDENT 3
-#define SCI_GETVIEWWS 2020
-#define SCI_SETVIEWWS 2021
-#define SCTD_LONGARROW 0
-#define SCTD_STRIKEOUT 1
-#define SCI_GETTABDRAWMODE 2698
-#define SCI_SETTABDRAWMODE 2699
-#define SCI_POSITIONFROMPOINT 2022
-#define SCI_POSITIONFROMPOINTCLOSE 2023
-#define SCI_GOTOLINE 2024
-#define SCI_GOTOPOS 2025
-#define SCI_SETANCHOR 2026
-#define SCI_GETCURLINE 2027
-#define SCI_GETENDSTYLED 2028
-#define SC_EOL_CRLF 0
-#define SC_EOL_CR 1
-#define SC_EOL_LF 2
-#define SCI_CONVERTEOLS 2029
-#define SCI_GETEOLMODE 2030
-#define SCI_SETEOLMODE 2031
-#define SCI_STARTSTYLING 2032
-#define SCI_SETSTYLING 2033
-#define SCI_GETBUFFEREDDRAW 2034
-#define SCI_SETBUFFEREDDRAW 2035
-#define SCI_SETTABWIDTH 2036
-#define SCI_GETTABWIDTH 2121
-#define SCI_SETTABMINIMUMWIDTH 2724
-#define SCI_GETTABMINIMUMWIDTH 2725
-#define SCI_CLEARTABSTOPS 2675
-#define SCI_ADDTABSTOP 2676
-#define SCI_GETNEXTTABSTOP 2677
-#define SC_CP_UTF8 65001
-#define SCI_SETCODEPAGE 2037
-#define SCI_SETFONTLOCALE 2760
-#define SCI_GETFONTLOCALE 2761
-#define SC_IME_WINDOWED 0
-#define SC_IME_INLINE 1
-#define SCI_GETIMEINTERACTION 2678
-#define SCI_SETIMEINTERACTION 2679
-#define SC_ALPHA_TRANSPARENT 0
-#define SC_ALPHA_OPAQUE 255
-#define SC_ALPHA_NOALPHA 256
-#define SC_CURSORNORMAL -1
-#define SC_CURSORARROW 2
-#define SC_CURSORWAIT 4
-#define SC_CURSORREVERSEARROW 7
-#define MARKER_MAX 31
-#define SC_MARK_CIRCLE 0
-#define SC_MARK_ROUNDRECT 1
-#define SC_MARK_ARROW 2
-#define SC_MARK_SMALLRECT 3
-#define SC_MARK_SHORTARROW 4
-#define SC_MARK_EMPTY 5
-#define SC_MARK_ARROWDOWN 6
-#define SC_MARK_MINUS 7
-#define SC_MARK_PLUS 8
-#define SC_MARK_VLINE 9
-#define SC_MARK_LCORNER 10
-#define SC_MARK_TCORNER 11
-#define SC_MARK_BOXPLUS 12
-#define SC_MARK_BOXPLUSCONNECTED 13
-#define SC_MARK_BOXMINUS 14
-#define SC_MARK_BOXMINUSCONNECTED 15
-#define SC_MARK_LCORNERCURVE 16
-#define SC_MARK_TCORNERCURVE 17
-#define SC_MARK_CIRCLEPLUS 18
-#define SC_MARK_CIRCLEPLUSCONNECTED 19
-#define SC_MARK_CIRCLEMINUS 20
-#define SC_MARK_CIRCLEMINUSCONNECTED 21
-#define SC_MARK_BACKGROUND 22
-#define SC_MARK_DOTDOTDOT 23
-#define SC_MARK_ARROWS 24
-#define SC_MARK_PIXMAP 25
-#define SC_MARK_FULLRECT 26
-#define SC_MARK_LEFTRECT 27
-#define SC_MARK_AVAILABLE 28
-#define SC_MARK_UNDERLINE 29
-#define SC_MARK_RGBAIMAGE 30
-#define SC_MARK_BOOKMARK 31
-#define SC_MARK_VERTICALBOOKMARK 32
-#define SC_MARK_BAR 33
-#define SC_MARK_CHARACTER 10000
-#define SC_MARKNUM_HISTORY_REVERTED_TO_ORIGIN 21
-#define SC_MARKNUM_HISTORY_SAVED 22
-#define SC_MARKNUM_HISTORY_MODIFIED 23
-#define SC_MARKNUM_HISTORY_REVERTED_TO_MODIFIED 24
-#define SC_MARKNUM_FOLDEREND 25
-#define SC_MARKNUM_FOLDEROPENMID 26
-#define SC_MARKNUM_FOLDERMIDTAIL 27
-#define SC_MARKNUM_FOLDERTAIL 28
-#define SC_MARKNUM_FOLDERSUB 29
-#define SC_MARKNUM_FOLDER 30
-#define SC_MARKNUM_FOLDEROPEN 31
-#define SC_MASK_HISTORY 0x01E00000
-#define SC_MASK_FOLDERS 0xFE000000
-#define SCI_MARKERDEFINE 2040
-#define SCI_MARKERSETFORE 2041
-#define SCI_MARKERSETBACK 2042
-#define SCI_MARKERSETBACKSELECTED 2292
-#define SCI_MARKERSETFORETRANSLUCENT 2294
-#define SCI_MARKERSETBACKTRANSLUCENT 2295
-#define SCI_MARKERSETBACKSELECTEDTRANSLUCENT 2296
-#define SCI_MARKERSETSTROKEWIDTH 2297
-#define SCI_MARKERENABLEHIGHLIGHT 2293
-#define SCI_MARKERADD 2043
-#define SCI_MARKERDELETE 2044
-#define SCI_MARKERDELETEALL 2045
-#define SCI_MARKERGET 2046
-#define SCI_MARKERNEXT 2047
-#define SCI_MARKERPREVIOUS 2048
-#define SCI_MARKERDEFINEPIXMAP 2049
-#define SCI_MARKERADDSET 2466
-#define SCI_MARKERSETALPHA 2476
-#define SCI_MARKERGETLAYER 2734
-#define SCI_MARKERSETLAYER 2735
-#define SC_MAX_MARGIN 4
-#define SC_MARGIN_SYMBOL 0
-#define SC_MARGIN_NUMBER 1
-#define SC_MARGIN_BACK 2
-#define SC_MARGIN_FORE 3
-#define SC_MARGIN_TEXT 4
-#define SC_MARGIN_RTEXT 5
-#define SC_MARGIN_COLOUR 6
-#define SCI_SETMARGINTYPEN 2240
-#define SCI_GETMARGINTYPEN 2241
-#define SCI_SETMARGINWIDTHN 2242
-#define SCI_GETMARGINWIDTHN 2243
-#define SCI_SETMARGINMASKN 2244
-#define SCI_GETMARGINMASKN 2245
-#define SCI_SETMARGINSENSITIVEN 2246
-#define SCI_GETMARGINSENSITIVEN 2247
-#define SCI_SETMARGINCURSORN 2248
-#define SCI_GETMARGINCURSORN 2249
-#define SCI_SETMARGINBACKN 2250
-#define SCI_GETMARGINBACKN 2251
-#define SCI_SETMARGINS 2252
-#define SCI_GETMARGINS 2253
-#define STYLE_DEFAULT 32
-#define STYLE_LINENUMBER 33
-#define STYLE_BRACELIGHT 34
-#define STYLE_BRACEBAD 35
-#define STYLE_CONTROLCHAR 36
-#define STYLE_INDENTGUIDE 37
-#define STYLE_CALLTIP 38
-#define STYLE_FOLDDISPLAYTEXT 39
-#define STYLE_LASTPREDEFINED 39
-#define STYLE_MAX 255
-#define SC_CHARSET_ANSI 0
-#define SC_CHARSET_DEFAULT 1
-#define SC_CHARSET_BALTIC 186
-#define SC_CHARSET_CHINESEBIG5 136
-#define SC_CHARSET_EASTEUROPE 238
-#define SC_CHARSET_GB2312 134
-#define SC_CHARSET_GREEK 161
-#define SC_CHARSET_HANGUL 129
-#define SC_CHARSET_MAC 77
-#define SC_CHARSET_OEM 255
-#define SC_CHARSET_RUSSIAN 204
-#define SC_CHARSET_OEM866 866
-#define SC_CHARSET_CYRILLIC 1251
-#define SC_CHARSET_SHIFTJIS 128
-#define SC_CHARSET_SYMBOL 2
-#define SC_CHARSET_TURKISH 162
-#define SC_CHARSET_JOHAB 130
-#define SC_CHARSET_HEBREW 177
-#define SC_CHARSET_ARABIC 178
-#define SC_CHARSET_VIETNAMESE 163
-#define SC_CHARSET_THAI 222
-#define SC_CHARSET_8859_15 1000
-#define SCI_STYLECLEARALL 2050
-#define SCI_STYLESETFORE 2051
-#define SCI_STYLESETBACK 2052
-#define SCI_STYLESETBOLD 2053
-#define SCI_STYLESETITALIC 2054
-#define SCI_STYLESETSIZE 2055
-#define SCI_STYLESETFONT 2056
-#define SCI_STYLESETEOLFILLED 2057
-#define SCI_STYLERESETDEFAULT 2058
-#define SCI_STYLESETUNDERLINE 2059
-#define SC_CASE_MIXED 0
-#define SC_CASE_UPPER 1
-#define SC_CASE_LOWER 2
-#define SC_CASE_CAMEL 3
-#define SCI_STYLEGETFORE 2481
-#define SCI_STYLEGETBACK 2482
-#define SCI_STYLEGETBOLD 2483
-#define SCI_STYLEGETITALIC 2484
-#define SCI_STYLEGETSIZE 2485
-#define SCI_STYLEGETFONT 2486
-#define SCI_STYLEGETEOLFILLED 2487
-#define SCI_STYLEGETUNDERLINE 2488
-#define SCI_STYLEGETCASE 2489
-#define SCI_STYLEGETCHARACTERSET 2490
-#define SCI_STYLEGETVISIBLE 2491
-#define SCI_STYLEGETCHANGEABLE 2492
-#define SCI_STYLEGETHOTSPOT 2493
-#define SCI_STYLESETCASE 2060
-#define SC_FONT_SIZE_MULTIPLIER 100
-#define SCI_STYLESETSIZEFRACTIONAL 2061
-#define SCI_STYLEGETSIZEFRACTIONAL 2062
-#define SC_WEIGHT_NORMAL 400
-#define SC_WEIGHT_SEMIBOLD 600
-#define SC_WEIGHT_BOLD 700
-#define SCI_STYLESETWEIGHT 2063
-#define SCI_STYLEGETWEIGHT 2064
-#define SCI_STYLESETCHARACTERSET 2066
-#define SCI_STYLESETHOTSPOT 2409
-#define SCI_STYLESETCHECKMONOSPACED 2254
-#define SCI_STYLEGETCHECKMONOSPACED 2255
-#define SC_STRETCH_ULTRA_CONDENSED 1
-#define SC_STRETCH_EXTRA_CONDENSED 2
-#define SC_STRETCH_CONDENSED 3
-#define SC_STRETCH_SEMI_CONDENSED 4
-#define SC_STRETCH_NORMAL 5
-#define SC_STRETCH_SEMI_EXPANDED 6
-#define SC_STRETCH_EXPANDED 7
-#define SC_STRETCH_EXTRA_EXPANDED 8
-#define SC_STRETCH_ULTRA_EXPANDED 9
-#define SCI_STYLESETSTRETCH 2258
-#define SCI_STYLEGETSTRETCH 2259
-#define SCI_STYLESETINVISIBLEREPRESENTATION 2256
-#define SCI_STYLEGETINVISIBLEREPRESENTATION 2257
-#define SC_ELEMENT_LIST 0
-#define SC_ELEMENT_LIST_BACK 1
-#define SC_ELEMENT_LIST_SELECTED 2
-#define SC_ELEMENT_LIST_SELECTED_BACK 3
-#define SC_ELEMENT_SELECTION_TEXT 10
-#define SC_ELEMENT_SELECTION_BACK 11
-#define SC_ELEMENT_SELECTION_ADDITIONAL_TEXT 12
-#define SC_ELEMENT_SELECTION_ADDITIONAL_BACK 13
-#define SC_ELEMENT_SELECTION_SECONDARY_TEXT 14
-#define SC_ELEMENT_SELECTION_SECONDARY_BACK 15
-#define SC_ELEMENT_SELECTION_INACTIVE_TEXT 16
-#define SC_ELEMENT_SELECTION_INACTIVE_BACK 17
-#define SC_ELEMENT_SELECTION_INACTIVE_ADDITIONAL_TEXT 18
-#define SC_ELEMENT_SELECTION_INACTIVE_ADDITIONAL_BACK 19
-#define SC_ELEMENT_CARET 40
-#define SC_ELEMENT_CARET_ADDITIONAL 41
-#define SC_ELEMENT_CARET_LINE_BACK 50
-#define SC_ELEMENT_WHITE_SPACE 60
-#define SC_ELEMENT_WHITE_SPACE_BACK 61
-#define SC_ELEMENT_HOT_SPOT_ACTIVE 70
-#define SC_ELEMENT_HOT_SPOT_ACTIVE_BACK 71
-#define SC_ELEMENT_FOLD_LINE 80
-#define SC_ELEMENT_HIDDEN_LINE 81
-#define SCI_SETELEMENTCOLOUR 2753
-#define SCI_GETELEMENTCOLOUR 2754
-#define SCI_RESETELEMENTCOLOUR 2755
-#define SCI_GETELEMENTISSET 2756
-#define SCI_GETELEMENTALLOWSTRANSLUCENT 2757
-#define SCI_GETELEMENTBASECOLOUR 2758
-#define SCI_SETSELFORE 2067
-#define SCI_SETSELBACK 2068
-#define SCI_GETSELALPHA 2477
-#define SCI_SETSELALPHA 2478
-#define SCI_GETSELEOLFILLED 2479
-#define SCI_SETSELEOLFILLED 2480
-#define SC_LAYER_BASE 0
-#define SC_LAYER_UNDER_TEXT 1
-#define SC_LAYER_OVER_TEXT 2
-#define SCI_GETSELECTIONLAYER 2762
-#define SCI_SETSELECTIONLAYER 2763
-#define SCI_GETCARETLINELAYER 2764
-#define SCI_SETCARETLINELAYER 2765
-#define SCI_GETCARETLINEHIGHLIGHTSUBLINE 2773
-#define SCI_SETCARETLINEHIGHLIGHTSUBLINE 2774
-#define SCI_SETCARETFORE 2069
-#define SCI_ASSIGNCMDKEY 2070
-#define SCI_CLEARCMDKEY 2071
-#define SCI_CLEARALLCMDKEYS 2072
-#define SCI_SETSTYLINGEX 2073
-#define SCI_STYLESETVISIBLE 2074
-#define SCI_GETCARETPERIOD 2075
-#define SCI_SETCARETPERIOD 2076
-#define SCI_SETWORDCHARS 2077
-#define SCI_GETWORDCHARS 2646
-#define SCI_SETCHARACTERCATEGORYOPTIMIZATION 2720
-#define SCI_GETCHARACTERCATEGORYOPTIMIZATION 2721
-#define SCI_BEGINUNDOACTION 2078
-#define SCI_ENDUNDOACTION 2079
-#define SCI_GETUNDOSEQUENCE 2799
-#define SCI_GETUNDOACTIONS 2790
-#define SCI_SETUNDOSAVEPOINT 2791
-#define SCI_GETUNDOSAVEPOINT 2792
-#define SCI_SETUNDODETACH 2793
-#define SCI_GETUNDODETACH 2794
-#define SCI_SETUNDOTENTATIVE 2795
-#define SCI_GETUNDOTENTATIVE 2796
-#define SCI_SETUNDOCURRENT 2797
-#define SCI_GETUNDOCURRENT 2798
-#define SCI_PUSHUNDOACTIONTYPE 2800
-#define SCI_CHANGELASTUNDOACTIONTEXT 2801
-#define SCI_GETUNDOACTIONTYPE 2802
-#define SCI_GETUNDOACTIONPOSITION 2803
-#define SCI_GETUNDOACTIONTEXT 2804
-#define INDIC_PLAIN 0
-#define INDIC_SQUIGGLE 1
-#define INDIC_TT 2
-#define INDIC_DIAGONAL 3
-#define INDIC_STRIKE 4
-#define INDIC_HIDDEN 5
-#define INDIC_BOX 6
-#define INDIC_ROUNDBOX 7
-#define INDIC_STRAIGHTBOX 8
-#define INDIC_DASH 9
-#define INDIC_DOTS 10
-#define INDIC_SQUIGGLELOW 11
-#define INDIC_DOTBOX 12
-#define INDIC_SQUIGGLEPIXMAP 13
-#define INDIC_COMPOSITIONTHICK 14
-#define INDIC_COMPOSITIONTHIN 15
-#define INDIC_FULLBOX 16
-#define INDIC_TEXTFORE 17
-#define INDIC_POINT 18
-#define INDIC_POINTCHARACTER 19
-#define INDIC_GRADIENT 20
-#define INDIC_GRADIENTCENTRE 21
-#define INDIC_POINT_TOP 22
-#define INDIC_CONTAINER 8
-#define INDIC_IME 32
-#define INDIC_IME_MAX 35
-#define INDIC_MAX 35
-#define INDICATOR_CONTAINER 8
-#define INDICATOR_IME 32
-#define INDICATOR_IME_MAX 35
-#define INDICATOR_HISTORY_REVERTED_TO_ORIGIN_INSERTION 36
-#define INDICATOR_HISTORY_REVERTED_TO_ORIGIN_DELETION 37
-#define INDICATOR_HISTORY_SAVED_INSERTION 38
-#define INDICATOR_HISTORY_SAVED_DELETION 39
-#define INDICATOR_HISTORY_MODIFIED_INSERTION 40
-#define INDICATOR_HISTORY_MODIFIED_DELETION 41
-#define INDICATOR_HISTORY_REVERTED_TO_MODIFIED_INSERTION 42
-#define INDICATOR_HISTORY_REVERTED_TO_MODIFIED_DELETION 43
-#define INDICATOR_MAX 43
-#define SCI_INDICSETSTYLE 2080
-#define SCI_INDICGETSTYLE 2081
-#define SCI_INDICSETFORE 2082
-#define SCI_INDICGETFORE 2083
-#define SCI_INDICSETUNDER 2510
-#define SCI_INDICGETUNDER 2511
-#define SCI_INDICSETHOVERSTYLE 2680
-#define SCI_INDICGETHOVERSTYLE 2681
-#define SCI_INDICSETHOVERFORE 2682
-#define SCI_INDICGETHOVERFORE 2683
-#define SC_INDICVALUEBIT 0x1000000
-#define SC_INDICVALUEMASK 0xFFFFFF
-#define SC_INDICFLAG_NONE 0
-#define SC_INDICFLAG_VALUEFORE 1
-#define SCI_INDICSETFLAGS 2684
-#define SCI_INDICGETFLAGS 2685
-#define SCI_INDICSETSTROKEWIDTH 2751
-#define SCI_INDICGETSTROKEWIDTH 2752
-#define SCI_SETWHITESPACEFORE 2084
-#define SCI_SETWHITESPACEBACK 2085
-#define SCI_SETWHITESPACESIZE 2086
-#define SCI_GETWHITESPACESIZE 2087
-#define SCI_SETLINESTATE 2092
-#define SCI_GETLINESTATE 2093
-#define SCI_GETMAXLINESTATE 2094
-#define SCI_GETCARETLINEVISIBLE 2095
-#define SCI_SETCARETLINEVISIBLE 2096
-#define SCI_GETCARETLINEBACK 2097
-#define SCI_SETCARETLINEBACK 2098
-#define SCI_GETCARETLINEFRAME 2704
-#define SCI_SETCARETLINEFRAME 2705
-#define SCI_STYLESETCHANGEABLE 2099
-#define SCI_AUTOCSHOW 2100
-#define SCI_AUTOCCANCEL 2101
-#define SCI_AUTOCACTIVE 2102
-#define SCI_AUTOCPOSSTART 2103
-#define SCI_AUTOCCOMPLETE 2104
-#define SCI_AUTOCSTOPS 2105
-#define SCI_AUTOCSETSEPARATOR 2106
-#define SCI_AUTOCGETSEPARATOR 2107
-#define SCI_AUTOCSELECT 2108
-#define SCI_AUTOCSETCANCELATSTART 2110
-#define SCI_AUTOCGETCANCELATSTART 2111
-#define SCI_AUTOCSETFILLUPS 2112
-#define SCI_AUTOCSETCHOOSESINGLE 2113
-#define SCI_AUTOCGETCHOOSESINGLE 2114
-#define SCI_AUTOCSETIGNORECASE 2115
-#define SCI_AUTOCGETIGNORECASE 2116
-#define SCI_USERLISTSHOW 2117
-#define SCI_AUTOCSETAUTOHIDE 2118
-#define SCI_AUTOCGETAUTOHIDE 2119
-#define SC_AUTOCOMPLETE_NORMAL 0
-#define SC_AUTOCOMPLETE_FIXED_SIZE 1
-#define SC_AUTOCOMPLETE_SELECT_FIRST_ITEM 2
-#define SCI_AUTOCSETOPTIONS 2638
-#define SCI_AUTOCGETOPTIONS 2639
-#define SCI_AUTOCSETDROPRESTOFWORD 2270
-#define SCI_AUTOCGETDROPRESTOFWORD 2271
-#define SCI_REGISTERIMAGE 2405
-#define SCI_CLEARREGISTEREDIMAGES 2408
-#define SCI_AUTOCGETTYPESEPARATOR 2285
-#define SCI_AUTOCSETTYPESEPARATOR 2286
-#define SCI_AUTOCSETMAXWIDTH 2208
-#define SCI_AUTOCGETMAXWIDTH 2209
-#define SCI_AUTOCSETMAXHEIGHT 2210
-#define SCI_AUTOCGETMAXHEIGHT 2211
-#define SCI_AUTOCSETSTYLE 2109
-#define SCI_AUTOCGETSTYLE 2120
-#define SCI_AUTOCSETIMAGESCALE 2815
-#define SCI_AUTOCGETIMAGESCALE 2816
-#define SCI_SETINDENT 2122
-#define SCI_GETINDENT 2123
-#define SCI_SETUSETABS 2124
-#define SCI_GETUSETABS 2125
-#define SCI_SETLINEINDENTATION 2126
-#define SCI_GETLINEINDENTATION 2127
-#define SCI_GETLINEINDENTPOSITION 2128
-#define SCI_GETCOLUMN 2129
-#define SCI_COUNTCHARACTERS 2633
-#define SCI_COUNTCODEUNITS 2715
-#define SCI_SETHSCROLLBAR 2130
-#define SCI_GETHSCROLLBAR 2131
-#define SC_IV_NONE 0
-#define SC_IV_REAL 1
-#define SC_IV_LOOKFORWARD 2
-#define SC_IV_LOOKBOTH 3
-#define SCI_SETINDENTATIONGUIDES 2132
-#define SCI_GETINDENTATIONGUIDES 2133
-#define SCI_SETHIGHLIGHTGUIDE 2134
-#define SCI_GETHIGHLIGHTGUIDE 2135
-#define SCI_GETLINEENDPOSITION 2136
-#define SCI_GETCODEPAGE 2137
-#define SCI_GETCARETFORE 2138
-#define SCI_GETREADONLY 2140
-#define SCI_SETCURRENTPOS 2141
-#define SCI_SETSELECTIONSTART 2142
-#define SCI_GETSELECTIONSTART 2143
-#define SCI_SETSELECTIONEND 2144
-#define SCI_GETSELECTIONEND 2145
-#define SCI_SETEMPTYSELECTION 2556
-#define SCI_SETPRINTMAGNIFICATION 2146
-#define SCI_GETPRINTMAGNIFICATION 2147
-#define SC_PRINT_NORMAL 0
-#define SC_PRINT_INVERTLIGHT 1
-#define SC_PRINT_BLACKONWHITE 2
-#define SC_PRINT_COLOURONWHITE 3
-#define SC_PRINT_COLOURONWHITEDEFAULTBG 4
-#define SC_PRINT_SCREENCOLOURS 5
-#define SCI_SETPRINTCOLOURMODE 2148
-#define SCI_GETPRINTCOLOURMODE 2149
-#define SCFIND_NONE 0x0
-#define SCFIND_WHOLEWORD 0x2
-#define SCFIND_MATCHCASE 0x4
-#define SCFIND_WORDSTART 0x00100000
-#define SCFIND_REGEXP 0x00200000
-#define SCFIND_POSIX 0x00400000
-#define SCFIND_CXX11REGEX 0x00800000
-#define SCI_FINDTEXT 2150
-#define SCI_FINDTEXTFULL 2196
-#define SCI_FORMATRANGE 2151
-#define SCI_FORMATRANGEFULL 2777
-#define SC_CHANGE_HISTORY_DISABLED 0
-#define SC_CHANGE_HISTORY_ENABLED 1
-#define SC_CHANGE_HISTORY_MARKERS 2
-#define SC_CHANGE_HISTORY_INDICATORS 4
-#define SCI_SETCHANGEHISTORY 2780
-#define SCI_GETCHANGEHISTORY 2781
-#define SC_UNDO_SELECTION_HISTORY_DISABLED 0
-#define SC_UNDO_SELECTION_HISTORY_ENABLED 1
-#define SC_UNDO_SELECTION_HISTORY_SCROLL 2
-#define SCI_SETUNDOSELECTIONHISTORY 2782
-#define SCI_GETUNDOSELECTIONHISTORY 2783
-#define SCI_SETSELECTIONSERIALIZED 2784
-#define SCI_GETSELECTIONSERIALIZED 2785
-#define SCI_GETFIRSTVISIBLELINE 2152
-#define SCI_GETLINE 2153
-#define SCI_GETLINECOUNT 2154
-#define SCI_ALLOCATELINES 2089
-#define SCI_SETMARGINLEFT 2155
-#define SCI_GETMARGINLEFT 2156
-#define SCI_SETMARGINRIGHT 2157
-#define SCI_GETMARGINRIGHT 2158
-#define SCI_GETMODIFY 2159
-#define SCI_SETSEL 2160
-#define SCI_GETSELTEXT 2161
-#define SCI_GETTEXTRANGE 2162
-#define SCI_GETTEXTRANGEFULL 2039
-#define SCI_HIDESELECTION 2163
-#define SCI_GETSELECTIONHIDDEN 2088
-#define SCI_POINTXFROMPOSITION 2164
-#define SCI_POINTYFROMPOSITION 2165
-#define SCI_LINEFROMPOSITION 2166
-#define SCI_POSITIONFROMLINE 2167
-#define SCI_LINESCROLL 2168
-#define SCI_SCROLLVERTICAL 2817
-#define SCI_SCROLLCARET 2169
-#define SCI_SCROLLRANGE 2569
-#define SCI_REPLACESEL 2170
-#define SCI_SETREADONLY 2171
-#define SCI_NULL 2172
-#define SCI_CANPASTE 2173
-#define SCI_CANUNDO 2174
-#define SCI_EMPTYUNDOBUFFER 2175
-#define SCI_UNDO 2176
-#define SCI_CUT 2177
-#define SCI_COPY 2178
-#define SCI_PASTE 2179
-#define SCI_CLEAR 2180
-#define SCI_SETTEXT 2181
-#define SCI_GETTEXT 2182
-#define SCI_GETTEXTLENGTH 2183
-#define SCI_GETDIRECTFUNCTION 2184
-#define SCI_GETDIRECTSTATUSFUNCTION 2772
-#define SCI_GETDIRECTPOINTER 2185
-#define SCI_SETOVERTYPE 2186
-#define SCI_GETOVERTYPE 2187
-#define SCI_SETCARETWIDTH 2188
-#define SCI_GETCARETWIDTH 2189
-#define SCI_SETTARGETSTART 2190
-#define SCI_GETTARGETSTART 2191
-#define SCI_SETTARGETSTARTVIRTUALSPACE 2728
-#define SCI_GETTARGETSTARTVIRTUALSPACE 2729
-#define SCI_SETTARGETEND 2192
-#define SCI_GETTARGETEND 2193
-#define SCI_SETTARGETENDVIRTUALSPACE 2730
-#define SCI_GETTARGETENDVIRTUALSPACE 2731
-#define SCI_SETTARGETRANGE 2686
-#define SCI_GETTARGETTEXT 2687
-#define SCI_TARGETFROMSELECTION 2287
-#define SCI_TARGETWHOLEDOCUMENT 2690
-#define SCI_REPLACETARGET 2194
-#define SCI_REPLACETARGETRE 2195
-#define SCI_REPLACETARGETMINIMAL 2779
-#define SCI_SEARCHINTARGET 2197
-#define SCI_SETSEARCHFLAGS 2198
-#define SCI_GETSEARCHFLAGS 2199
-#define SCI_CALLTIPSHOW 2200
-#define SCI_CALLTIPCANCEL 2201
-#define SCI_CALLTIPACTIVE 2202
-#define SCI_CALLTIPPOSSTART 2203
-#define SCI_CALLTIPSETPOSSTART 2214
-#define SCI_CALLTIPSETHLT 2204
-#define SCI_CALLTIPSETBACK 2205
-#define SCI_CALLTIPSETFORE 2206
-#define SCI_CALLTIPSETFOREHLT 2207
-#define SCI_CALLTIPUSESTYLE 2212
-#define SCI_CALLTIPSETPOSITION 2213
-#define SCI_VISIBLEFROMDOCLINE 2220
-#define SCI_DOCLINEFROMVISIBLE 2221
-#define SCI_WRAPCOUNT 2235
-#define SC_FOLDLEVELNONE 0x0
-#define SC_FOLDLEVELBASE 0x400
-#define SC_FOLDLEVELWHITEFLAG 0x1000
-#define SC_FOLDLEVELHEADERFLAG 0x2000
-#define SC_FOLDLEVELNUMBERMASK 0x0FFF
-#define SCI_SETFOLDLEVEL 2222
-#define SCI_GETFOLDLEVEL 2223
-#define SCI_GETLASTCHILD 2224
-#define SCI_GETFOLDPARENT 2225
-#define SCI_SHOWLINES 2226
-#define SCI_HIDELINES 2227
-#define SCI_GETLINEVISIBLE 2228
-#define SCI_GETALLLINESVISIBLE 2236
-#define SCI_SETFOLDEXPANDED 2229
-#define SCI_GETFOLDEXPANDED 2230
-#define SCI_TOGGLEFOLD 2231
-#define SCI_TOGGLEFOLDSHOWTEXT 2700
-#define SC_FOLDDISPLAYTEXT_HIDDEN 0
-#define SC_FOLDDISPLAYTEXT_STANDARD 1
-#define SC_FOLDDISPLAYTEXT_BOXED 2
-#define SCI_FOLDDISPLAYTEXTSETSTYLE 2701
-#define SCI_FOLDDISPLAYTEXTGETSTYLE 2707
-#define SCI_SETDEFAULTFOLDDISPLAYTEXT 2722
-#define SCI_GETDEFAULTFOLDDISPLAYTEXT 2723
-#define SC_FOLDACTION_CONTRACT 0
-#define SC_FOLDACTION_EXPAND 1
-#define SC_FOLDACTION_TOGGLE 2
-#define SC_FOLDACTION_CONTRACT_EVERY_LEVEL 4
-#define SCI_FOLDLINE 2237
-#define SCI_FOLDCHILDREN 2238
-#define SCI_EXPANDCHILDREN 2239
-#define SCI_FOLDALL 2662
-#define SCI_ENSUREVISIBLE 2232
-#define SC_AUTOMATICFOLD_NONE 0x0000
-#define SC_AUTOMATICFOLD_SHOW 0x0001
-#define SC_AUTOMATICFOLD_CLICK 0x0002
-#define SC_AUTOMATICFOLD_CHANGE 0x0004
-#define SCI_SETAUTOMATICFOLD 2663
-#define SCI_GETAUTOMATICFOLD 2664
-#define SC_FOLDFLAG_NONE 0x0000
-#define SC_FOLDFLAG_LINEBEFORE_EXPANDED 0x0002
-#define SC_FOLDFLAG_LINEBEFORE_CONTRACTED 0x0004
-#define SC_FOLDFLAG_LINEAFTER_EXPANDED 0x0008
-#define SC_FOLDFLAG_LINEAFTER_CONTRACTED 0x0010
-#define SC_FOLDFLAG_LEVELNUMBERS 0x0040
-#define SC_FOLDFLAG_LINESTATE 0x0080
-#define SCI_SETFOLDFLAGS 2233
-#define SCI_ENSUREVISIBLEENFORCEPOLICY 2234
-#define SCI_SETTABINDENTS 2260
-#define SCI_GETTABINDENTS 2261
-#define SCI_SETBACKSPACEUNINDENTS 2262
-#define SCI_GETBACKSPACEUNINDENTS 2263
-#define SC_TIME_FOREVER 10000000
-#define SCI_SETMOUSEDWELLTIME 2264
-#define SCI_GETMOUSEDWELLTIME 2265
-#define SCI_WORDSTARTPOSITION 2266
-#define SCI_WORDENDPOSITION 2267
-#define SCI_ISRANGEWORD 2691
-#define SC_IDLESTYLING_NONE 0
-#define SC_IDLESTYLING_TOVISIBLE 1
-#define SC_IDLESTYLING_AFTERVISIBLE 2
-#define SC_IDLESTYLING_ALL 3
-#define SCI_SETIDLESTYLING 2692
-#define SCI_GETIDLESTYLING 2693
-#define SC_WRAP_NONE 0
-#define SC_WRAP_WORD 1
-#define SC_WRAP_CHAR 2
-#define SC_WRAP_WHITESPACE 3
-#define SCI_SETWRAPMODE 2268
-#define SCI_GETWRAPMODE 2269
-#define SC_WRAPVISUALFLAG_NONE 0x0000
-#define SC_WRAPVISUALFLAG_END 0x0001
-#define SC_WRAPVISUALFLAG_START 0x0002
-#define SC_WRAPVISUALFLAG_MARGIN 0x0004
-#define SCI_SETWRAPVISUALFLAGS 2460
-#define SCI_GETWRAPVISUALFLAGS 2461
-#define SC_WRAPVISUALFLAGLOC_DEFAULT 0x0000
-#define SC_WRAPVISUALFLAGLOC_END_BY_TEXT 0x0001
-#define SC_WRAPVISUALFLAGLOC_START_BY_TEXT 0x0002
-#define SCI_SETWRAPVISUALFLAGSLOCATION 2462
-#define SCI_GETWRAPVISUALFLAGSLOCATION 2463
-#define SCI_SETWRAPSTARTINDENT 2464
-#define SCI_GETWRAPSTARTINDENT 2465
-#define SC_WRAPINDENT_FIXED 0
-#define SC_WRAPINDENT_SAME 1
-#define SC_WRAPINDENT_INDENT 2
-#define SC_WRAPINDENT_DEEPINDENT 3
-#define SCI_SETWRAPINDENTMODE 2472
-#define SCI_GETWRAPINDENTMODE 2473
-#define SC_CACHE_NONE 0
-#define SC_CACHE_CARET 1
-#define SC_CACHE_PAGE 2
-#define SC_CACHE_DOCUMENT 3
-#define SCI_SETLAYOUTCACHE 2272
-#define SCI_GETLAYOUTCACHE 2273
-#define SCI_SETSCROLLWIDTH 2274
-#define SCI_GETSCROLLWIDTH 2275
-#define SCI_SETSCROLLWIDTHTRACKING 2516
-#define SCI_GETSCROLLWIDTHTRACKING 2517
-#define SCI_TEXTWIDTH 2276
-#define SCI_SETENDATLASTLINE 2277
-#define SCI_GETENDATLASTLINE 2278
-#define SCI_TEXTHEIGHT 2279
-#define SCI_SETVSCROLLBAR 2280
-#define SCI_GETVSCROLLBAR 2281
-#define SCI_APPENDTEXT 2282
-#define SC_PHASES_ONE 0
-#define SC_PHASES_TWO 1
-#define SC_PHASES_MULTIPLE 2
-#define SCI_GETPHASESDRAW 2673
-#define SCI_SETPHASESDRAW 2674
-#define SC_EFF_QUALITY_MASK 0xF
-#define SC_EFF_QUALITY_DEFAULT 0
-#define SC_EFF_QUALITY_NON_ANTIALIASED 1
-#define SC_EFF_QUALITY_ANTIALIASED 2
-#define SC_EFF_QUALITY_LCD_OPTIMIZED 3
-#define SCI_SETFONTQUALITY 2611
-#define SCI_GETFONTQUALITY 2612
-#define SCI_SETFIRSTVISIBLELINE 2613
-#define SC_MULTIPASTE_ONCE 0
-#define SC_MULTIPASTE_EACH 1
-#define SCI_SETMULTIPASTE 2614
-#define SCI_GETMULTIPASTE 2615
-#define SCI_GETTAG 2616
-#define SCI_LINESJOIN 2288
-#define SCI_LINESSPLIT 2289
-#define SCI_SETFOLDMARGINCOLOUR 2290
-#define SCI_SETFOLDMARGINHICOLOUR 2291
-#define SC_ACCESSIBILITY_DISABLED 0
-#define SC_ACCESSIBILITY_ENABLED 1
-#define SCI_SETACCESSIBILITY 2702
-#define SCI_GETACCESSIBILITY 2703
-#define SCI_LINEDOWN 2300
-#define SCI_LINEDOWNEXTEND 2301
-#define SCI_LINEUP 2302
-#define SCI_LINEUPEXTEND 2303
-#define SCI_CHARLEFT 2304
-#define SCI_CHARLEFTEXTEND 2305
-#define SCI_CHARRIGHT 2306
-#define SCI_CHARRIGHTEXTEND 2307
-#define SCI_WORDLEFT 2308
-#define SCI_WORDLEFTEXTEND 2309
-#define SCI_WORDRIGHT 2310
-#define SCI_WORDRIGHTEXTEND 2311
-#define SCI_HOME 2312
-#define SCI_HOMEEXTEND 2313
-#define SCI_LINEEND 2314
-#define SCI_LINEENDEXTEND 2315
-#define SCI_DOCUMENTSTART 2316
-#define SCI_DOCUMENTSTARTEXTEND 2317
-#define SCI_DOCUMENTEND 2318
-#define SCI_DOCUMENTENDEXTEND 2319
-#define SCI_PAGEUP 2320
-#define SCI_PAGEUPEXTEND 2321
-#define SCI_PAGEDOWN 2322
-#define SCI_PAGEDOWNEXTEND 2323
-#define SCI_EDITTOGGLEOVERTYPE 2324
-#define SCI_CANCEL 2325
-#define SCI_DELETEBACK 2326
-#define SCI_TAB 2327
-#define SCI_LINEINDENT 2813
-#define SCI_BACKTAB 2328
-#define SCI_LINEDEDENT 2814
-#define SCI_NEWLINE 2329
-#define SCI_FORMFEED 2330
-#define SCI_VCHOME 2331
-#define SCI_VCHOMEEXTEND 2332
-#define SCI_ZOOMIN 2333
-#define SCI_ZOOMOUT 2334
-#define SCI_DELWORDLEFT 2335
-#define SCI_DELWORDRIGHT 2336
-#define SCI_DELWORDRIGHTEND 2518
-#define SCI_LINECUT 2337
-#define SCI_LINEDELETE 2338
-#define SCI_LINETRANSPOSE 2339
-#define SCI_LINEREVERSE 2354
-#define SCI_LINEDUPLICATE 2404
-#define SCI_LOWERCASE 2340
-#define SCI_UPPERCASE 2341
-#define SCI_LINESCROLLDOWN 2342
-#define SCI_LINESCROLLUP 2343
-#define SCI_DELETEBACKNOTLINE 2344
-#define SCI_HOMEDISPLAY 2345
-#define SCI_HOMEDISPLAYEXTEND 2346
-#define SCI_LINEENDDISPLAY 2347
-#define SCI_LINEENDDISPLAYEXTEND 2348
-#define SCI_HOMEWRAP 2349
-#define SCI_HOMEWRAPEXTEND 2450
-#define SCI_LINEENDWRAP 2451
-#define SCI_LINEENDWRAPEXTEND 2452
-#define SCI_VCHOMEWRAP 2453
-#define SCI_VCHOMEWRAPEXTEND 2454
-#define SCI_LINECOPY 2455
-#define SCI_MOVECARETINSIDEVIEW 2401
-#define SCI_LINELENGTH 2350
-#define SCI_BRACEHIGHLIGHT 2351
-#define SCI_BRACEHIGHLIGHTINDICATOR 2498
-#define SCI_BRACEBADLIGHT 2352
-#define SCI_BRACEBADLIGHTINDICATOR 2499
-#define SCI_BRACEMATCH 2353
-#define SCI_BRACEMATCHNEXT 2369
-#define SCI_GETVIEWEOL 2355
-#define SCI_SETVIEWEOL 2356
-#define SCI_GETDOCPOINTER 2357
-#define SCI_SETDOCPOINTER 2358
-#define SCI_SETMODEVENTMASK 2359
-#define EDGE_NONE 0
-#define EDGE_LINE 1
-#define EDGE_BACKGROUND 2
-#define EDGE_MULTILINE 3
-#define SCI_GETEDGECOLUMN 2360
-#define SCI_SETEDGECOLUMN 2361
-#define SCI_GETEDGEMODE 2362
-#define SCI_SETEDGEMODE 2363
-#define SCI_GETEDGECOLOUR 2364
-#define SCI_SETEDGECOLOUR 2365
-#define SCI_MULTIEDGEADDLINE 2694
-#define SCI_MULTIEDGECLEARALL 2695
-#define SCI_GETMULTIEDGECOLUMN 2749
-#define SCI_SEARCHANCHOR 2366
-#define SCI_SEARCHNEXT 2367
-#define SCI_SEARCHPREV 2368
-#define SCI_LINESONSCREEN 2370
-#define SC_POPUP_NEVER 0
-#define SC_POPUP_ALL 1
-#define SC_POPUP_TEXT 2
-#define SCI_USEPOPUP 2371
-#define SCI_SELECTIONISRECTANGLE 2372
-#define SCI_SETZOOM 2373
-#define SCI_GETZOOM 2374
-#define SC_DOCUMENTOPTION_DEFAULT 0
-#define SC_DOCUMENTOPTION_STYLES_NONE 0x1
-#define SC_DOCUMENTOPTION_TEXT_LARGE 0x100
-#define SCI_CREATEDOCUMENT 2375
-#define SCI_ADDREFDOCUMENT 2376
-#define SCI_RELEASEDOCUMENT 2377
-#define SCI_GETDOCUMENTOPTIONS 2379
-#define SCI_GETMODEVENTMASK 2378
-#define SCI_SETCOMMANDEVENTS 2717
-#define SCI_GETCOMMANDEVENTS 2718
-#define SCI_SETFOCUS 2380
-#define SCI_GETFOCUS 2381
-#define SC_STATUS_OK 0
-#define SC_STATUS_FAILURE 1
-#define SC_STATUS_BADALLOC 2
-#define SC_STATUS_WARN_START 1000
-#define SC_STATUS_WARN_REGEX 1001
-#define SCI_SETSTATUS 2382
-#define SCI_GETSTATUS 2383
-#define SCI_SETMOUSEDOWNCAPTURES 2384
-#define SCI_GETMOUSEDOWNCAPTURES 2385
-#define SCI_SETMOUSEWHEELCAPTURES 2696
-#define SCI_GETMOUSEWHEELCAPTURES 2697
-#define SCI_SETCURSOR 2386
-#define SCI_GETCURSOR 2387
-#define SCI_SETCONTROLCHARSYMBOL 2388
-#define SCI_GETCONTROLCHARSYMBOL 2389
-#define SCI_WORDPARTLEFT 2390
-#define SCI_WORDPARTLEFTEXTEND 2391
-#define SCI_WORDPARTRIGHT 2392
-#define SCI_WORDPARTRIGHTEXTEND 2393
-#define VISIBLE_SLOP 0x01
-#define VISIBLE_STRICT 0x04
-#define SCI_SETVISIBLEPOLICY 2394
-#define SCI_DELLINELEFT 2395
-#define SCI_DELLINERIGHT 2396
-#define SCI_SETXOFFSET 2397
-#define SCI_GETXOFFSET 2398
-#define SCI_CHOOSECARETX 2399
-#define SCI_GRABFOCUS 2400
-#define CARET_SLOP 0x01
-#define CARET_STRICT 0x04
-#define CARET_JUMPS 0x10
-#define CARET_EVEN 0x08
-#define SCI_SETXCARETPOLICY 2402
-#define SCI_SETYCARETPOLICY 2403
-#define SCI_SETPRINTWRAPMODE 2406
-#define SCI_GETPRINTWRAPMODE 2407
-#define SCI_SETHOTSPOTACTIVEFORE 2410
-#define SCI_GETHOTSPOTACTIVEFORE 2494
-#define SCI_SETHOTSPOTACTIVEBACK 2411
-#define SCI_GETHOTSPOTACTIVEBACK 2495
-#define SCI_SETHOTSPOTACTIVEUNDERLINE 2412
-#define SCI_GETHOTSPOTACTIVEUNDERLINE 2496
-#define SCI_SETHOTSPOTSINGLELINE 2421
-#define SCI_GETHOTSPOTSINGLELINE 2497
-#define SCI_PARADOWN 2413
-#define SCI_PARADOWNEXTEND 2414
-#define SCI_PARAUP 2415
-#define SCI_PARAUPEXTEND 2416
-#define SCI_POSITIONBEFORE 2417
-#define SCI_POSITIONAFTER 2418
-#define SCI_POSITIONRELATIVE 2670
-#define SCI_POSITIONRELATIVECODEUNITS 2716
-#define SCI_COPYRANGE 2419
-#define SCI_COPYTEXT 2420
-#define SC_SEL_STREAM 0
-#define SC_SEL_RECTANGLE 1
-#define SC_SEL_LINES 2
-#define SC_SEL_THIN 3
-#define SCI_SETSELECTIONMODE 2422
-#define SCI_CHANGESELECTIONMODE 2659
-#define SCI_GETSELECTIONMODE 2423
-#define SCI_SETMOVEEXTENDSSELECTION 2719
-#define SCI_GETMOVEEXTENDSSELECTION 2706
-#define SCI_GETLINESELSTARTPOSITION 2424
-#define SCI_GETLINESELENDPOSITION 2425
-#define SCI_LINEDOWNRECTEXTEND 2426
-#define SCI_LINEUPRECTEXTEND 2427
-#define SCI_CHARLEFTRECTEXTEND 2428
-#define SCI_CHARRIGHTRECTEXTEND 2429
-#define SCI_HOMERECTEXTEND 2430
-#define SCI_VCHOMERECTEXTEND 2431
-#define SCI_LINEENDRECTEXTEND 2432
-#define SCI_PAGEUPRECTEXTEND 2433
-#define SCI_PAGEDOWNRECTEXTEND 2434
-#define SCI_STUTTEREDPAGEUP 2435
-#define SCI_STUTTEREDPAGEUPEXTEND 2436
-#define SCI_STUTTEREDPAGEDOWN 2437
-#define SCI_STUTTEREDPAGEDOWNEXTEND 2438
-#define SCI_WORDLEFTEND 2439
-#define SCI_WORDLEFTENDEXTEND 2440
-#define SCI_WORDRIGHTEND 2441
-#define SCI_WORDRIGHTENDEXTEND 2442
-#define SCI_SETWHITESPACECHARS 2443
-#define SCI_GETWHITESPACECHARS 2647
-#define SCI_SETPUNCTUATIONCHARS 2648
-#define SCI_GETPUNCTUATIONCHARS 2649
-#define SCI_SETCHARSDEFAULT 2444
-#define SCI_AUTOCGETCURRENT 2445
-#define SCI_AUTOCGETCURRENTTEXT 2610
-#define SC_CASEINSENSITIVEBEHAVIOUR_RESPECTCASE 0
-#define SC_CASEINSENSITIVEBEHAVIOUR_IGNORECASE 1
-#define SCI_AUTOCSETCASEINSENSITIVEBEHAVIOUR 2634
-#define SCI_AUTOCGETCASEINSENSITIVEBEHAVIOUR 2635
-#define SC_MULTIAUTOC_ONCE 0
-#define SC_MULTIAUTOC_EACH 1
-#define SCI_AUTOCSETMULTI 2636
-#define SCI_AUTOCGETMULTI 2637
-#define SC_ORDER_PRESORTED 0
-#define SC_ORDER_PERFORMSORT 1
-#define SC_ORDER_CUSTOM 2
-#define SCI_AUTOCSETORDER 2660
-#define SCI_AUTOCGETORDER 2661
-#define SCI_ALLOCATE 2446
-#define SCI_TARGETASUTF8 2447
-#define SCI_SETLENGTHFORENCODE 2448
-#define SCI_ENCODEDFROMUTF8 2449
-#define SCI_FINDCOLUMN 2456
-#define SC_CARETSTICKY_OFF 0
-#define SC_CARETSTICKY_ON 1
-#define SC_CARETSTICKY_WHITESPACE 2
-#define SCI_GETCARETSTICKY 2457
-#define SCI_SETCARETSTICKY 2458
-#define SCI_TOGGLECARETSTICKY 2459
-#define SCI_SETPASTECONVERTENDINGS 2467
-#define SCI_GETPASTECONVERTENDINGS 2468
-#define SCI_REPLACERECTANGULAR 2771
-#define SCI_SELECTIONDUPLICATE 2469
-#define SCI_SETCARETLINEBACKALPHA 2470
-#define SCI_GETCARETLINEBACKALPHA 2471
-#define CARETSTYLE_INVISIBLE 0
-#define CARETSTYLE_LINE 1
-#define CARETSTYLE_BLOCK 2
-#define CARETSTYLE_OVERSTRIKE_BAR 0
-#define CARETSTYLE_OVERSTRIKE_BLOCK 0x10
-#define CARETSTYLE_CURSES 0x20
-#define CARETSTYLE_INS_MASK 0xF
-#define CARETSTYLE_BLOCK_AFTER 0x100
-#define SCI_SETCARETSTYLE 2512
-#define SCI_GETCARETSTYLE 2513
-#define SCI_SETINDICATORCURRENT 2500
-#define SCI_GETINDICATORCURRENT 2501
-#define SCI_SETINDICATORVALUE 2502
-#define SCI_GETINDICATORVALUE 2503
-#define SCI_INDICATORFILLRANGE 2504
-#define SCI_INDICATORCLEARRANGE 2505
-#define SCI_INDICATORALLONFOR 2506
-#define SCI_INDICATORVALUEAT 2507
-#define SCI_INDICATORSTART 2508
-#define SCI_INDICATOREND 2509
-#define SCI_SETPOSITIONCACHE 2514
-#define SCI_GETPOSITIONCACHE 2515
-#define SCI_SETLAYOUTTHREADS 2775
-#define SCI_GETLAYOUTTHREADS 2776
-#define SCI_COPYALLOWLINE 2519
-#define SCI_CUTALLOWLINE 2810
-#define SCI_SETCOPYSEPARATOR 2811
-#define SCI_GETCOPYSEPARATOR 2812
-#define SCI_GETCHARACTERPOINTER 2520
-#define SCI_GETRANGEPOINTER 2643
-#define SCI_GETGAPPOSITION 2644
-#define SCI_INDICSETALPHA 2523
-#define SCI_INDICGETALPHA 2524
-#define SCI_INDICSETOUTLINEALPHA 2558
-#define SCI_INDICGETOUTLINEALPHA 2559
-#define SCI_SETEXTRAASCENT 2525
-#define SCI_GETEXTRAASCENT 2526
-#define SCI_SETEXTRADESCENT 2527
-#define SCI_GETEXTRADESCENT 2528
-#define SCI_MARKERSYMBOLDEFINED 2529
-#define SCI_MARGINSETTEXT 2530
-#define SCI_MARGINGETTEXT 2531
-#define SCI_MARGINSETSTYLE 2532
-#define SCI_MARGINGETSTYLE 2533
-#define SCI_MARGINSETSTYLES 2534
-#define SCI_MARGINGETSTYLES 2535
-#define SCI_MARGINTEXTCLEARALL 2536
-#define SCI_MARGINSETSTYLEOFFSET 2537
-#define SCI_MARGINGETSTYLEOFFSET 2538
-#define SC_MARGINOPTION_NONE 0
-#define SC_MARGINOPTION_SUBLINESELECT 1
-#define SCI_SETMARGINOPTIONS 2539
-#define SCI_GETMARGINOPTIONS 2557
-#define SCI_ANNOTATIONSETTEXT 2540
-#define SCI_ANNOTATIONGETTEXT 2541
-#define SCI_ANNOTATIONSETSTYLE 2542
-#define SCI_ANNOTATIONGETSTYLE 2543
-#define SCI_ANNOTATIONSETSTYLES 2544
-#define SCI_ANNOTATIONGETSTYLES 2545
-#define SCI_ANNOTATIONGETLINES 2546
-#define SCI_ANNOTATIONCLEARALL 2547
-#define ANNOTATION_HIDDEN 0
-#define ANNOTATION_STANDARD 1
-#define ANNOTATION_BOXED 2
-#define ANNOTATION_INDENTED 3
-#define SCI_ANNOTATIONSETVISIBLE 2548
-#define SCI_ANNOTATIONGETVISIBLE 2549
-#define SCI_ANNOTATIONSETSTYLEOFFSET 2550
-#define SCI_ANNOTATIONGETSTYLEOFFSET 2551
-#define SCI_RELEASEALLEXTENDEDSTYLES 2552
-#define SCI_ALLOCATEEXTENDEDSTYLES 2553
-#define UNDO_NONE 0
-#define UNDO_MAY_COALESCE 1
-#define SCI_ADDUNDOACTION 2560
-#define SCI_CHARPOSITIONFROMPOINT 2561
-#define SCI_CHARPOSITIONFROMPOINTCLOSE 2562
-#define SCI_SETMOUSESELECTIONRECTANGULARSWITCH 2668
-#define SCI_GETMOUSESELECTIONRECTANGULARSWITCH 2669
-#define SCI_SETMULTIPLESELECTION 2563
-#define SCI_GETMULTIPLESELECTION 2564
-#define SCI_SETADDITIONALSELECTIONTYPING 2565
-#define SCI_GETADDITIONALSELECTIONTYPING 2566
-#define SCI_SETADDITIONALCARETSBLINK 2567
-#define SCI_GETADDITIONALCARETSBLINK 2568
-#define SCI_SETADDITIONALCARETSVISIBLE 2608
-#define SCI_GETADDITIONALCARETSVISIBLE 2609
-#define SCI_GETSELECTIONS 2570
-#define SCI_GETSELECTIONEMPTY 2650
-#define SCI_CLEARSELECTIONS 2571
-#define SCI_SETSELECTION 2572
-#define SCI_ADDSELECTION 2573
-#define SCI_SELECTIONFROMPOINT 2474
-#define SCI_DROPSELECTIONN 2671
-#define SCI_SETMAINSELECTION 2574
-#define SCI_GETMAINSELECTION 2575
-#define SCI_SETSELECTIONNCARET 2576
-#define SCI_GETSELECTIONNCARET 2577
-#define SCI_SETSELECTIONNANCHOR 2578
-#define SCI_GETSELECTIONNANCHOR 2579
-#define SCI_SETSELECTIONNCARETVIRTUALSPACE 2580
-#define SCI_GETSELECTIONNCARETVIRTUALSPACE 2581
-#define SCI_SETSELECTIONNANCHORVIRTUALSPACE 2582
-#define SCI_GETSELECTIONNANCHORVIRTUALSPACE 2583
-#define SCI_SETSELECTIONNSTART 2584
-#define SCI_GETSELECTIONNSTART 2585
-#define SCI_GETSELECTIONNSTARTVIRTUALSPACE 2726
-#define SCI_SETSELECTIONNEND 2586
-#define SCI_GETSELECTIONNENDVIRTUALSPACE 2727
-#define SCI_GETSELECTIONNEND 2587
-#define SCI_SETRECTANGULARSELECTIONCARET 2588
-#define SCI_GETRECTANGULARSELECTIONCARET 2589
-#define SCI_SETRECTANGULARSELECTIONANCHOR 2590
-#define SCI_GETRECTANGULARSELECTIONANCHOR 2591
-#define SCI_SETRECTANGULARSELECTIONCARETVIRTUALSPACE 2592
-#define SCI_GETRECTANGULARSELECTIONCARETVIRTUALSPACE 2593
-#define SCI_SETRECTANGULARSELECTIONANCHORVIRTUALSPACE 2594
-#define SCI_GETRECTANGULARSELECTIONANCHORVIRTUALSPACE 2595
-#define SCVS_NONE 0
-#define SCVS_RECTANGULARSELECTION 1
-#define SCVS_USERACCESSIBLE 2
-#define SCVS_NOWRAPLINESTART 4
-#define SCI_SETVIRTUALSPACEOPTIONS 2596
-#define SCI_GETVIRTUALSPACEOPTIONS 2597
-#define SCI_SETRECTANGULARSELECTIONMODIFIER 2598
-#define SCI_GETRECTANGULARSELECTIONMODIFIER 2599
-#define SCI_SETADDITIONALSELFORE 2600
-#define SCI_SETADDITIONALSELBACK 2601
-#define SCI_SETADDITIONALSELALPHA 2602
-#define SCI_GETADDITIONALSELALPHA 2603
-#define SCI_SETADDITIONALCARETFORE 2604
-#define SCI_GETADDITIONALCARETFORE 2605
-#define SCI_ROTATESELECTION 2606
-#define SCI_SWAPMAINANCHORCARET 2607
-#define SCI_MULTIPLESELECTADDNEXT 2688
-#define SCI_MULTIPLESELECTADDEACH 2689
-#define SCI_CHANGELEXERSTATE 2617
-#define SCI_CONTRACTEDFOLDNEXT 2618
-#define SCI_VERTICALCENTRECARET 2619
-#define SCI_MOVESELECTEDLINESUP 2620
-#define SCI_MOVESELECTEDLINESDOWN 2621
-#define SCI_SETIDENTIFIER 2622
-#define SCI_GETIDENTIFIER 2623
-#define SCI_RGBAIMAGESETWIDTH 2624
-#define SCI_RGBAIMAGESETHEIGHT 2625
-#define SCI_RGBAIMAGESETSCALE 2651
-#define SCI_MARKERDEFINERGBAIMAGE 2626
-#define SCI_REGISTERRGBAIMAGE 2627
-#define SCI_SCROLLTOSTART 2628
-#define SCI_SCROLLTOEND 2629
-#define SC_TECHNOLOGY_DEFAULT 0
-#define SC_TECHNOLOGY_DIRECTWRITE 1
-#define SC_TECHNOLOGY_DIRECTWRITERETAIN 2
-#define SC_TECHNOLOGY_DIRECTWRITEDC 3
-#define SC_TECHNOLOGY_DIRECT_WRITE_1 4
-#define SCI_SETTECHNOLOGY 2630
-#define SCI_GETTECHNOLOGY 2631
-#define SCI_CREATELOADER 2632
-#define SCI_FINDINDICATORSHOW 2640
-#define SCI_FINDINDICATORFLASH 2641
-#define SCI_FINDINDICATORHIDE 2642
-#define SCI_VCHOMEDISPLAY 2652
-#define SCI_VCHOMEDISPLAYEXTEND 2653
-#define SCI_GETCARETLINEVISIBLEALWAYS 2654
-#define SCI_SETCARETLINEVISIBLEALWAYS 2655
-#define SC_LINE_END_TYPE_DEFAULT 0
-#define SC_LINE_END_TYPE_UNICODE 1
-#define SCI_SETLINEENDTYPESALLOWED 2656
-#define SCI_GETLINEENDTYPESALLOWED 2657
-#define SCI_GETLINEENDTYPESACTIVE 2658
-#define SCI_SETREPRESENTATION 2665
-#define SCI_GETREPRESENTATION 2666
-#define SCI_CLEARREPRESENTATION 2667
-#define SCI_CLEARALLREPRESENTATIONS 2770
-#define SC_REPRESENTATION_PLAIN 0
-#define SC_REPRESENTATION_BLOB 1
-#define SC_REPRESENTATION_COLOUR 0x10
-#define SCI_SETREPRESENTATIONAPPEARANCE 2766
-#define SCI_GETREPRESENTATIONAPPEARANCE 2767
-#define SCI_SETREPRESENTATIONCOLOUR 2768
-#define SCI_GETREPRESENTATIONCOLOUR 2769
-#define SCI_EOLANNOTATIONSETTEXT 2740
-#define SCI_EOLANNOTATIONGETTEXT 2741
-#define SCI_EOLANNOTATIONSETSTYLE 2742
-#define SCI_EOLANNOTATIONGETSTYLE 2743
-#define SCI_EOLANNOTATIONCLEARALL 2744
-#define EOLANNOTATION_HIDDEN 0x0
-#define EOLANNOTATION_STANDARD 0x1
-#define EOLANNOTATION_BOXED 0x2
-#define EOLANNOTATION_STADIUM 0x100
-#define EOLANNOTATION_FLAT_CIRCLE 0x101
-#define EOLANNOTATION_ANGLE_CIRCLE 0x102
-#define EOLANNOTATION_CIRCLE_FLAT 0x110
-#define EOLANNOTATION_FLATS 0x111
-#define EOLANNOTATION_ANGLE_FLAT 0x112
-#define EOLANNOTATION_CIRCLE_ANGLE 0x120
-#define EOLANNOTATION_FLAT_ANGLE 0x121
-#define EOLANNOTATION_ANGLES 0x122
-#define SCI_EOLANNOTATIONSETVISIBLE 2745
-#define SCI_EOLANNOTATIONGETVISIBLE 2746
-#define SCI_EOLANNOTATIONSETSTYLEOFFSET 2747
-#define SCI_EOLANNOTATIONGETSTYLEOFFSET 2748
-#define SC_SUPPORTS_LINE_DRAWS_FINAL 0
-#define SC_SUPPORTS_PIXEL_DIVISIONS 1
-#define SC_SUPPORTS_FRACTIONAL_STROKE_WIDTH 2
-#define SC_SUPPORTS_TRANSLUCENT_STROKE 3
-#define SC_SUPPORTS_PIXEL_MODIFICATION 4
-#define SC_SUPPORTS_THREAD_SAFE_MEASURE_WIDTHS 5
-#define SCI_SUPPORTSFEATURE 2750
-#define SC_LINECHARACTERINDEX_NONE 0
-#define SC_LINECHARACTERINDEX_UTF32 1
-#define SC_LINECHARACTERINDEX_UTF16 2
-#define SCI_GETLINECHARACTERINDEX 2710
-#define SCI_ALLOCATELINECHARACTERINDEX 2711
-#define SCI_RELEASELINECHARACTERINDEX 2712
-#define SCI_LINEFROMINDEXPOSITION 2713
-#define SCI_INDEXPOSITIONFROMLINE 2714
-#define SCI_STARTRECORD 3001
-#define SCI_STOPRECORD 3002
-#define SCI_GETLEXER 4002
-#define SCI_COLOURISE 4003
-#define SCI_SETPROPERTY 4004
-#define KEYWORDSET_MAX 8
-#define SCI_SETKEYWORDS 4005
-#define SCI_GETPROPERTY 4008
-#define SCI_GETPROPERTYEXPANDED 4009
-#define SCI_GETPROPERTYINT 4010
-#define SCI_GETLEXERLANGUAGE 4012
-#define SCI_PRIVATELEXERCALL 4013
-#define SCI_PROPERTYNAMES 4014
-#define SC_TYPE_BOOLEAN 0
-#define SC_TYPE_INTEGER 1
-#define SC_TYPE_STRING 2
-#define SCI_PROPERTYTYPE 4015
-#define SCI_DESCRIBEPROPERTY 4016
-#define SCI_DESCRIBEKEYWORDSETS 4017
-#define SCI_GETLINEENDTYPESSUPPORTED 4018
-#define SCI_ALLOCATESUBSTYLES 4020
-#define SCI_GETSUBSTYLESSTART 4021
-#define SCI_GETSUBSTYLESLENGTH 4022
-#define SCI_GETSTYLEFROMSUBSTYLE 4027
-#define SCI_GETPRIMARYSTYLEFROMSTYLE 4028
-#define SCI_FREESUBSTYLES 4023
-#define SCI_SETIDENTIFIERS 4024
-#define SCI_DISTANCETOSECONDARYSTYLES 4025
-#define SCI_GETSUBSTYLEBASES 4026
-#define SCI_GETNAMEDSTYLES 4029
-#define SCI_NAMEOFSTYLE 4030
-#define SCI_TAGSOFSTYLE 4031
-#define SCI_DESCRIPTIONOFSTYLE 4032
-#define SCI_SETILEXER 4033
-#define SC_MOD_NONE 0x0
-#define SC_MOD_INSERTTEXT 0x1
-#define SC_MOD_DELETETEXT 0x2
-#define SC_MOD_CHANGESTYLE 0x4
-#define SC_MOD_CHANGEFOLD 0x8
-#define SC_PERFORMED_USER 0x10
-#define SC_PERFORMED_UNDO 0x20
-#define SC_PERFORMED_REDO 0x40
-#define SC_MULTISTEPUNDOREDO 0x80
-#define SC_LASTSTEPINUNDOREDO 0x100
-#define SC_MOD_CHANGEMARKER 0x200
-#define SC_MOD_BEFOREINSERT 0x400
-#define SC_MOD_BEFOREDELETE 0x800
-#define SC_MULTILINEUNDOREDO 0x1000
-#define SC_STARTACTION 0x2000
-#define SC_MOD_CHANGEINDICATOR 0x4000
-#define SC_MOD_CHANGELINESTATE 0x8000
-#define SC_MOD_CHANGEMARGIN 0x10000
-#define SC_MOD_CHANGEANNOTATION 0x20000
-#define SC_MOD_CONTAINER 0x40000
-#define SC_MOD_LEXERSTATE 0x80000
-#define SC_MOD_INSERTCHECK 0x100000
-#define SC_MOD_CHANGETABSTOPS 0x200000
-#define SC_MOD_CHANGEEOLANNOTATION 0x400000
-#define SC_MODEVENTMASKALL 0x7FFFFF
-#define SC_UPDATE_NONE 0x0
-#define SC_UPDATE_CONTENT 0x1
-#define SC_UPDATE_SELECTION 0x2
-#define SC_UPDATE_V_SCROLL 0x4
-#define SC_UPDATE_H_SCROLL 0x8
-#define SCEN_CHANGE 768
-#define SCEN_SETFOCUS 512
-#define SCEN_KILLFOCUS 256
-#define SCK_DOWN 300
-#define SCK_UP 301
-#define SCK_LEFT 302
-#define SCK_RIGHT 303
-#define SCK_HOME 304
-#define SCK_END 305
-#define SCK_PRIOR 306
-#define SCK_NEXT 307
-#define SCK_DELETE 308
-#define SCK_INSERT 309
-#define SCK_ESCAPE 7
-#define SCK_BACK 8
-#define SCK_TAB 9
-#define SCK_RETURN 13
-#define SCK_ADD 310
-#define SCK_SUBTRACT 311
-#define SCK_DIVIDE 312
-#define SCK_WIN 313
-#define SCK_RWIN 314
-#define SCK_MENU 315
-#define SCMOD_NORM 0
-#define SCMOD_SHIFT 1
-#define SCMOD_CTRL 2
-#define SCMOD_ALT 4
-#define SCMOD_SUPER 8
-#define SCMOD_META 16
-#define SC_AC_FILLUP 1
-#define SC_AC_DOUBLECLICK 2
-#define SC_AC_TAB 3
-#define SC_AC_NEWLINE 4
-#define SC_AC_COMMAND 5
-#define SC_AC_SINGLE_CHOICE 6
-#define SC_CHARACTERSOURCE_DIRECT_INPUT 0
-#define SC_CHARACTERSOURCE_TENTATIVE_INPUT 1
-#define SC_CHARACTERSOURCE_IME_RESULT 2
-#define SCN_STYLENEEDED 2000
-#define SCN_CHARADDED 2001
-#define SCN_SAVEPOINTREACHED 2002
-#define SCN_SAVEPOINTLEFT 2003
-#define SCN_MODIFYATTEMPTRO 2004
-#define SCN_KEY 2005
-#define SCN_DOUBLECLICK 2006
-#define SCN_UPDATEUI 2007
-#define SCN_MODIFIED 2008
-#define SCN_MACRORECORD 2009
-#define SCN_MARGINCLICK 2010
-#define SCN_NEEDSHOWN 2011
-#define SCN_PAINTED 2013
-#define SCN_USERLISTSELECTION 2014
-#define SCN_URIDROPPED 2015
-#define SCN_DWELLSTART 2016
-#define SCN_DWELLEND 2017
-#define SCN_ZOOM 2018
-#define SCN_HOTSPOTCLICK 2019
-#define SCN_HOTSPOTDOUBLECLICK 2020
-#define SCN_CALLTIPCLICK 2021
-#define SCN_AUTOCSELECTION 2022
-#define SCN_INDICATORCLICK 2023
-#define SCN_INDICATORRELEASE 2024
-#define SCN_AUTOCCANCELLED 2025
-#define SCN_AUTOCCHARDELETED 2026
-#define SCN_HOTSPOTRELEASECLICK 2027
-#define SCN_FOCUSIN 2028
-#define SCN_FOCUSOUT 2029
-#define SCN_AUTOCCOMPLETED 2030
-#define SCN_MARGINRIGHTCLICK 2031
-#define SCN_AUTOCSELECTIONCHANGE 2032
-#ifndef SCI_DISABLE_PROVISIONAL
-#define SC_BIDIRECTIONAL_DISABLED 0
-#define SC_BIDIRECTIONAL_L2R 1
-#define SC_BIDIRECTIONAL_R2L 2
-#define SCI_GETBIDIRECTIONAL 2708
-#define SCI_SETBIDIRECTIONAL 2709
-#endif
-/* --Autogenerated -- end of section automatically generated from Scintilla.iface */
-
-#endif
-
-/* These structures are defined to be exactly the same shape as the Win32
- * CHARRANGE, TEXTRANGE, FINDTEXTEX, FORMATRANGE, and NMHDR structs.
- * So older code that treats Scintilla as a RichEdit will work. */
-
-struct Sci_CharacterRange {
-	Sci_PositionCR cpMin;
-	Sci_PositionCR cpMax;
-};
-
-struct Sci_CharacterRangeFull {
-	Sci_Position cpMin;
-	Sci_Position cpMax;
-};
-
-struct Sci_TextRange {
-	struct Sci_CharacterRange chrg;
-	char *lpstrText;
-};
-
-struct Sci_TextRangeFull {
-	struct Sci_CharacterRangeFull chrg;
-	char *lpstrText;
-};
-
-struct Sci_TextToFind {
-	struct Sci_CharacterRange chrg;
-	const char *lpstrText;
-	struct Sci_CharacterRange chrgText;
-};
-
-struct Sci_TextToFindFull {
-	struct Sci_CharacterRangeFull chrg;
-	const char *lpstrText;
-	struct Sci_CharacterRangeFull chrgText;
-};
-
-typedef void *Sci_SurfaceID;
-
-struct Sci_Rectangle {
-	int left;
-	int top;
-	int right;
-	int bottom;
-};
-
-/* This structure is used in printing and requires some of the graphics types
- * from Platform.h.  Not needed by most client code. */
-
-struct Sci_RangeToFormat {
-	Sci_SurfaceID hdc;
-	Sci_SurfaceID hdcTarget;
-	struct Sci_Rectangle rc;
-	struct Sci_Rectangle rcPage;
-	struct Sci_CharacterRange chrg;
-};
-
-struct Sci_RangeToFormatFull {
-	Sci_SurfaceID hdc;
-	Sci_SurfaceID hdcTarget;
-	struct Sci_Rectangle rc;
-	struct Sci_Rectangle rcPage;
-	struct Sci_CharacterRangeFull chrg;
-};
-
-#ifndef __cplusplus
-/* For the GTK+ platform, g-ir-scanner needs to have these typedefs. This
- * is not required in C++ code and has caused problems in the past. */
-typedef struct Sci_NotifyHeader Sci_NotifyHeader;
-typedef struct SCNotification SCNotification;
-#endif
-
-struct Sci_NotifyHeader {
-	/* Compatible with Windows NMHDR.
-	 * hwndFrom is really an environment specific window handle or pointer
-	 * but most clients of Scintilla.h do not have this type visible. */
-	void *hwndFrom;
-	uptr_t idFrom;
-	unsigned int code;
-};
-
-struct SCNotification {
-	Sci_NotifyHeader nmhdr;
-	Sci_Position position;
-	/* SCN_STYLENEEDED, SCN_DOUBLECLICK, SCN_MODIFIED, SCN_MARGINCLICK, */
-	/* SCN_MARGINRIGHTCLICK, SCN_NEEDSHOWN, SCN_DWELLSTART, SCN_DWELLEND, */
-	/* SCN_CALLTIPCLICK, */
-	/* SCN_HOTSPOTCLICK, SCN_HOTSPOTDOUBLECLICK, SCN_HOTSPOTRELEASECLICK, */
-	/* SCN_INDICATORCLICK, SCN_INDICATORRELEASE, */
-	/* SCN_USERLISTSELECTION, SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, */
-	/* SCN_AUTOCSELECTIONCHANGE */
-
-	int ch;
-	/* SCN_CHARADDED, SCN_KEY, SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, */
-	/* SCN_USERLISTSELECTION */
-	int modifiers;
-	/* SCN_KEY, SCN_DOUBLECLICK, SCN_HOTSPOTCLICK, SCN_HOTSPOTDOUBLECLICK, */
-	/* SCN_HOTSPOTRELEASECLICK, SCN_INDICATORCLICK, SCN_INDICATORRELEASE, */
-	/* SCN_MARGINCLICK, SCN_MARGINRIGHTCLICK */
-
-	int modificationType;	/* SCN_MODIFIED */
-	const char *text;
-	/* SCN_MODIFIED, SCN_USERLISTSELECTION, SCN_URIDROPPED, */
-	/* SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, SCN_AUTOCSELECTIONCHANGE */
-
-	Sci_Position length;		/* SCN_MODIFIED */
-	Sci_Position linesAdded;	/* SCN_MODIFIED */
-	int message;	/* SCN_MACRORECORD */
-	uptr_t wParam;	/* SCN_MACRORECORD */
-	sptr_t lParam;	/* SCN_MACRORECORD */
-	Sci_Position line;		/* SCN_MODIFIED */
-	int foldLevelNow;	/* SCN_MODIFIED */
-	int foldLevelPrev;	/* SCN_MODIFIED */
-	int margin;		/* SCN_MARGINCLICK, SCN_MARGINRIGHTCLICK */
-	int listType;	/* SCN_USERLISTSELECTION, SCN_AUTOCSELECTIONCHANGE */
-	int x;			/* SCN_DWELLSTART, SCN_DWELLEND */
-	int y;		/* SCN_DWELLSTART, SCN_DWELLEND */
-	int token;		/* SCN_MODIFIED with SC_MOD_CONTAINER */
-	Sci_Position annotationLinesAdded;	/* SCN_MODIFIED with SC_MOD_CHANGEANNOTATION */
-	int updated;	/* SCN_UPDATEUI */
-	int listCompletionMethod;
-	/* SCN_AUTOCSELECTION, SCN_AUTOCCOMPLETED, SCN_USERLISTSELECTION */
-	int characterSource;	/* SCN_CHARADDED */
-};
-
-#ifdef INCLUDE_DEPRECATED_FEATURES
-
-#define SCI_SETKEYSUNICODE 2521
-#define SCI_GETKEYSUNICODE 2522
-
-#define SCI_GETTWOPHASEDRAW 2283
-#define SCI_SETTWOPHASEDRAW 2284
-
-#define CharacterRange Sci_CharacterRange
-#define TextRange Sci_TextRange
-#define TextToFind Sci_TextToFind
-#define RangeToFormat Sci_RangeToFormat
-#define NotifyHeader Sci_NotifyHeader
-
-#define SCI_SETSTYLEBITS 2090
-#define SCI_GETSTYLEBITS 2091
-#define SCI_GETSTYLEBITSNEEDED 4011
-
-#define INDIC0_MASK 0x20
-#define INDIC1_MASK 0x40
-#define INDIC2_MASK 0x80
-#define INDICS_MASK 0xE0
-
-#endif
-
-#endif
+/* Scintilla source code edit control */
+/** @file Scintilla.h
+ ** Interface to the edit control.
+ **/
+/* Copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
+ * The License.txt file describes the conditions under which this software may be distributed. */
+
+/* Most of this file is automatically generated from the Scintilla.iface interface definition
+ * file which contains any comments about the definitions. HFacer.py does the generation. */
+
+#ifndef SCINTILLA_H
+#define SCINTILLA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+/* Return false on failure: */
+int Scintilla_RegisterClasses(void *hInstance);
+int Scintilla_ReleaseResources(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+// Include header that defines basic numeric types.
+#include <stdint.h>
+
+// Define uptr_t, an unsigned integer type large enough to hold a pointer.
+typedef uintptr_t uptr_t;
+// Define sptr_t, a signed integer large enough to hold a pointer.
+typedef intptr_t sptr_t;
+
+#include "Sci_Position.h"
+
+typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam);
+typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam, int *pStatus);
+
+#ifndef SCI_DISABLE_AUTOGENERATED
+
+/* ++Autogenerated -- start of section automatically generated from Scintilla.iface */
+#define INVALID_POSITION -1
+#define SCI_START 2000
+#define SCI_OPTIONAL_START 3000
+#define SCI_LEXER_START 4000
+#define SCI_ADDTEXT 2001
+#define SCI_ADDSTYLEDTEXT 2002
+#define SCI_INSERTTEXT 2003
+#define SCI_CHANGEINSERTION 2672
+#define SCI_CLEARALL 2004
+#define SCI_DELETERANGE 2645
+#define SCI_CLEARDOCUMENTSTYLE 2005
+#define SCI_GETLENGTH 2006
+#define SCI_GETCHARAT 2007
+#define SCI_GETCURRENTPOS 2008
+#define SCI_GETANCHOR 2009
+#define SCI_GETSTYLEAT 2010
+#define SCI_GETSTYLEINDEXAT 2038
+#define SCI_REDO 2011
+#define SCI_SETUNDOCOLLECTION 2012
+#define SCI_SELECTALL 2013
+#define SCI_SETSAVEPOINT 2014
+#define SCI_GETSTYLEDTEXT 2015
+#define SCI_GETSTYLEDTEXTFULL 2778
+#define SCI_CANREDO 2016
+#define SCI_MARKERLINEFROMHANDLE 2017
+#define SCI_MARKERDELETEHANDLE 2018
+#define SCI_MARKERHANDLEFROMLINE 2732
+#define SCI_MARKERNUMBERFROMLINE 2733
+#define SCI_GETUNDOCOLLECTION 2019
+#define SCWS_INVISIBLE 0
+#define SCWS_VISIBLEALWAYS 1
+#define SCWS_VISIBLEAFTERINDENT 2
+#define SCWS_VISIBLEONLYININDENT 3
+#define SCI_GETVIEWWS 2020
+#define SCI_SETVIEWWS 2021
+#define SCTD_LONGARROW 0
+#define SCTD_STRIKEOUT 1
+#define SCI_GETTABDRAWMODE 2698
+#define SCI_SETTABDRAWMODE 2699
+#define SCI_POSITIONFROMPOINT 2022
+#define SCI_POSITIONFROMPOINTCLOSE 2023
+#define SCI_GOTOLINE 2024
+#define SCI_GOTOPOS 2025
+#define SCI_SETANCHOR 2026
+#define SCI_GETCURLINE 2027
+#define SCI_GETENDSTYLED 2028
+#define SC_EOL_CRLF 0
+#define SC_EOL_CR 1
+#define SC_EOL_LF 2
+#define SCI_CONVERTEOLS 2029
+#define SCI_GETEOLMODE 2030
+#define SCI_SETEOLMODE 2031
+#define SCI_STARTSTYLING 2032
+#define SCI_SETSTYLING 2033
+#define SCI_GETBUFFEREDDRAW 2034
+#define SCI_SETBUFFEREDDRAW 2035
+#define SCI_SETTABWIDTH 2036
+#define SCI_GETTABWIDTH 2121
+#define SCI_SETTABMINIMUMWIDTH 2724
+#define SCI_GETTABMINIMUMWIDTH 2725
+#define SCI_CLEARTABSTOPS 2675
+#define SCI_ADDTABSTOP 2676
+#define SCI_GETNEXTTABSTOP 2677
+#define SC_CP_UTF8 65001
+#define SCI_SETCODEPAGE 2037
+#define SCI_SETFONTLOCALE 2760
+#define SCI_GETFONTLOCALE 2761
+#define SC_IME_WINDOWED 0
+#define SC_IME_INLINE 1
+#define SCI_GETIMEINTERACTION 2678
+#define SCI_SETIMEINTERACTION 2679
+#define SC_ALPHA_TRANSPARENT 0
+#define SC_ALPHA_OPAQUE 255
+#define SC_ALPHA_NOALPHA 256
+#define SC_CURSORNORMAL -1
+#define SC_CURSORARROW 2
+#define SC_CURSORWAIT 4
+#define SC_CURSORREVERSEARROW 7
+#define MARKER_MAX 31
+#define SC_MARK_CIRCLE 0
+#define SC_MARK_ROUNDRECT 1
+#define SC_MARK_ARROW 2
+#define SC_MARK_SMALLRECT 3
+#define SC_MARK_SHORTARROW 4
+#define SC_MARK_EMPTY 5
+#define SC_MARK_ARROWDOWN 6
+#define SC_MARK_MINUS 7
+#define SC_MARK_PLUS 8
+#define SC_MARK_VLINE 9
+#define SC_MARK_LCORNER 10
+#define SC_MARK_TCORNER 11
+#define SC_MARK_BOXPLUS 12
+#define SC_MARK_BOXPLUSCONNECTED 13
+#define SC_MARK_BOXMINUS 14
+#define SC_MARK_BOXMINUSCONNECTED 15
+#define SC_MARK_LCORNERCURVE 16
+#define SC_MARK_TCORNERCURVE 17
+#define SC_MARK_CIRCLEPLUS 18
+#define SC_MARK_CIRCLEPLUSCONNECTED 19
+#define SC_MARK_CIRCLEMINUS 20
+#define SC_MARK_CIRCLEMINUSCONNECTED 21
+#define SC_MARK_BACKGROUND 22
+#define SC_MARK_DOTDOTDOT 23
+#define SC_MARK_ARROWS 24
+#define SC_MARK_PIXMAP 25
+#define SC_MARK_FULLRECT 26
+#define SC_MARK_LEFTRECT 27
+#define SC_MARK_AVAILABLE 28
+#define SC_MARK_UNDERLINE 29
+#define SC_MARK_RGBAIMAGE 30
+#define SC_MARK_BOOKMARK 31
+#define SC_MARK_VERTICALBOOKMARK 32
+#define SC_MARK_BAR 33
+#define SC_MARK_CHARACTER 10000
+#define SC_MARKNUM_HISTORY_REVERTED_TO_ORIGIN 21
+#define SC_MARKNUM_HISTORY_SAVED 22
+#define SC_MARKNUM_HISTORY_MODIFIED 23
+#define SC_MARKNUM_HISTORY_REVERTED_TO_MODIFIED 24
+#define SC_MARKNUM_FOLDEREND 25
+#define SC_MARKNUM_FOLDEROPENMID 26
+#define SC_MARKNUM_FOLDERMIDTAIL 27
+#define SC_MARKNUM_FOLDERTAIL 28
+#define SC_MARKNUM_FOLDERSUB 29
+#define SC_MARKNUM_FOLDER 30
+#define SC_MARKNUM_FOLDEROPEN 31
+#define SC_MASK_HISTORY 0x01E00000
+#define SC_MASK_FOLDERS 0xFE000000
+#define SCI_MARKERDEFINE 2040
+#define SCI_MARKERSETFORE 2041
+#define SCI_MARKERSETBACK 2042
+#define SCI_MARKERSETBACKSELECTED 2292
+#define SCI_MARKERSETFORETRANSLUCENT 2294
+#define SCI_MARKERSETBACKTRANSLUCENT 2295
+#define SCI_MARKERSETBACKSELECTEDTRANSLUCENT 2296
+#define SCI_MARKERSETSTROKEWIDTH 2297
+#define SCI_MARKERENABLEHIGHLIGHT 2293
+#define SCI_MARKERADD 2043
+#define SCI_MARKERDELETE 2044
+#define SCI_MARKERDELETEALL 2045
+#define SCI_MARKERGET 2046
+#define SCI_MARKERNEXT 2047
+#define SCI_MARKERPREVIOUS 2048
+#define SCI_MARKERDEFINEPIXMAP 2049
+#define SCI_MARKERADDSET 2466
+#define SCI_MARKERSETALPHA 2476
+#define SCI_MARKERGETLAYER 2734
+#define SCI_MARKERSETLAYER 2735
+#define SC_MAX_MARGIN 4
+#define SC_MARGIN_SYMBOL 0
+#define SC_MARGIN_NUMBER 1
+#define SC_MARGIN_BACK 2
+#define SC_MARGIN_FORE 3
+#define SC_MARGIN_TEXT 4
+#define SC_MARGIN_RTEXT 5
+#define SC_MARGIN_COLOUR 6
+#define SCI_SETMARGINTYPEN 2240
+#define SCI_GETMARGINTYPEN 2241
+#define SCI_SETMARGINWIDTHN 2242
+#define SCI_GETMARGINWIDTHN 2243
+#define SCI_SETMARGINMASKN 2244
+#define SCI_GETMARGINMASKN 2245
+#define SCI_SETMARGINSENSITIVEN 2246
+#define SCI_GETMARGINSENSITIVEN 2247
+#define SCI_SETMARGINCURSORN 2248
+#define SCI_GETMARGINCURSORN 2249
+#define SCI_SETMARGINBACKN 2250
+#define SCI_GETMARGINBACKN 2251
+#define SCI_SETMARGINS 2252
+#define SCI_GETMARGINS 2253
+#define STYLE_DEFAULT 32
+#define STYLE_LINENUMBER 33
+#define STYLE_BRACELIGHT 34
+#define STYLE_BRACEBAD 35
+#define STYLE_CONTROLCHAR 36
+#define STYLE_INDENTGUIDE 37
+#define STYLE_CALLTIP 38
+#define STYLE_FOLDDISPLAYTEXT 39
+#define STYLE_LASTPREDEFINED 39
+#define STYLE_MAX 255
+#define SC_CHARSET_ANSI 0
+#define SC_CHARSET_DEFAULT 1
+#define SC_CHARSET_BALTIC 186
+#define SC_CHARSET_CHINESEBIG5 136
+#define SC_CHARSET_EASTEUROPE 238
+#define SC_CHARSET_GB2312 134
+#define SC_CHARSET_GREEK 161
+#define SC_CHARSET_HANGUL 129
+#define SC_CHARSET_MAC 77
+#define SC_CHARSET_OEM 255
+#define SC_CHARSET_RUSSIAN 204
+#define SC_CHARSET_OEM866 866
+#define SC_CHARSET_CYRILLIC 1251
+#define SC_CHARSET_SHIFTJIS 128
+#define SC_CHARSET_SYMBOL 2
+#define SC_CHARSET_TURKISH 162
+#define SC_CHARSET_JOHAB 130
+#define SC_CHARSET_HEBREW 177
+#define SC_CHARSET_ARABIC 178
+#define SC_CHARSET_VIETNAMESE 163
+#define SC_CHARSET_THAI 222
+#define SC_CHARSET_8859_15 1000
+#define SCI_STYLECLEARALL 2050
+#define SCI_STYLESETFORE 2051
+#define SCI_STYLESETBACK 2052
+#define SCI_STYLESETBOLD 2053
+#define SCI_STYLESETITALIC 2054
+#define SCI_STYLESETSIZE 2055
+#define SCI_STYLESETFONT 2056
+#define SCI_STYLESETEOLFILLED 2057
+#define SCI_STYLERESETDEFAULT 2058
+#define SCI_STYLESETUNDERLINE 2059
+#define SC_CASE_MIXED 0
+#define SC_CASE_UPPER 1
+#define SC_CASE_LOWER 2
+#define SC_CASE_CAMEL 3
+#define SCI_STYLEGETFORE 2481
+#define SCI_STYLEGETBACK 2482
+#define SCI_STYLEGETBOLD 2483
+#define SCI_STYLEGETITALIC 2484
+#define SCI_STYLEGETSIZE 2485
+#define SCI_STYLEGETFONT 2486
+#define SCI_STYLEGETEOLFILLED 2487
+#define SCI_STYLEGETUNDERLINE 2488
+#define SCI_STYLEGETCASE 2489
+#define SCI_STYLEGETCHARACTERSET 2490
+#define SCI_STYLEGETVISIBLE 2491
+#define SCI_STYLEGETCHANGEABLE 2492
+#define SCI_STYLEGETHOTSPOT 2493
+#define SCI_STYLESETCASE 2060
+#define SC_FONT_SIZE_MULTIPLIER 100
+#define SCI_STYLESETSIZEFRACTIONAL 2061
+#define SCI_STYLEGETSIZEFRACTIONAL 2062
+#define SC_WEIGHT_NORMAL 400
+#define SC_WEIGHT_SEMIBOLD 600
+#define SC_WEIGHT_BOLD 700
+#define SCI_STYLESETWEIGHT 2063
+#define SCI_STYLEGETWEIGHT 2064
+#define SCI_STYLESETCHARACTERSET 2066
+#define SCI_STYLESETHOTSPOT 2409
+#define SCI_STYLESETCHECKMONOSPACED 2254
+#define SCI_STYLEGETCHECKMONOSPACED 2255
+#define SC_STRETCH_ULTRA_CONDENSED 1
+#define SC_STRETCH_EXTRA_CONDENSED 2
+#define SC_STRETCH_CONDENSED 3
+#define SC_STRETCH_SEMI_CONDENSED 4
+#define SC_STRETCH_NORMAL 5
+#define SC_STRETCH_SEMI_EXPANDED 6
+#define SC_STRETCH_EXPANDED 7
+#define SC_STRETCH_EXTRA_EXPANDED 8
+#define SC_STRETCH_ULTRA_EXPANDED 9
+#define SCI_STYLESETSTRETCH 2258
+#define SCI_STYLEGETSTRETCH 2259
+#define SCI_STYLESETINVISIBLEREPRESENTATION 2256
+#define SCI_STYLEGETINVISIBLEREPRESENTATION 2257
+#define SC_ELEMENT_LIST 0
+#define SC_ELEMENT_LIST_BACK 1
+#define SC_ELEMENT_LIST_SELECTED 2
+#define SC_ELEMENT_LIST_SELECTED_BACK 3
+#define SC_ELEMENT_SELECTION_TEXT 10
+#define SC_ELEMENT_SELECTION_BACK 11
+#define SC_ELEMENT_SELECTION_ADDITIONAL_TEXT 12
+#define SC_ELEMENT_SELECTION_ADDITIONAL_BACK 13
+#define SC_ELEMENT_SELECTION_SECONDARY_TEXT 14
+#define SC_ELEMENT_SELECTION_SECONDARY_BACK 15
+#define SC_ELEMENT_SELECTION_INACTIVE_TEXT 16
+#define SC_ELEMENT_SELECTION_INACTIVE_BACK 17
+#define SC_ELEMENT_SELECTION_INACTIVE_ADDITIONAL_TEXT 18
+#define SC_ELEMENT_SELECTION_INACTIVE_ADDITIONAL_BACK 19
+#define SC_ELEMENT_CARET 40
+#define SC_ELEMENT_CARET_ADDITIONAL 41
+#define SC_ELEMENT_CARET_LINE_BACK 50
+#define SC_ELEMENT_WHITE_SPACE 60
+#define SC_ELEMENT_WHITE_SPACE_BACK 61
+#define SC_ELEMENT_HOT_SPOT_ACTIVE 70
+#define SC_ELEMENT_HOT_SPOT_ACTIVE_BACK 71
+#define SC_ELEMENT_FOLD_LINE 80
+#define SC_ELEMENT_HIDDEN_LINE 81
+#define SCI_SETELEMENTCOLOUR 2753
+#define SCI_GETELEMENTCOLOUR 2754
+#define SCI_RESETELEMENTCOLOUR 2755
+#define SCI_GETELEMENTISSET 2756
+#define SCI_GETELEMENTALLOWSTRANSLUCENT 2757
+#define SCI_GETELEMENTBASECOLOUR 2758
+#define SCI_SETSELFORE 2067
+#define SCI_SETSELBACK 2068
+#define SCI_GETSELALPHA 2477
+#define SCI_SETSELALPHA 2478
+#define SCI_GETSELEOLFILLED 2479
+#define SCI_SETSELEOLFILLED 2480
+#define SC_LAYER_BASE 0
+#define SC_LAYER_UNDER_TEXT 1
+#define SC_LAYER_OVER_TEXT 2
+#define SCI_GETSELECTIONLAYER 2762
+#define SCI_SETSELECTIONLAYER 2763
+#define SCI_GETCARETLINELAYER 2764
+#define SCI_SETCARETLINELAYER 2765
+#define SCI_GETCARETLINEHIGHLIGHTSUBLINE 2773
+#define SCI_SETCARETLINEHIGHLIGHTSUBLINE 2774
+#define SCI_SETCARETFORE 2069
+#define SCI_ASSIGNCMDKEY 2070
+#define SCI_CLEARCMDKEY 2071
+#define SCI_CLEARALLCMDKEYS 2072
+#define SCI_SETSTYLINGEX 2073
+#define SCI_STYLESETVISIBLE 2074
+#define SCI_GETCARETPERIOD 2075
+#define SCI_SETCARETPERIOD 2076
+#define SCI_SETWORDCHARS 2077
+#define SCI_GETWORDCHARS 2646
+#define SCI_SETCHARACTERCATEGORYOPTIMIZATION 2720
+#define SCI_GETCHARACTERCATEGORYOPTIMIZATION 2721
+#define SCI_BEGINUNDOACTION 2078
+#define SCI_ENDUNDOACTION 2079
+#define SCI_GETUNDOSEQUENCE 2799
+#define SCI_BEGINBULKCHANGE 2835
+#define SCI_ENDBULKCHANGE 2836
+#define SCI_GETUNDOACTIONS 2790
+#define SCI_SETUNDOSAVEPOINT 2791
+#define SCI_GETUNDOSAVEPOINT 2792
+#define SCI_SETUNDODETACH 2793
+#define SCI_GETUNDODETACH 2794
+#define SCI_SETUNDOTENTATIVE 2795
+#define SCI_GETUNDOTENTATIVE 2796
+#define SCI_SETUNDOCURRENT 2797
+#define SCI_GETUNDOCURRENT 2798
+#define SCI_PUSHUNDOACTIONTYPE 2800
+#define SCI_CHANGELASTUNDOACTIONTEXT 2801
+#define SCI_GETUNDOACTIONTYPE 2802
+#define SCI_GETUNDOACTIONPOSITION 2803
+#define SCI_GETUNDOACTIONTEXT 2804
+#define SCI_SETUNDOMEMORYLIMIT 2829
+#define SCI_GETUNDOMEMORYLIMIT 2830
+#define SCI_SETUNDOSPILL 2831
+#define SCI_GETUNDOSPILL 2832
+#define SCI_GETUNDOMEMORY 2833
+#define INDIC_PLAIN 0
+#define INDIC_SQUIGGLE 1
+#define INDIC_TT 2
+#define INDIC_DIAGONAL 3
+#define INDIC_STRIKE 4
+#define INDIC_HIDDEN 5
+#define INDIC_BOX 6
+#define INDIC_ROUNDBOX 7
+#define INDIC_STRAIGHTBOX 8
+#define INDIC_DASH 9
+#define INDIC_DOTS 10
+#define INDIC_SQUIGGLELOW 11
+#define INDIC_DOTBOX 12
+#define INDIC_SQUIGGLEPIXMAP 13
+#define INDIC_COMPOSITIONTHICK 14
+#define INDIC_COMPOSITIONTHIN 15
+#define INDIC_FULLBOX 16
+#define INDIC_TEXTFORE 17
+#define INDIC_POINT 18
+#define INDIC_POINTCHARACTER 19
+#define INDIC_GRADIENT 20
+#define INDIC_GRADIENTCENTRE 21
+#define INDIC_POINT_TOP 22
+#define INDIC_CONTAINER 8
+#define INDIC_IME 32
+#define INDIC_IME_MAX 35
+#define INDIC_MAX 35
+#define INDICATOR_CONTAINER 8
+#define INDICATOR_IME 32
+#define INDICATOR_IME_MAX 35
+#define INDICATOR_HISTORY_REVERTED_TO_ORIGIN_INSERTION 36
+#define INDICATOR_HISTORY_REVERTED_TO_ORIGIN_DELETION 37
+#define INDICATOR_HISTORY_SAVED_INSERTION 38
+#define INDICATOR_HISTORY_SAVED_DELETION 39
+#define INDICATOR_HISTORY_MODIFIED_INSERTION 40
+#define INDICATOR_HISTORY_MODIFIED_DELETION 41
+#define INDICATOR_HISTORY_REVERTED_TO_MODIFIED_INSERTION 42
+#define INDICATOR_HISTORY_REVERTED_TO_MODIFIED_DELETION 43
+#define INDICATOR_MAX 43
+#define SCI_INDICSETSTYLE 2080
+#define SCI_INDICGETSTYLE 2081
+#define SCI_INDICSETFORE 2082
+#define SCI_INDICGETFORE 2083
+#define SCI_INDICSETUNDER 2510
+#define SCI_INDICGETUNDER 2511
+#define SCI_INDICSETHOVERSTYLE 2680
+#define SCI_INDICGETHOVERSTYLE 2681
+#define SCI_INDICSETHOVERFORE 2682
+#define SCI_INDICGETHOVERFORE 2683
+#define SC_INDICVALUEBIT 0x1000000
+#define SC_INDICVALUEMASK 0xFFFFFF
+#define SC_INDICFLAG_NONE 0
+#define SC_INDICFLAG_VALUEFORE 1
+#define SCI_INDICSETFLAGS 2684
+#define SCI_INDICGETFLAGS 2685
+#define SCI_INDICSETSTROKEWIDTH 2751
+#define SCI_INDICGETSTROKEWIDTH 2752
+#define SCI_SETWHITESPACEFORE 2084
+#define SCI_SETWHITESPACEBACK 2085
+#define SCI_SETWHITESPACESIZE 2086
+#define SCI_GETWHITESPACESIZE 2087
+#define SCI_SETLINESTATE 2092
+#define SCI_GETLINESTATE 2093
+#define SCI_GETMAXLINESTATE 2094
+#define SCI_GETCARETLINEVISIBLE 2095
+#define SCI_SETCARETLINEVISIBLE 2096
+#define SCI_GETCARETLINEBACK 2097
+#define SCI_SETCARETLINEBACK 2098
+#define SCI_GETCARETLINEFRAME 2704
+#define SCI_SETCARETLINEFRAME 2705
+#define SCI_STYLESETCHANGEABLE 2099
+#define SCI_AUTOCSHOW 2100
+#define SCI_AUTOCCANCEL 2101
+#define SCI_AUTOCACTIVE 2102
+#define SCI_AUTOCPOSSTART 2103
+#define SCI_AUTOCCOMPLETE 2104
+#define SCI_AUTOCSTOPS 2105
+#define SCI_AUTOCSETSEPARATOR 2106
+#define SCI_AUTOCGETSEPARATOR 2107
+#define SCI_AUTOCSELECT 2108
+#define SCI_AUTOCSETCANCELATSTART 2110
+#define SCI_AUTOCGETCANCELATSTART 2111
+#define SCI_AUTOCSETFILLUPS 2112
+#define SCI_AUTOCSETCHOOSESINGLE 2113
+#define SCI_AUTOCGETCHOOSESINGLE 2114
+#define SCI_AUTOCSETIGNORECASE 2115
+#define SCI_AUTOCGETIGNORECASE 2116
+#define SCI_USERLISTSHOW 2117
+#define SCI_AUTOCSETAUTOHIDE 2118
+#define SCI_AUTOCGETAUTOHIDE 2119
+#define SC_AUTOCOMPLETE_NORMAL 0
+#define SC_AUTOCOMPLETE_FIXED_SIZE 1
+#define SC_AUTOCOMPLETE_SELECT_FIRST_ITEM 2
+#define SC_AUTOCOMPLETE_FILTER 4
+#define SC_AUTOCOMPLETE_FILTER_SUBSEQUENCE 8
+#define SCI_AUTOCSETOPTIONS 2638
+#define SCI_AUTOCGETOPTIONS 2639
+#define SCI_AUTOCSETDROPRESTOFWORD 2270
+#define SCI_AUTOCGETDROPRESTOFWORD 2271
+#define SCI_REGISTERIMAGE 2405
+#define SCI_CLEARREGISTEREDIMAGES 2408
+#define SCI_AUTOCGETTYPESEPARATOR 2285
+#define SCI_AUTOCSETTYPESEPARATOR 2286
+#define SCI_AUTOCSETMAXWIDTH 2208
+#define SCI_AUTOCGETMAXWIDTH 2209
+#define SCI_AUTOCSETMAXHEIGHT 2210
+#define SCI_AUTOCGETMAXHEIGHT 2211
+#define SCI_AUTOCSETSTYLE 2109
+#define SCI_AUTOCGETSTYLE 2120
+#define SCI_AUTOCSETIMAGESCALE 2815
+#define SCI_AUTOCGETIMAGESCALE 2816
+#define SCI_SETINDENT 2122
+#define SCI_GETINDENT 2123
+#define SCI_SETUSETABS 2124
+#define SCI_GETUSETABS 2125
+#define SCI_SETLINEINDENTATION 2126
+#define SCI_GETLINEINDENTATION 2127
+#define SCI_GETLINEINDENTPOSITION 2128
+#define SCI_GETCOLUMN 2129
+#define SCI_COUNTCHARACTERS 2633
+#define SCI_COUNTCODEUNITS 2715
+#define SCI_SETHSCROLLBAR 2130
+#define SCI_GETHSCROLLBAR 2131
+#define SC_IV_NONE 0
+#define SC_IV_REAL 1
+#define SC_IV_LOOKFORWARD 2
+#define SC_IV_LOOKBOTH 3
+#define SCI_SETINDENTATIONGUIDES 2132
+#define SCI_GETINDENTATIONGUIDES 2133
+#define SCI_SETHIGHLIGHTGUIDE 2134
+#define SCI_GETHIGHLIGHTGUIDE 2135
+#define SCI_GETLINEENDPOSITION 2136
+#define SCI_GETCODEPAGE 2137
+#define SCI_GETCARETFORE 2138
+#define SCI_GETREADONLY 2140
+#define SCI_SETCURRENTPOS 2141
+#define SCI_SETSELECTIONSTART 2142
+#define SCI_GETSELECTIONSTART 2143
+#define SCI_SETSELECTIONEND 2144
+#define SCI_GETSELECTIONEND 2145
+#define SCI_SETEMPTYSELECTION 2556
+#define SCI_SETPRINTMAGNIFICATION 2146
+#define SCI_GETPRINTMAGNIFICATION 2147
+#define SC_PRINT_NORMAL 0
+#define SC_PRINT_INVERTLIGHT 1
+#define SC_PRINT_BLACKONWHITE 2
+#define SC_PRINT_COLOURONWHITE 3
+#define SC_PRINT_COLOURONWHITEDEFAULTBG 4
+#define SC_PRINT_SCREENCOLOURS 5
+#define SCI_SETPRINTCOLOURMODE 2148
+#define SCI_GETPRINTCOLOURMODE 2149
+#define SCFIND_NONE 0x0
+#define SCFIND_WHOLEWORD 0x2
+#define SCFIND_MATCHCASE 0x4
+#define SCFIND_WORDSTART 0x00100000
+#define SCFIND_REGEXP 0x00200000
+#define SCFIND_POSIX 0x00400000
+#define SCFIND_CXX11REGEX 0x00800000
+#define SCI_FINDTEXT 2150
+#define SCI_FINDTEXTFULL 2196
+#define SCI_FORMATRANGE 2151
+#define SCI_FORMATRANGEFULL 2777
+#define SC_CHANGE_HISTORY_DISABLED 0
+#define SC_CHANGE_HISTORY_ENABLED 1
+#define SC_CHANGE_HISTORY_MARKERS 2
+#define SC_CHANGE_HISTORY_INDICATORS 4
+#define SCI_SETCHANGEHISTORY 2780
+#define SCI_GETCHANGEHISTORY 2781
+#define SCI_GETCHANGEHISTORYMEMORY 2838
+#define SC_UNDO_SELECTION_HISTORY_DISABLED 0
+#define SC_UNDO_SELECTION_HISTORY_ENABLED 1
+#define SC_UNDO_SELECTION_HISTORY_SCROLL 2
+#define SCI_SETUNDOSELECTIONHISTORY 2782
+#define SCI_GETUNDOSELECTIONHISTORY 2783
+#define SCI_SETSELECTIONSERIALIZED 2784
+#define SCI_GETSELECTIONSERIALIZED 2785
+#define SCI_GETFIRSTVISIBLELINE 2152
+#define SCI_GETLINE 2153
+#define SCI_GETLINECOUNT 2154
+#define SCI_ALLOCATELINES 2089
+#define SCI_SETMARGINLEFT 2155
+#define SCI_GETMARGINLEFT 2156
+#define SCI_SETMARGINRIGHT 2157
+#define SCI_GETMARGINRIGHT 2158
+#define SCI_GETMODIFY 2159
+#define SCI_SETSEL 2160
+#define SCI_GETSELTEXT 2161
+#define SCI_GETTEXTRANGE 2162
+#define SCI_GETTEXTRANGEFULL 2039
+#define SCI_HIDESELECTION 2163
+#define SCI_GETSELECTIONHIDDEN 2088
+#define SCI_POINTXFROMPOSITION 2164
+#define SCI_POINTYFROMPOSITION 2165
+#define SCI_LINEFROMPOSITION 2166
+#define SCI_POSITIONFROMLINE 2167
+#define SCI_LINESCROLL 2168
+#define SCI_SCROLLVERTICAL 2817
+#define SCI_SCROLLCARET 2169
+#define SCI_SCROLLRANGE 2569
+#define SCI_REPLACESEL 2170
+#define SCI_SETREADONLY 2171
+#define SCI_NULL 2172
+#define SCI_CANPASTE 2173
+#define SCI_CANUNDO 2174
+#define SCI_EMPTYUNDOBUFFER 2175
+#define SCI_UNDO 2176
+#define SCI_CUT 2177
+#define SCI_COPY 2178
+#define SCI_PASTE 2179
+#define SCI_CLEAR 2180
+#define SCI_SETTEXT 2181
+#define SCI_GETTEXT 2182
+#define SCI_GETTEXTLENGTH 2183
+#define SCI_GETDIRECTFUNCTION 2184
+#define SCI_GETDIRECTSTATUSFUNCTION 2772
+#define SCI_GETDIRECTPOINTER 2185
+#define SCI_SETOVERTYPE 2186
+#define SCI_GETOVERTYPE 2187
+#define SCI_SETCARETWIDTH 2188
+#define SCI_GETCARETWIDTH 2189
+#define SCI_SETTARGETSTART 2190
+#define SCI_GETTARGETSTART 2191
+#define SCI_SETTARGETSTARTVIRTUALSPACE 2728
+#define SCI_GETTARGETSTARTVIRTUALSPACE 2729
+#define SCI_SETTARGETEND 2192
+#define SCI_GETTARGETEND 2193
+#define SCI_SETTARGETENDVIRTUALSPACE 2730
+#define SCI_GETTARGETENDVIRTUALSPACE 2731
+#define SCI_SETTARGETRANGE 2686
+#define SCI_GETTARGETTEXT 2687
+#define SCI_TARGETFROMSELECTION 2287
+#define SCI_TARGETWHOLEDOCUMENT 2690
+#define SCI_REPLACETARGET 2194
+#define SCI_REPLACETARGETRE 2195
+#define SCI_REPLACETARGETMINIMAL 2779
+#define SCI_SEARCHINTARGET 2197
+#define SCI_SETSEARCHFLAGS 2198
+#define SCI_GETSEARCHFLAGS 2199
+#define SCI_CALLTIPSHOW 2200
+#define SCI_CALLTIPCANCEL 2201
+#define SCI_CALLTIPACTIVE 2202
+#define SCI_CALLTIPPOSSTART 2203
+#define SCI_CALLTIPSETPOSSTART 2214
+#define SCI_CALLTIPSETHLT 2204
+#define SCI_CALLTIPSETBACK 2205
+#define SCI_CALLTIPSETFORE 2206
+#define SCI_CALLTIPSETFOREHLT 2207
+#define SCI_CALLTIPUSESTYLE 2212
+#define SCI_CALLTIPSETPOSITION 2213
+#define SCI_VISIBLEFROMDOCLINE 2220
+#define SCI_DOCLINEFROMVISIBLE 2221
+#define SCI_WRAPCOUNT 2235
+#define SC_FOLDLEVELNONE 0x0
+#define SC_FOLDLEVELBASE 0x400
+#define SC_FOLDLEVELWHITEFLAG 0x1000
+#define SC_FOLDLEVELHEADERFLAG 0x2000
+#define SC_FOLDLEVELNUMBERMASK 0x0FFF
+#define SCI_SETFOLDLEVEL 2222
+#define SCI_GETFOLDLEVEL 2223
+#define SCI_GETLASTCHILD 2224
+#define SCI_GETFOLDPARENT 2225
+#define SCI_SHOWLINES 2226
+#define SCI_HIDELINES 2227
+#define SCI_GETLINEVISIBLE 2228
+#define SCI_GETALLLINESVISIBLE 2236
+#define SCI_SETFOLDEXPANDED 2229
+#define SCI_GETFOLDEXPANDED 2230
+#define SCI_TOGGLEFOLD 2231
+#define SCI_TOGGLEFOLDSHOWTEXT 2700
+#define SC_FOLDDISPLAYTEXT_HIDDEN 0
+#define SC_FOLDDISPLAYTEXT_STANDARD 1
+#define SC_FOLDDISPLAYTEXT_BOXED 2
+#define SCI_FOLDDISPLAYTEXTSETSTYLE 2701
+#define SCI_FOLDDISPLAYTEXTGETSTYLE 2707
+#define SCI_SETDEFAULTFOLDDISPLAYTEXT 2722
+#define SCI_GETDEFAULTFOLDDISPLAYTEXT 2723
+#define SC_FOLDACTION_CONTRACT 0
+#define SC_FOLDACTION_EXPAND 1
+#define SC_FOLDACTION_TOGGLE 2
+#define SC_FOLDACTION_CONTRACT_EVERY_LEVEL 4
+#define SCI_FOLDLINE 2237
+#define SCI_FOLDCHILDREN 2238
+#define SCI_EXPANDCHILDREN 2239
+#define SCI_FOLDALL 2662
+#define SCI_FOLDALLTODEPTH 2827
+#define SCI_SETCONTRACTEDFOLDS 2828
+#define SCI_ENSUREVISIBLE 2232
+#define SC_AUTOMATICFOLD_NONE 0x0000
+#define SC_AUTOMATICFOLD_SHOW 0x0001
+#define SC_AUTOMATICFOLD_CLICK 0x0002
+#define SC_AUTOMATICFOLD_CHANGE 0x0004
+#define SCI_SETAUTOMATICFOLD 2663
+#define SCI_GETAUTOMATICFOLD 2664
+#define SC_FOLDFLAG_NONE 0x0000
+#define SC_FOLDFLAG_LINEBEFORE_EXPANDED 0x0002
+#define SC_FOLDFLAG_LINEBEFORE_CONTRACTED 0x0004
+#define SC_FOLDFLAG_LINEAFTER_EXPANDED 0x0008
+#define SC_FOLDFLAG_LINEAFTER_CONTRACTED 0x0010
+#define SC_FOLDFLAG_LEVELNUMBERS 0x0040
+#define SC_FOLDFLAG_LINESTATE 0x0080
+#define SCI_SETFOLDFLAGS 2233
+#define SCI_ENSUREVISIBLEENFORCEPOLICY 2234
+#define SCI_SETTABINDENTS 2260
+#define SCI_GETTABINDENTS 2261
+#define SCI_SETBACKSPACEUNINDENTS 2262
+#define SCI_GETBACKSPACEUNINDENTS 2263
+#define SC_TIME_FOREVER 10000000
+#define SCI_SETMOUSEDWELLTIME 2264
+#define SCI_GETMOUSEDWELLTIME 2265
+#define SCI_WORDSTARTPOSITION 2266
+#define SCI_WORDENDPOSITION 2267
+#define SCI_ISRANGEWORD 2691
+#define SC_IDLESTYLING_NONE 0
+#define SC_IDLESTYLING_TOVISIBLE 1
+#define SC_IDLESTYLING_AFTERVISIBLE 2
+#define SC_IDLESTYLING_ALL 3
+#define SCI_SETIDLESTYLING 2692
+#define SCI_GETIDLESTYLING 2693
+#define SC_WRAP_NONE 0
+#define SC_WRAP_WORD 1
+#define SC_WRAP_CHAR 2
+#define SC_WRAP_WHITESPACE 3
+#define SCI_SETWRAPMODE 2268
+#define SCI_GETWRAPMODE 2269
+#define SC_WRAPVISUALFLAG_NONE 0x0000
+#define SC_WRAPVISUALFLAG_END 0x0001
+#define SC_WRAPVISUALFLAG_START 0x0002
+#define SC_WRAPVISUALFLAG_MARGIN 0x0004
+#define SCI_SETWRAPVISUALFLAGS 2460
+#define SCI_GETWRAPVISUALFLAGS 2461
+#define SC_WRAPVISUALFLAGLOC_DEFAULT 0x0000
+#define SC_WRAPVISUALFLAGLOC_END_BY_TEXT 0x0001
+#define SC_WRAPVISUALFLAGLOC_START_BY_TEXT 0x0002
+#define SCI_SETWRAPVISUALFLAGSLOCATION 2462
+#define SCI_GETWRAPVISUALFLAGSLOCATION 2463
+#define SCI_SETWRAPSTARTINDENT 2464
+#define SCI_GETWRAPSTARTINDENT 2465
+#define SC_WRAPINDENT_FIXED 0
+#define SC_WRAPINDENT_SAME 1
+#define SC_WRAPINDENT_INDENT 2
+#define SC_WRAPINDENT_DEEPINDENT 3
+#define SCI_SETWRAPINDENTMODE 2472
+#define SCI_GETWRAPINDENTMODE 2473
+#define SCI_SETWRAPESTIMATE 2825
+#define SCI_GETWRAPESTIMATE 2826
+#define SC_CACHE_NONE 0
+#define SC_CACHE_CARET 1
+#define SC_CACHE_PAGE 2
+#define SC_CACHE_DOCUMENT 3
+#define SCI_SETLAYOUTCACHE 2272
+#define SCI_GETLAYOUTCACHE 2273
+#define SCI_SETSCROLLWIDTH 2274
+#define SCI_GETSCROLLWIDTH 2275
+#define SCI_SETSCROLLWIDTHTRACKING 2516
+#define SCI_GETSCROLLWIDTHTRACKING 2517
+#define SCI_TEXTWIDTH 2276
+#define SCI_SETENDATLASTLINE 2277
+#define SCI_GETENDATLASTLINE 2278
+#define SCI_TEXTHEIGHT 2279
+#define SCI_SETVSCROLLBAR 2280
+#define SCI_GETVSCROLLBAR 2281
+#define SCI_APPENDTEXT 2282
+#define SC_PHASES_ONE 0
+#define SC_PHASES_TWO 1
+#define SC_PHASES_MULTIPLE 2
+#define SCI_GETPHASESDRAW 2673
+#define SCI_SETPHASESDRAW 2674
+#define SC_EFF_QUALITY_MASK 0xF
+#define SC_EFF_QUALITY_DEFAULT 0
+#define SC_EFF_QUALITY_NON_ANTIALIASED 1
+#define SC_EFF_QUALITY_ANTIALIASED 2
+#define SC_EFF_QUALITY_LCD_OPTIMIZED 3
+#define SCI_SETFONTQUALITY 2611
+#define SCI_GETFONTQUALITY 2612
+#define SCI_SETFIRSTVISIBLELINE 2613
+#define SC_MULTIPASTE_ONCE 0
+#define SC_MULTIPASTE_EACH 1
+#define SCI_SETMULTIPASTE 2614
+#define SCI_GETMULTIPASTE 2615
+#define SCI_GETTAG 2616
+#define SCI_LINESJOIN 2288
+#define SCI_LINESSPLIT 2289
+#define SCI_SETFOLDMARGINCOLOUR 2290
+#define SCI_SETFOLDMARGINHICOLOUR 2291
+#define SC_ACCESSIBILITY_DISABLED 0
+#define SC_ACCESSIBILITY_ENABLED 1
+#define SCI_SETACCESSIBILITY 2702
+#define SCI_GETACCESSIBILITY 2703
+#define SCI_LINEDOWN 2300
+#define SCI_LINEDOWNEXTEND 2301
+#define SCI_LINEUP 2302
+#define SCI_LINEUPEXTEND 2303
+#define SCI_CHARLEFT 2304
+#define SCI_CHARLEFTEXTEND 2305
+#define SCI_CHARRIGHT 2306
+#define SCI_CHARRIGHTEXTEND 2307
+#define SCI_WORDLEFT 2308
+#define SCI_WORDLEFTEXTEND 2309
+#define SCI_WORDRIGHT 2310
+#define SCI_WORDRIGHTEXTEND 2311
+#define SCI_HOME 2312
+#define SCI_HOMEEXTEND 2313
+#define SCI_LINEEND 2314
+#define SCI_LINEENDEXTEND 2315
+#define SCI_DOCUMENTSTART 2316
+#define SCI_DOCUMENTSTARTEXTEND 2317
+#define SCI_DOCUMENTEND 2318
+#define SCI_DOCUMENTENDEXTEND 2319
+#define SCI_PAGEUP 2320
+#define SCI_PAGEUPEXTEND 2321
+#define SCI_PAGEDOWN 2322
+#define SCI_PAGEDOWNEXTEND 2323
+#define SCI_EDITTOGGLEOVERTYPE 2324
+#define SCI_CANCEL 2325
+#define SCI_DELETEBACK 2326
+#define SCI_TAB 2327
+#define SCI_LINEINDENT 2813
+#define SCI_BACKTAB 2328
+#define SCI_LINEDEDENT 2814
+#define SCI_NEWLINE 2329
+#define SCI_FORMFEED 2330
+#define SCI_VCHOME 2331
+#define SCI_VCHOMEEXTEND 2332
+#define SCI_ZOOMIN 2333
+#define SCI_ZOOMOUT 2334
+#define SCI_DELWORDLEFT 2335
+#define SCI_DELWORDRIGHT 2336
+#define SCI_DELWORDRIGHTEND 2518
+#define SCI_LINECUT 2337
+#define SCI_LINEDELETE 2338
+#define SCI_LINETRANSPOSE 2339
+#define SCI_LINEREVERSE 2354
+#define SCI_LINEDUPLICATE 2404
+#define SCI_LOWERCASE 2340
+#define SCI_UPPERCASE 2341
+#define SCI_LINESCROLLDOWN 2342
+#define SCI_LINESCROLLUP 2343
+#define SCI_DELETEBACKNOTLINE 2344
+#define SCI_HOMEDISPLAY 2345
+#define SCI_HOMEDISPLAYEXTEND 2346
+#define SCI_LINEENDDISPLAY 2347
+#define SCI_LINEENDDISPLAYEXTEND 2348
+#define SCI_HOMEWRAP 2349
+#define SCI_HOMEWRAPEXTEND 2450
+#define SCI_LINEENDWRAP 2451
+#define SCI_LINEENDWRAPEXTEND 2452
+#define SCI_VCHOMEWRAP 2453
+#define SCI_VCHOMEWRAPEXTEND 2454
+#define SCI_LINECOPY 2455
+#define SCI_MOVECARETINSIDEVIEW 2401
+#define SCI_LINELENGTH 2350
+#define SCI_BRACEHIGHLIGHT 2351
+#define SCI_BRACEHIGHLIGHTINDICATOR 2498
+#define SCI_BRACEBADLIGHT 2352
+#define SCI_BRACEBADLIGHTINDICATOR 2499
+#define SCI_BRACEMATCH 2353
+#define SCI_BRACEMATCHNEXT 2369
+#define SCI_GETVIEWEOL 2355
+#define SCI_SETVIEWEOL 2356
+#define SCI_GETDOCPOINTER 2357
+#define SCI_SETDOCPOINTER 2358
+#define SCI_SETMODEVENTMASK 2359
+#define EDGE_NONE 0
+#define EDGE_LINE 1
+#define EDGE_BACKGROUND 2
+#define EDGE_MULTILINE 3
+#define SCI_GETEDGECOLUMN 2360
+#define SCI_SETEDGECOLUMN 2361
+#define SCI_GETEDGEMODE 2362
+#define SCI_SETEDGEMODE 2363
+#define SCI_GETEDGECOLOUR 2364
+#define SCI_SETEDGECOLOUR 2365
+#define SCI_MULTIEDGEADDLINE 2694
+#define SCI_MULTIEDGECLEARALL 2695
+#define SCI_GETMULTIEDGECOLUMN 2749
+#define SCI_SEARCHANCHOR 2366
+#define SCI_SEARCHNEXT 2367
+#define SCI_SEARCHPREV 2368
+#define SCI_LINESONSCREEN 2370
+#define SC_POPUP_NEVER 0
+#define SC_POPUP_ALL 1
+#define SC_POPUP_TEXT 2
+#define SCI_USEPOPUP 2371
+#define SCI_SELECTIONISRECTANGLE 2372
+#define SCI_SETZOOM 2373
+#define SCI_GETZOOM 2374
+#define SC_DOCUMENTOPTION_DEFAULT 0
+#define SC_DOCUMENTOPTION_STYLES_NONE 0x1
+#define SC_DOCUMENTOPTION_TEXT_LARGE 0x100
+#define SC_DOCUMENTOPTION_LINES_TREE 0x200
+#define SCI_CREATEDOCUMENT 2375
+#define SCI_ADDREFDOCUMENT 2376
+#define SCI_RELEASEDOCUMENT 2377
+#define SCI_HIBERNATEDOCUMENT 2839
+#define SCI_GETDOCUMENTOPTIONS 2379
+#define SCI_GETMODEVENTMASK 2378
+#define SCI_SETCOMMANDEVENTS 2717
+#define SCI_GETCOMMANDEVENTS 2718
+#define SCI_SETFOCUS 2380
+#define SCI_GETFOCUS 2381
+#define SC_STATUS_OK 0
+#define SC_STATUS_FAILURE 1
+#define SC_STATUS_BADALLOC 2
+#define SC_STATUS_WARN_START 1000
+#define SC_STATUS_WARN_REGEX 1001
+#define SCI_SETSTATUS 2382
+#define SCI_GETSTATUS 2383
+#define SCI_SETMOUSEDOWNCAPTURES 2384
+#define SCI_GETMOUSEDOWNCAPTURES 2385
+#define SCI_SETMOUSEWHEELCAPTURES 2696
+#define SCI_GETMOUSEWHEELCAPTURES 2697
+#define SCI_SETCURSOR 2386
+#define SCI_GETCURSOR 2387
+#define SCI_SETCONTROLCHARSYMBOL 2388
+#define SCI_GETCONTROLCHARSYMBOL 2389
+#define SCI_WORDPARTLEFT 2390
+#define SCI_WORDPARTLEFTEXTEND 2391
+#define SCI_WORDPARTRIGHT 2392
+#define SCI_WORDPARTRIGHTEXTEND 2393
+#define VISIBLE_SLOP 0x01
+#define VISIBLE_STRICT 0x04
+#define SCI_SETVISIBLEPOLICY 2394
+#define SCI_DELLINELEFT 2395
+#define SCI_DELLINERIGHT 2396
+#define SCI_SETXOFFSET 2397
+#define SCI_GETXOFFSET 2398
+#define SCI_CHOOSECARETX 2399
+#define SCI_GRABFOCUS 2400
+#define CARET_SLOP 0x01
+#define CARET_STRICT 0x04
+#define CARET_JUMPS 0x10
+#define CARET_EVEN 0x08
+#define SCI_SETXCARETPOLICY 2402
+#define SCI_SETYCARETPOLICY 2403
+#define SCI_SETPRINTWRAPMODE 2406
+#define SCI_GETPRINTWRAPMODE 2407
+#define SCI_SETHOTSPOTACTIVEFORE 2410
+#define SCI_GETHOTSPOTACTIVEFORE 2494
+#define SCI_SETHOTSPOTACTIVEBACK 2411
+#define SCI_GETHOTSPOTACTIVEBACK 2495
+#define SCI_SETHOTSPOTACTIVEUNDERLINE 2412
+#define SCI_GETHOTSPOTACTIVEUNDERLINE 2496
+#define SCI_SETHOTSPOTSINGLELINE 2421
+#define SCI_GETHOTSPOTSINGLELINE 2497
+#define SCI_PARADOWN 2413
+#define SCI_PARADOWNEXTEND 2414
+#define SCI_PARAUP 2415
+#define SCI_PARAUPEXTEND 2416
+#define SCI_POSITIONBEFORE 2417
+#define SCI_POSITIONAFTER 2418
+#define SCI_POSITIONRELATIVE 2670
+#define SCI_POSITIONRELATIVECODEUNITS 2716
+#define SCI_COPYRANGE 2419
+#define SCI_COPYTEXT 2420
+#define SC_SEL_STREAM 0
+#define SC_SEL_RECTANGLE 1
+#define SC_SEL_LINES 2
+#define SC_SEL_THIN 3
+#define SCI_SETSELECTIONMODE 2422
+#define SCI_CHANGESELECTIONMODE 2659
+#define SCI_GETSELECTIONMODE 2423
+#define SCI_SETMOVEEXTENDSSELECTION 2719
+#define SCI_GETMOVEEXTENDSSELECTION 2706
+#define SCI_GETLINESELSTARTPOSITION 2424
+#define SCI_GETLINESELENDPOSITION 2425
+#define SCI_LINEDOWNRECTEXTEND 2426
+#define SCI_LINEUPRECTEXTEND 2427
+#define SCI_CHARLEFTRECTEXTEND 2428
+#define SCI_CHARRIGHTRECTEXTEND 2429
+#define SCI_HOMERECTEXTEND 2430
+#define SCI_VCHOMERECTEXTEND 2431
+#define SCI_LINEENDRECTEXTEND 2432
+#define SCI_PAGEUPRECTEXTEND 2433
+#define SCI_PAGEDOWNRECTEXTEND 2434
+#define SCI_STUTTEREDPAGEUP 2435
+#define SCI_STUTTEREDPAGEUPEXTEND 2436
+#define SCI_STUTTEREDPAGEDOWN 2437
+#define SCI_STUTTEREDPAGEDOWNEXTEND 2438
+#define SCI_WORDLEFTEND 2439
+#define SCI_WORDLEFTENDEXTEND 2440
+#define SCI_WORDRIGHTEND 2441
+#define SCI_WORDRIGHTENDEXTEND 2442
+#define SCI_SETWHITESPACECHARS 2443
+#define SCI_GETWHITESPACECHARS 2647
+#define SCI_SETPUNCTUATIONCHARS 2648
+#define SCI_GETPUNCTUATIONCHARS 2649
+#define SCI_SETCHARSDEFAULT 2444
+#define SCI_AUTOCGETCURRENT 2445
+#define SCI_AUTOCGETCURRENTTEXT 2610
+#define SC_CASEINSENSITIVEBEHAVIOUR_RESPECTCASE 0
+#define SC_CASEINSENSITIVEBEHAVIOUR_IGNORECASE 1
+#define SCI_AUTOCSETCASEINSENSITIVEBEHAVIOUR 2634
+#define SCI_AUTOCGETCASEINSENSITIVEBEHAVIOUR 2635
+#define SC_MULTIAUTOC_ONCE 0
+#define SC_MULTIAUTOC_EACH 1
+#define SCI_AUTOCSETMULTI 2636
+#define SCI_AUTOCGETMULTI 2637
+#define SC_ORDER_PRESORTED 0
+#define SC_ORDER_PERFORMSORT 1
+#define SC_ORDER_CUSTOM 2
+#define SCI_AUTOCSETORDER 2660
+#define SCI_AUTOCGETORDER 2661
+#define SCI_ALLOCATE 2446
+#define SCI_TARGETASUTF8 2447
+#define SCI_SETLENGTHFORENCODE 2448
+#define SCI_ENCODEDFROMUTF8 2449
+#define SCI_FINDCOLUMN 2456
+#define SC_CARETSTICKY_OFF 0
+#define SC_CARETSTICKY_ON 1
+#define SC_CARETSTICKY_WHITESPACE 2
+#define SCI_GETCARETSTICKY 2457
+#define SCI_SETCARETSTICKY 2458
+#define SCI_TOGGLECARETSTICKY 2459
+#define SCI_SETPASTECONVERTENDINGS 2467
+#define SCI_GETPASTECONVERTENDINGS 2468
+#define SCI_REPLACERECTANGULAR 2771
+#define SCI_SELECTIONDUPLICATE 2469
+#define SCI_SETCARETLINEBACKALPHA 2470
+#define SCI_GETCARETLINEBACKALPHA 2471
+#define CARETSTYLE_INVISIBLE 0
+#define CARETSTYLE_LINE 1
+#define CARETSTYLE_BLOCK 2
+#define CARETSTYLE_OVERSTRIKE_BAR 0
+#define CARETSTYLE_OVERSTRIKE_BLOCK 0x10
+#define CARETSTYLE_CURSES 0x20
+#define CARETSTYLE_INS_MASK 0xF
+#define CARETSTYLE_BLOCK_AFTER 0x100
+#define SCI_SETCARETSTYLE 2512
+#define SCI_GETCARETSTYLE 2513
+#define SCI_SETINDICATORCURRENT 2500
+#define SCI_GETINDICATORCURRENT 2501
+#define SCI_SETINDICATORVALUE 2502
+#define SCI_GETINDICATORVALUE 2503
+#define SCI_INDICATORFILLRANGE 2504
+#define SCI_INDICATORCLEARRANGE 2505
+#define SCI_INDICATORFILLRANGES 2834
+#define SCI_INDICATORALLONFOR 2506
+#define SCI_INDICATORVALUEAT 2507
+#define SCI_INDICATORSTART 2508
+#define SCI_INDICATOREND 2509
+#define SCI_SETPOSITIONCACHE 2514
+#define SCI_GETPOSITIONCACHE 2515
+#define SCI_SETLAYOUTTHREADS 2775
+#define SCI_GETLAYOUTTHREADS 2776
+#define SCI_SETPAINTTHREADS 2818
+#define SCI_GETPAINTTHREADS 2819
+#define SC_PROFILE_FRAME 0
+#define SC_PROFILE_STYLE 1
+#define SC_PROFILE_WRAP 2
+#define SC_PROFILE_LAYOUT 3
+#define SC_PROFILE_MARGIN 4
+#define SC_PROFILE_PHASE_BACK 5
+#define SC_PROFILE_PHASE_INDICATORS_BACK 6
+#define SC_PROFILE_PHASE_TEXT 7
+#define SC_PROFILE_PHASE_INDENTATION_GUIDES 8
+#define SC_PROFILE_PHASE_INDICATORS_FORE 9
+#define SC_PROFILE_PHASE_SELECTION_TRANSLUCENT 10
+#define SC_PROFILE_PHASE_LINE_TRANSLUCENT 11
+#define SC_PROFILE_PHASE_FOLD_LINES 12
+#define SC_PROFILE_PHASE_CARETS 13
+#define SC_PROFILE_LINES 14
+#define SC_PROFILE_POSITION_CACHE_HITS 15
+#define SC_PROFILE_POSITION_CACHE_MISSES 16
+#define SCI_SETPROFILESIZE 2820
+#define SCI_GETPROFILESIZE 2821
+#define SCI_GETPROFILEFRAMECOUNT 2822
+#define SCI_GETPROFILEVALUE 2823
+#define SCI_CLEARPROFILE 2824
+#define SCI_COPYALLOWLINE 2519
+#define SCI_CUTALLOWLINE 2810
+#define SCI_SETCOPYSEPARATOR 2811
+#define SCI_GETCOPYSEPARATOR 2812
+#define SCI_GETCHARACTERPOINTER 2520
+#define SCI_GETRANGEPOINTER 2643
+#define SCI_GETGAPPOSITION 2644
+#define SCI_INDICSETALPHA 2523
+#define SCI_INDICGETALPHA 2524
+#define SCI_INDICSETOUTLINEALPHA 2558
+#define SCI_INDICGETOUTLINEALPHA 2559
+#define SCI_SETEXTRAASCENT 2525
+#define SCI_GETEXTRAASCENT 2526
+#define SCI_SETEXTRADESCENT 2527
+#define SCI_GETEXTRADESCENT 2528
+#define SCI_MARKERSYMBOLDEFINED 2529
+#define SCI_MARGINSETTEXT 2530
+#define SCI_MARGINGETTEXT 2531
+#define SCI_MARGINSETSTYLE 2532
+#define SCI_MARGINGETSTYLE 2533
+#define SCI_MARGINSETSTYLES 2534
+#define SCI_MARGINGETSTYLES 2535
+#define SCI_MARGINTEXTCLEARALL 2536
+#define SCI_MARGINSETSTYLEOFFSET 2537
+#define SCI_MARGINGETSTYLEOFFSET 2538
+#define SC_MARGINOPTION_NONE 0
+#define SC_MARGINOPTION_SUBLINESELECT 1
+#define SCI_SETMARGINOPTIONS 2539
+#define SCI_GETMARGINOPTIONS 2557
+#define SCI_ANNOTATIONSETTEXT 2540
+#define SCI_ANNOTATIONGETTEXT 2541
+#define SCI_ANNOTATIONSETSTYLE 2542
+#define SCI_ANNOTATIONGETSTYLE 2543
+#define SCI_ANNOTATIONSETSTYLES 2544
+#define SCI_ANNOTATIONGETSTYLES 2545
+#define SCI_ANNOTATIONGETLINES 2546
+#define SCI_ANNOTATIONCLEARALL 2547
+#define ANNOTATION_HIDDEN 0
+#define ANNOTATION_STANDARD 1
+#define ANNOTATION_BOXED 2
+#define ANNOTATION_INDENTED 3
+#define SCI_ANNOTATIONSETVISIBLE 2548
+#define SCI_ANNOTATIONGETVISIBLE 2549
+#define SCI_ANNOTATIONSETSTYLEOFFSET 2550
+#define SCI_ANNOTATIONGETSTYLEOFFSET 2551
+#define SCI_RELEASEALLEXTENDEDSTYLES 2552
+#define SCI_ALLOCATEEXTENDEDSTYLES 2553
+#define UNDO_NONE 0
+#define UNDO_MAY_COALESCE 1
+#define SCI_ADDUNDOACTION 2560
+#define SCI_CHARPOSITIONFROMPOINT 2561
+#define SCI_CHARPOSITIONFROMPOINTCLOSE 2562
+#define SCI_SETMOUSESELECTIONRECTANGULARSWITCH 2668
+#define SCI_GETMOUSESELECTIONRECTANGULARSWITCH 2669
+#define SCI_SETMULTIPLESELECTION 2563
+#define SCI_GETMULTIPLESELECTION 2564
+#define SCI_SETADDITIONALSELECTIONTYPING 2565
+#define SCI_GETADDITIONALSELECTIONTYPING 2566
+#define SCI_SETADDITIONALCARETSBLINK 2567
+#define SCI_GETADDITIONALCARETSBLINK 2568
+#define SCI_SETADDITIONALCARETSVISIBLE 2608
+#define SCI_GETADDITIONALCARETSVISIBLE 2609
+#define SCI_GETSELECTIONS 2570
+#define SCI_GETSELECTIONEMPTY 2650
+#define SCI_CLEARSELECTIONS 2571
+#define SCI_SETSELECTION 2572
+#define SCI_ADDSELECTION 2573
+#define SCI_SELECTIONFROMPOINT 2474
+#define SCI_DROPSELECTIONN 2671
+#define SCI_SETMAINSELECTION 2574
+#define SCI_GETMAINSELECTION 2575
+#define SCI_SETSELECTIONNCARET 2576
+#define SCI_GETSELECTIONNCARET 2577
+#define SCI_SETSELECTIONNANCHOR 2578
+#define SCI_GETSELECTIONNANCHOR 2579
+#define SCI_SETSELECTIONNCARETVIRTUALSPACE 2580
+#define SCI_GETSELECTIONNCARETVIRTUALSPACE 2581
+#define SCI_SETSELECTIONNANCHORVIRTUALSPACE 2582
+#define SCI_GETSELECTIONNANCHORVIRTUALSPACE 2583
+#define SCI_SETSELECTIONNSTART 2584
+#define SCI_GETSELECTIONNSTART 2585
+#define SCI_GETSELECTIONNSTARTVIRTUALSPACE 2726
+#define SCI_SETSELECTIONNEND 2586
+#define SCI_GETSELECTIONNENDVIRTUALSPACE 2727
+#define SCI_GETSELECTIONNEND 2587
+#define SCI_SETRECTANGULARSELECTIONCARET 2588
+#define SCI_GETRECTANGULARSELECTIONCARET 2589
+#define SCI_SETRECTANGULARSELECTIONANCHOR 2590
+#define SCI_GETRECTANGULARSELECTIONANCHOR 2591
+#define SCI_SETRECTANGULARSELECTIONCARETVIRTUALSPACE 2592
+#define SCI_GETRECTANGULARSELECTIONCARETVIRTUALSPACE 2593
+#define SCI_SETRECTANGULARSELECTIONANCHORVIRTUALSPACE 2594
+#define SCI_GETRECTANGULARSELECTIONANCHORVIRTUALSPACE 2595
+#define SCVS_NONE 0
+#define SCVS_RECTANGULARSELECTION 1
+#define SCVS_USERACCESSIBLE 2
+#define SCVS_NOWRAPLINESTART 4
+#define SCI_SETVIRTUALSPACEOPTIONS 2596
+#define SCI_GETVIRTUALSPACEOPTIONS 2597
+#define SCI_SETRECTANGULARSELECTIONMODIFIER 2598
+#define SCI_GETRECTANGULARSELECTIONMODIFIER 2599
+#define SCI_SETADDITIONALSELFORE 2600
+#define SCI_SETADDITIONALSELBACK 2601
+#define SCI_SETADDITIONALSELALPHA 2602
+#define SCI_GETADDITIONALSELALPHA 2603
+#define SCI_SETADDITIONALCARETFORE 2604
+#define SCI_GETADDITIONALCARETFORE 2605
+#define SCI_ROTATESELECTION 2606
+#define SCI_SWAPMAINANCHORCARET 2607
+#define SCI_MULTIPLESELECTADDNEXT 2688
+#define SCI_MULTIPLESELECTADDEACH 2689
+#define SCI_CHANGELEXERSTATE 2617
+#define SCI_CONTRACTEDFOLDNEXT 2618
+#define SCI_VERTICALCENTRECARET 2619
+#define SCI_MOVESELECTEDLINESUP 2620
+#define SCI_MOVESELECTEDLINESDOWN 2621
+#define SCI_SETIDENTIFIER 2622
+#define SCI_GETIDENTIFIER 2623
+#define SCI_RGBAIMAGESETWIDTH 2624
+#define SCI_RGBAIMAGESETHEIGHT 2625
+#define SCI_RGBAIMAGESETSCALE 2651
+#define SCI_MARKERDEFINERGBAIMAGE 2626
+#define SCI_REGISTERRGBAIMAGE 2627
+#define SCI_SCROLLTOSTART 2628
+#define SCI_SCROLLTOEND 2629
+#define SC_TECHNOLOGY_DEFAULT 0
+#define SC_TECHNOLOGY_DIRECTWRITE 1
+#define SC_TECHNOLOGY_DIRECTWRITERETAIN 2
+#define SC_TECHNOLOGY_DIRECTWRITEDC 3
+#define SC_TECHNOLOGY_DIRECT_WRITE_1 4
+#define SCI_SETTECHNOLOGY 2630
+#define SCI_GETTECHNOLOGY 2631
+#define SCI_CREATELOADER 2632
+#define SCI_CREATESNAPSHOT 2837
+#define SCI_FINDINDICATORSHOW 2640
+#define SCI_FINDINDICATORFLASH 2641
+#define SCI_FINDINDICATORHIDE 2642
+#define SCI_VCHOMEDISPLAY 2652
+#define SCI_VCHOMEDISPLAYEXTEND 2653
+#define SCI_GETCARETLINEVISIBLEALWAYS 2654
+#define SCI_SETCARETLINEVISIBLEALWAYS 2655
+#define SC_LINE_END_TYPE_DEFAULT 0
+#define SC_LINE_END_TYPE_UNICODE 1
+#define SCI_SETLINEENDTYPESALLOWED 2656
+#define SCI_GETLINEENDTYPESALLOWED 2657
+#define SCI_GETLINEENDTYPESACTIVE 2658
+#define SCI_SETREPRESENTATION 2665
+#define SCI_GETREPRESENTATION 2666
+#define SCI_CLEARREPRESENTATION 2667
+#define SCI_CLEARALLREPRESENTATIONS 2770
+#define SC_REPRESENTATION_PLAIN 0
+#define SC_REPRESENTATION_BLOB 1
+#define SC_REPRESENTATION_COLOUR 0x10
+#define SCI_SETREPRESENTATIONAPPEARANCE 2766
+#define SCI_GETREPRESENTATIONAPPEARANCE 2767
+#define SCI_SETREPRESENTATIONCOLOUR 2768
+#define SCI_GETREPRESENTATIONCOLOUR 2769
+#define SCI_EOLANNOTATIONSETTEXT 2740
+#define SCI_EOLANNOTATIONGETTEXT 2741
+#define SCI_EOLANNOTATIONSETSTYLE 2742
+#define SCI_EOLANNOTATIONGETSTYLE 2743
+#define SCI_EOLANNOTATIONCLEARALL 2744
+#define EOLANNOTATION_HIDDEN 0x0
+#define EOLANNOTATION_STANDARD 0x1
+#define EOLANNOTATION_BOXED 0x2
+#define EOLANNOTATION_STADIUM 0x100
+#define EOLANNOTATION_FLAT_CIRCLE 0x101
+#define EOLANNOTATION_ANGLE_CIRCLE 0x102
+#define EOLANNOTATION_CIRCLE_FLAT 0x110
+#define EOLANNOTATION_FLATS 0x111
+#define EOLANNOTATION_ANGLE_FLAT 0x112
+#define EOLANNOTATION_CIRCLE_ANGLE 0x120
+#define EOLANNOTATION_FLAT_ANGLE 0x121
+#define EOLANNOTATION_ANGLES 0x122
+#define SCI_EOLANNOTATIONSETVISIBLE 2745
+#define SCI_EOLANNOTATIONGETVISIBLE 2746
+#define SCI_EOLANNOTATIONSETSTYLEOFFSET 2747
+#define SCI_EOLANNOTATIONGETSTYLEOFFSET 2748
+#define SC_SUPPORTS_LINE_DRAWS_FINAL 0
+#define SC_SUPPORTS_PIXEL_DIVISIONS 1
+#define SC_SUPPORTS_FRACTIONAL_STROKE_WIDTH 2
+#define SC_SUPPORTS_TRANSLUCENT_STROKE 3
+#define SC_SUPPORTS_PIXEL_MODIFICATION 4
+#define SC_SUPPORTS_THREAD_SAFE_MEASURE_WIDTHS 5
+#define SC_SUPPORTS_THREAD_SAFE_IMAGE_SURFACES 6
+#define SCI_SUPPORTSFEATURE 2750
+#define SC_LINECHARACTERINDEX_NONE 0
+#define SC_LINECHARACTERINDEX_UTF32 1
+#define SC_LINECHARACTERINDEX_UTF16 2
+#define SCI_GETLINECHARACTERINDEX 2710
+#define SCI_ALLOCATELINECHARACTERINDEX 2711
+#define SCI_RELEASELINECHARACTERINDEX 2712
+#define SCI_LINEFROMINDEXPOSITION 2713
+#define SCI_INDEXPOSITIONFROMLINE 2714
+#define SCI_STARTRECORD 3001
+#define SCI_STOPRECORD 3002
+#define SCI_GETLEXER 4002
+#define SCI_COLOURISE 4003
+#define SCI_SETPROPERTY 4004
+#define KEYWORDSET_MAX 8
+#define SCI_SETKEYWORDS 4005
+#define SCI_GETPROPERTY 4008
+#define SCI_GETPROPERTYEXPANDED 4009
+#define SCI_GETPROPERTYINT 4010
+#define SCI_GETLEXERLANGUAGE 4012
+#define SCI_PRIVATELEXERCALL 4013
+#define SCI_PROPERTYNAMES 4014
+#define SC_TYPE_BOOLEAN 0
+#define SC_TYPE_INTEGER 1
+#define SC_TYPE_STRING 2
+#define SCI_PROPERTYTYPE 4015
+#define SCI_DESCRIBEPROPERTY 4016
+#define SCI_DESCRIBEKEYWORDSETS 4017
+#define SCI_GETLINEENDTYPESSUPPORTED 4018
+#define SCI_ALLOCATESUBSTYLES 4020
+#define SCI_GETSUBSTYLESSTART 4021
+#define SCI_GETSUBSTYLESLENGTH 4022
+#define SCI_GETSTYLEFROMSUBSTYLE 4027
+#define SCI_GETPRIMARYSTYLEFROMSTYLE 4028
+#define SCI_FREESUBSTYLES 4023
+#define SCI_SETIDENTIFIERS 4024
+#define SCI_DISTANCETOSECONDARYSTYLES 4025
+#define SCI_GETSUBSTYLEBASES 4026
+#define SCI_GETNAMEDSTYLES 4029
+#define SCI_NAMEOFSTYLE 4030
+#define SCI_TAGSOFSTYLE 4031
+#define SCI_DESCRIPTIONOFSTYLE 4032
+#define SCI_SETILEXER 4033
+#define SC_MOD_NONE 0x0
+#define SC_MOD_INSERTTEXT 0x1
+#define SC_MOD_DELETETEXT 0x2
+#define SC_MOD_CHANGESTYLE 0x4
+#define SC_MOD_CHANGEFOLD 0x8
+#define SC_PERFORMED_USER 0x10
+#define SC_PERFORMED_UNDO 0x20
+#define SC_PERFORMED_REDO 0x40
+#define SC_MULTISTEPUNDOREDO 0x80
+#define SC_LASTSTEPINUNDOREDO 0x100
+#define SC_MOD_CHANGEMARKER 0x200
+#define SC_MOD_BEFOREINSERT 0x400
+#define SC_MOD_BEFOREDELETE 0x800
+#define SC_MULTILINEUNDOREDO 0x1000
+#define SC_STARTACTION 0x2000
+#define SC_MOD_CHANGEINDICATOR 0x4000
+#define SC_MOD_CHANGELINESTATE 0x8000
+#define SC_MOD_CHANGEMARGIN 0x10000
+#define SC_MOD_CHANGEANNOTATION 0x20000
+#define SC_MOD_CONTAINER 0x40000
+#define SC_MOD_LEXERSTATE 0x80000
+#define SC_MOD_INSERTCHECK 0x100000
+#define SC_MOD_CHANGETABSTOPS 0x200000
+#define SC_MOD_CHANGEEOLANNOTATION 0x400000
+#define SC_MOD_BULKCHANGE 0x800000
+#define SC_MODEVENTMASKALL 0x7FFFFF
+#define SC_UPDATE_NONE 0x0
+#define SC_UPDATE_CONTENT 0x1
+#define SC_UPDATE_SELECTION 0x2
+#define SC_UPDATE_V_SCROLL 0x4
+#define SC_UPDATE_H_SCROLL 0x8
+#define SCEN_CHANGE 768
+#define SCEN_SETFOCUS 512
+#define SCEN_KILLFOCUS 256
+#define SCK_DOWN 300
+#define SCK_UP 301
+#define SCK_LEFT 302
+#define SCK_RIGHT 303
+#define SCK_HOME 304
+#define SCK_END 305
+#define SCK_PRIOR 306
+#define SCK_NEXT 307
+#define SCK_DELETE 308
+#define SCK_INSERT 309
+#define SCK_ESCAPE 7
+#define SCK_BACK 8
+#define SCK_TAB 9
+#define SCK_RETURN 13
+#define SCK_ADD 310
+#define SCK_SUBTRACT 311
+#define SCK_DIVIDE 312
+#define SCK_WIN 313
+#define SCK_RWIN 314
+#define SCK_MENU 315
+#define SCMOD_NORM 0
+#define SCMOD_SHIFT 1
+#define SCMOD_CTRL 2
+#define SCMOD_ALT 4
+#define SCMOD_SUPER 8
+#define SCMOD_META 16
+#define SC_AC_FILLUP 1
+#define SC_AC_DOUBLECLICK 2
+#define SC_AC_TAB 3
+#define SC_AC_NEWLINE 4
+#define SC_AC_COMMAND 5
+#define SC_AC_SINGLE_CHOICE 6
+#define SC_CHARACTERSOURCE_DIRECT_INPUT 0
+#define SC_CHARACTERSOURCE_TENTATIVE_INPUT 1
+#define SC_CHARACTERSOURCE_IME_RESULT 2
+#define SCN_STYLENEEDED 2000
+#define SCN_CHARADDED 2001
+#define SCN_SAVEPOINTREACHED 2002
+#define SCN_SAVEPOINTLEFT 2003
+#define SCN_MODIFYATTEMPTRO 2004
+#define SCN_KEY 2005
+#define SCN_DOUBLECLICK 2006
+#define SCN_UPDATEUI 2007
+#define SCN_MODIFIED 2008
+#define SCN_MACRORECORD 2009
+#define SCN_MARGINCLICK 2010
+#define SCN_NEEDSHOWN 2011
+#define SCN_PAINTED 2013
+#define SCN_USERLISTSELECTION 2014
+#define SCN_URIDROPPED 2015
+#define SCN_DWELLSTART 2016
+#define SCN_DWELLEND 2017
+#define SCN_ZOOM 2018
+#define SCN_HOTSPOTCLICK 2019
+#define SCN_HOTSPOTDOUBLECLICK 2020
+#define SCN_CALLTIPCLICK 2021
+#define SCN_AUTOCSELECTION 2022
+#define SCN_INDICATORCLICK 2023
+#define SCN_INDICATORRELEASE 2024
+#define SCN_AUTOCCANCELLED 2025
+#define SCN_AUTOCCHARDELETED 2026
+#define SCN_HOTSPOTRELEASECLICK 2027
+#define SCN_FOCUSIN 2028
+#define SCN_FOCUSOUT 2029
+#define SCN_AUTOCCOMPLETED 2030
+#define SCN_MARGINRIGHTCLICK 2031
+#define SCN_AUTOCSELECTIONCHANGE 2032
+#ifndef SCI_DISABLE_PROVISIONAL
+#define SC_BIDIRECTIONAL_DISABLED 0
+#define SC_BIDIRECTIONAL_L2R 1
+#define SC_BIDIRECTIONAL_R2L 2
+#define SCI_GETBIDIRECTIONAL 2708
+#define SCI_SETBIDIRECTIONAL 2709
+#endif
+/* --Autogenerated -- end of section automatically generated from Scintilla.iface */
+
+#endif
+
+/* These structures are defined to be exactly the same shape as the Win32
+ * CHARRANGE, TEXTRANGE, FINDTEXTEX, FORMATRANGE, and NMHDR structs.
+ * So older code that treats Scintilla as a RichEdit will work. */
+
+struct Sci_CharacterRange {
+	Sci_PositionCR cpMin;
+	Sci_PositionCR cpMax;
+};
+
+struct Sci_CharacterRangeFull {
+	Sci_Position cpMin;
+	Sci_Position cpMax;
+};
+
+struct Sci_TextRange {
+	struct Sci_CharacterRange chrg;
+	char *lpstrText;
+};
+
+struct Sci_TextRangeFull {
+	struct Sci_CharacterRangeFull chrg;
+	char *lpstrText;
+};
+
+struct Sci_TextToFind {
+	struct Sci_CharacterRange chrg;
+	const char *lpstrText;
+	struct Sci_CharacterRange chrgText;
+};
+
+struct Sci_TextToFindFull {
+	struct Sci_CharacterRangeFull chrg;
+	const char *lpstrText;
+	struct Sci_CharacterRangeFull chrgText;
+};
+
+struct Sci_IndicatorRange {
+	Sci_Position position;
+	Sci_Position length;
+	int value;
+};
+
+typedef void *Sci_SurfaceID;
+
+struct Sci_Rectangle {
+	int left;
+	int top;
+	int right;
+	int bottom;
+};
+
+/* This structure is used in printing and requires some of the graphics types
+ * from Platform.h.  Not needed by most client code. */
+
+struct Sci_RangeToFormat {
+	Sci_SurfaceID hdc;
+	Sci_SurfaceID hdcTarget;
+	struct Sci_Rectangle rc;
+	struct Sci_Rectangle rcPage;
+	struct Sci_CharacterRange chrg;
+};
+
+struct Sci_RangeToFormatFull {
+	Sci_SurfaceID hdc;
+	Sci_SurfaceID hdcTarget;
+	struct Sci_Rectangle rc;
+	struct Sci_Rectangle rcPage;
+	struct Sci_CharacterRangeFull chrg;
+};
+
+#ifndef __cplusplus
+/* For the GTK+ platform, g-ir-scanner needs to have these typedefs. This
+ * is not required in C++ code and has caused problems in the past. */
+typedef struct Sci_NotifyHeader Sci_NotifyHeader;
+typedef struct SCNotification SCNotification;
+#endif
+
+struct Sci_NotifyHeader {
+	/* Compatible with Windows NMHDR.
+	 * hwndFrom is really an environment specific window handle or pointer
+	 * but most clients of Scintilla.h do not have this type visible. */
+	void *hwndFrom;
+	uptr_t idFrom;
+	unsigned int code;
+};
+
+struct SCNotification {
+	Sci_NotifyHeader nmhdr;
+	Sci_Position position;
+	/* SCN_STYLENEEDED, SCN_DOUBLECLICK, SCN_MODIFIED, SCN_MARGINCLICK, */
+	/* SCN_MARGINRIGHTCLICK, SCN_NEEDSHOWN, SCN_DWELLSTART, SCN_DWELLEND, */
+	/* SCN_CALLTIPCLICK, */
+	/* SCN_HOTSPOTCLICK, SCN_HOTSPOTDOUBLECLICK, SCN_HOTSPOTRELEASECLICK, */
+	/* SCN_INDICATORCLICK, SCN_INDICATORRELEASE, */
+	/* SCN_USERLISTSELECTION, SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, */
+	/* SCN_AUTOCSELECTIONCHANGE */
+
+	int ch;
+	/* SCN_CHARADDED, SCN_KEY, SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, */
+	/* SCN_USERLISTSELECTION */
+	int modifiers;
+	/* SCN_KEY, SCN_DOUBLECLICK, SCN_HOTSPOTCLICK, SCN_HOTSPOTDOUBLECLICK, */
+	/* SCN_HOTSPOTRELEASECLICK, SCN_INDICATORCLICK, SCN_INDICATORRELEASE, */
+	/* SCN_MARGINCLICK, SCN_MARGINRIGHTCLICK */
+
+	int modificationType;	/* SCN_MODIFIED */
+	const char *text;
+	/* SCN_MODIFIED, SCN_USERLISTSELECTION, SCN_URIDROPPED, */
+	/* SCN_AUTOCCOMPLETED, SCN_AUTOCSELECTION, SCN_AUTOCSELECTIONCHANGE */
+
+	Sci_Position length;		/* SCN_MODIFIED */
+	Sci_Position linesAdded;	/* SCN_MODIFIED */
+	int message;	/* SCN_MACRORECORD */
+	uptr_t wParam;	/* SCN_MACRORECORD */
+	sptr_t lParam;	/* SCN_MACRORECORD */
+	Sci_Position line;		/* SCN_MODIFIED */
+	int foldLevelNow;	/* SCN_MODIFIED */
+	int foldLevelPrev;	/* SCN_MODIFIED */
+	int margin;		/* SCN_MARGINCLICK, SCN_MARGINRIGHTCLICK */
+	int listType;	/* SCN_USERLISTSELECTION, SCN_AUTOCSELECTIONCHANGE */
+	int x;			/* SCN_DWELLSTART, SCN_DWELLEND */
+	int y;		/* SCN_DWELLSTART, SCN_DWELLEND */
+	int token;		/* SCN_MODIFIED with SC_MOD_CONTAINER */
+	Sci_Position annotationLinesAdded;	/* SCN_MODIFIED with SC_MOD_CHANGEANNOTATION */
+	int updated;	/* SCN_UPDATEUI */
+	int listCompletionMethod;
+	/* SCN_AUTOCSELECTION, SCN_AUTOCCOMPLETED, SCN_USERLISTSELECTION */
+	int characterSource;	/* SCN_CHARADDED */
+};
+
+#ifdef INCLUDE_DEPRECATED_FEATURES
+
+#define SCI_SETKEYSUNICODE 2521
+#define SCI_GETKEYSUNICODE 2522
+
+#define SCI_GETTWOPHASEDRAW 2283
+#define SCI_SETTWOPHASEDRAW 2284
+
+#define CharacterRange Sci_CharacterRange
+#define TextRange Sci_TextRange
+#define TextToFind Sci_TextToFind
+#define RangeToFormat Sci_RangeToFormat
+#define NotifyHeader Sci_NotifyHeader
+
+#define SCI_SETSTYLEBITS 2090
+#define SCI_GETSTYLEBITS 2091
+#define SCI_GETSTYLEBITSNEEDED 4011
+
+#define INDIC0_MASK 0x20
+#define INDIC1_MASK 0x40
+#define INDIC2_MASK 0x80
+#define INDICS_MASK 0xE0
+
+#endif
+
+#endif
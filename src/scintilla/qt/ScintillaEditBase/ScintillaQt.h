@@ -63,6 +63,7 @@
 #include "EditModel.h"
 #include "MarginView.h"
 #include "EditView.h"
+#include "WrapPending.h"
 #include "Editor.h"
 #include "ScintillaBase.h"
 #include "CaseConvert.h"
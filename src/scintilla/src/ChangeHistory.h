@@ -1,124 +1,174 @@
-// Scintilla source code edit control
-/** @file ChangeHistory.h
- ** Manages a history of changes in a document.
- **/
-// Copyright 2022 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef CHANGEHISTORY_H
-#define CHANGEHISTORY_H
-
-namespace Scintilla::Internal {
-
-constexpr int changeOriginal = 0;
-constexpr int changeRevertedOriginal = 1;
-constexpr int changeSaved = 2;
-constexpr int changeModified = 3;
-constexpr int changeRevertedToChange = 4;
-
-// As bit flags
-constexpr unsigned int bitRevertedToOriginal = 1;
-constexpr unsigned int bitSaved = 2;
-constexpr unsigned int bitModified = 4;
-constexpr unsigned int bitRevertedToModified = 8;
-
-struct ChangeSpan {
-	Sci::Position start;
-	Sci::Position length;
-	int edition;
-	int count;
-	enum class Direction { insertion, deletion } direction;
-};
-
-struct EditionCount {
-	int edition;
-	int count;
-	// Used in tests.
-	constexpr bool operator==(const EditionCount &other) const noexcept {
-		return (edition == other.edition) && (count == other.count);
-	}
-};
-
-// EditionSet is ordered from oldest to newest, its not really a set
-using EditionSet = std::vector<EditionCount>;
-using EditionSetOwned = std::unique_ptr<EditionSet>;
-
-class ChangeStack {
-	std::vector<int> steps;
-	std::vector<ChangeSpan> changes;
-public:
-	void Clear() noexcept;
-	void AddStep();
-	void PushDeletion(Sci::Position positionDeletion, const EditionCount &ec);
-	void PushInsertion(Sci::Position positionInsertion, Sci::Position length, int edition);
-	[[nodiscard]] int PopStep() noexcept;
-	[[nodiscard]] ChangeSpan PopSpan(int maxSteps) noexcept;
-	void SetSavePoint() noexcept;
-	void Check() const noexcept;
-};
-
-struct ChangeLog {
-	ChangeStack changeStack;
-	RunStyles<Sci::Position, int> insertEdition;
-	SparseVector<EditionSetOwned> deleteEdition;
-
-	void Clear(Sci::Position length);
-	void InsertSpace(Sci::Position position, Sci::Position insertLength);
-	void DeleteRange(Sci::Position position, Sci::Position deleteLength);
-	void Insert(Sci::Position start, Sci::Position length, int edition);
-	void CollapseRange(Sci::Position position, Sci::Position deleteLength);
-	void PushDeletionAt(Sci::Position position, EditionCount ec);
-	void InsertFrontDeletionAt(Sci::Position position, EditionCount ec);
-	void SaveRange(Sci::Position position, Sci::Position length);
-	void PopDeletion(Sci::Position position, Sci::Position deleteLength);
-	void SaveHistoryForDelete(Sci::Position position, Sci::Position deleteLength);
-	void DeleteRangeSavingHistory(Sci::Position position, Sci::Position deleteLength);
-	void SetSavePoint();
-
-	Sci::Position Length() const noexcept;
-	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
-	void Check() const noexcept;
-};
-
-enum class ReversionState { clear, reverting, detached };
-
-class ChangeHistory {
-	ChangeLog changeLog;
-	std::unique_ptr<ChangeLog> changeLogReversions;
-	int historicEpoch = -1;
-
-public:
-	ChangeHistory(Sci::Position length=0);
-
-	void Insert(Sci::Position position, Sci::Position insertLength, bool collectingUndo, bool beforeSave);
-	void DeleteRange(Sci::Position position, Sci::Position deleteLength, bool reverting);
-	void DeleteRangeSavingHistory(Sci::Position position, Sci::Position deleteLength, bool beforeSave, bool isDetached);
-
-	void StartReversion();
-	void EndReversion() noexcept;
-
-	void SetSavePoint();
-
-	void UndoDeleteStep(Sci::Position position, Sci::Position deleteLength, bool isDetached);
-
-	[[nodiscard]] Sci::Position Length() const noexcept;
-
-	// Setting up history before this session
-	void SetEpoch(int epoch) noexcept;
-	void EditionCreateHistory(Sci::Position start, Sci::Position length);
-
-	// Queries for drawing
-	[[nodiscard]] int EditionAt(Sci::Position pos) const noexcept;
-	[[nodiscard]] Sci::Position EditionEndRun(Sci::Position pos) const noexcept;
-	[[nodiscard]] unsigned int EditionDeletesAt(Sci::Position pos) const noexcept;
-	[[nodiscard]] Sci::Position EditionNextDelete(Sci::Position pos) const noexcept;
-
-	// Testing - not used by Scintilla
-	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
-	EditionSet DeletionsAt(Sci::Position pos) const;
-	void Check() noexcept;
-};
-
-}
-
-#endif
+// Scintilla source code edit control
+/** @file ChangeHistory.h
+ ** Manages a history of changes in a document.
+ **/
+// Copyright 2022 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef CHANGEHISTORY_H
+#define CHANGEHISTORY_H
+
+namespace Scintilla::Internal {
+
+constexpr int changeOriginal = 0;
+constexpr int changeRevertedOriginal = 1;
+constexpr int changeSaved = 2;
+constexpr int changeModified = 3;
+constexpr int changeRevertedToChange = 4;
+
+// As bit flags
+constexpr unsigned int bitRevertedToOriginal = 1;
+constexpr unsigned int bitSaved = 2;
+constexpr unsigned int bitModified = 4;
+constexpr unsigned int bitRevertedToModified = 8;
+
+struct ChangeSpan {
+	Sci::Position start;
+	Sci::Position length;
+	int edition;
+	int count;
+	enum class Direction { insertion, deletion } direction;
+};
+
+struct EditionCount {
+	int edition;
+	int count;
+	// Used in tests.
+	constexpr bool operator==(const EditionCount &other) const noexcept {
+		return (edition == other.edition) && (count == other.count);
+	}
+};
+
+// EditionSet is ordered from oldest to newest, its not really a set
+using EditionSet = std::vector<EditionCount>;
+
+// Compact storage for the EditionSet held at each position with deletions.
+// Almost all positions have a single edition so that is held inline instead of
+// allocating a std::vector. Only sets of 2 or more editions are allocated.
+class EditionSetCompact {
+	EditionCount single {};	// count is 0 when empty and unused when editions allocated
+	std::unique_ptr<EditionSet> editions;
+public:
+	EditionSetCompact() noexcept = default;
+	EditionSetCompact(EditionSetCompact &&other) noexcept;
+	EditionSetCompact &operator=(EditionSetCompact &&other) noexcept;
+	// Deleted so EditionSetCompact objects can not be copied.
+	EditionSetCompact(const EditionSetCompact &) = delete;
+	EditionSetCompact &operator=(const EditionSetCompact &) = delete;
+	~EditionSetCompact() = default;
+
+	bool operator==(const EditionSetCompact &other) const noexcept;
+	bool operator!=(const EditionSetCompact &other) const noexcept {
+		return !(*this == other);
+	}
+
+	[[nodiscard]] bool empty() const noexcept {
+		return !editions && (single.count == 0);
+	}
+	[[nodiscard]] size_t size() const noexcept {
+		return editions ? editions->size() : (single.count ? 1 : 0);
+	}
+	const EditionCount *begin() const noexcept {
+		return editions ? editions->data() : &single;
+	}
+	const EditionCount *end() const noexcept {
+		return begin() + size();
+	}
+	EditionCount *begin() noexcept {
+		return editions ? editions->data() : &single;
+	}
+	EditionCount *end() noexcept {
+		return begin() + size();
+	}
+
+	// Push and Pop manipulate the count of the last item when it matches.
+	void Push(EditionCount ec);
+	void Pop() noexcept;
+	void InsertFront(EditionCount ec);
+	[[nodiscard]] size_t AllocatedBytes() const noexcept;
+	[[nodiscard]] EditionSet AsSet() const;
+};
+
+class ChangeStack {
+	std::vector<int> steps;
+	std::vector<ChangeSpan> changes;
+public:
+	void Clear() noexcept;
+	void AddStep();
+	void PushDeletion(Sci::Position positionDeletion, const EditionCount &ec);
+	void PushInsertion(Sci::Position positionInsertion, Sci::Position length, int edition);
+	[[nodiscard]] int PopStep() noexcept;
+	[[nodiscard]] ChangeSpan PopSpan(int maxSteps) noexcept;
+	void SetSavePoint() noexcept;
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+	void Check() const noexcept;
+};
+
+struct ChangeLog {
+	ChangeStack changeStack;
+	RunStyles<Sci::Position, int> insertEdition;
+	SparseVector<EditionSetCompact> deleteEdition;
+
+	void Clear(Sci::Position length);
+	void InsertSpace(Sci::Position position, Sci::Position insertLength);
+	void DeleteRange(Sci::Position position, Sci::Position deleteLength);
+	void Insert(Sci::Position start, Sci::Position length, int edition);
+	void CollapseRange(Sci::Position position, Sci::Position deleteLength);
+	void PushDeletionAt(Sci::Position position, EditionCount ec);
+	void InsertFrontDeletionAt(Sci::Position position, EditionCount ec);
+	void SaveRange(Sci::Position position, Sci::Position length);
+	void PopDeletion(Sci::Position position, Sci::Position deleteLength);
+	void SaveHistoryForDelete(Sci::Position position, Sci::Position deleteLength);
+	void DeleteRangeSavingHistory(Sci::Position position, Sci::Position deleteLength);
+	void SetSavePoint();
+
+	Sci::Position Length() const noexcept;
+	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+	void Check() const noexcept;
+};
+
+enum class ReversionState { clear, reverting, detached };
+
+class ChangeHistory {
+	ChangeLog changeLog;
+	std::unique_ptr<ChangeLog> changeLogReversions;
+	int historicEpoch = -1;
+
+public:
+	ChangeHistory(Sci::Position length=0);
+
+	void Insert(Sci::Position position, Sci::Position insertLength, bool collectingUndo, bool beforeSave);
+	void DeleteRange(Sci::Position position, Sci::Position deleteLength, bool reverting);
+	void DeleteRangeSavingHistory(Sci::Position position, Sci::Position deleteLength, bool beforeSave, bool isDetached);
+
+	void StartReversion();
+	void EndReversion() noexcept;
+
+	void SetSavePoint();
+
+	void UndoDeleteStep(Sci::Position position, Sci::Position deleteLength, bool isDetached);
+
+	[[nodiscard]] Sci::Position Length() const noexcept;
+
+	// Setting up history before this session
+	void SetEpoch(int epoch) noexcept;
+	void EditionCreateHistory(Sci::Position start, Sci::Position length);
+
+	// Queries for drawing
+	[[nodiscard]] int EditionAt(Sci::Position pos) const noexcept;
+	[[nodiscard]] Sci::Position EditionEndRun(Sci::Position pos) const noexcept;
+	[[nodiscard]] unsigned int EditionDeletesAt(Sci::Position pos) const noexcept;
+	[[nodiscard]] Sci::Position EditionNextDelete(Sci::Position pos) const noexcept;
+
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+
+	// Testing - not used by Scintilla
+	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
+	EditionSet DeletionsAt(Sci::Position pos) const;
+	void Check() noexcept;
+};
+
+}
+
+#endif
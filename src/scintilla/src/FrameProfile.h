@@ -0,0 +1,109 @@
+// Scintilla source code edit control
+/** @file FrameProfile.h
+ ** Record how long each part of painting takes over a number of frames.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef FRAMEPROFILE_H
+#define FRAMEPROFILE_H
+
+namespace Scintilla::Internal {
+
+/**
+ * Measurements for the frame being painted are accumulated then committed into a ring
+ * buffer of frames once painting finishes.
+ * Measurements may be added from layout and painting threads so are atomic.
+ */
+class FrameProfile {
+public:
+	static constexpr size_t measures = static_cast<size_t>(Scintilla::ProfileMeasure::PositionCacheMisses) + 1;
+	// Larger profiles are refused as they are more likely to be mistakes than useful.
+	static constexpr size_t maxFrames = 100000;
+private:
+	using Frame = std::array<int, measures>;
+	std::vector<Frame> frames;
+	size_t next = 0;
+	size_t count = 0;
+	std::array<std::atomic<int64_t>, measures> current {};
+public:
+	explicit FrameProfile(size_t size) : frames(size) {
+	}
+
+	void Add(Scintilla::ProfileMeasure measure, int64_t value) noexcept {
+		current[static_cast<size_t>(measure)].fetch_add(value, std::memory_order_relaxed);
+	}
+
+	// Durations are measured in seconds and stored in microseconds.
+	void AddDuration(Scintilla::ProfileMeasure measure, double duration) noexcept {
+		Add(measure, static_cast<int64_t>(duration * 1.0e6));
+	}
+
+	void Commit() noexcept {
+		if (frames.empty()) {
+			return;
+		}
+		for (size_t measure = 0; measure < measures; measure++) {
+			const int64_t value = current[measure].exchange(0, std::memory_order_relaxed);
+			frames[next][measure] = static_cast<int>(std::min<int64_t>(value, INT_MAX));
+		}
+		next = (next + 1) % frames.size();
+		count = std::min(count + 1, frames.size());
+	}
+
+	void Clear() noexcept {
+		next = 0;
+		count = 0;
+		for (std::atomic<int64_t> &value : current) {
+			value.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	[[nodiscard]] size_t Size() const noexcept {
+		return frames.size();
+	}
+
+	[[nodiscard]] size_t Count() const noexcept {
+		return count;
+	}
+
+	// Frame 0 is the most recently committed.
+	[[nodiscard]] int Value(size_t frame, Scintilla::ProfileMeasure measure) const noexcept {
+		const size_t index = static_cast<size_t>(measure);
+		if ((frame >= count) || (index >= measures)) {
+			return 0;
+		}
+		const size_t slot = (next + frames.size() - 1 - frame) % frames.size();
+		return frames[slot][index];
+	}
+};
+
+/**
+ * Add the time taken by a scope to a measure when there is a profile.
+ */
+class ProfileTimer {
+	FrameProfile *profile;
+	Scintilla::ProfileMeasure measure;
+	std::optional<ElapsedPeriod> period;
+public:
+	ProfileTimer(FrameProfile *profile_, Scintilla::ProfileMeasure measure_) noexcept :
+		profile(profile_), measure(measure_) {
+		if (profile) {
+			period.emplace();
+		}
+	}
+	// Deleted so ProfileTimer objects can not be copied.
+	ProfileTimer(const ProfileTimer &) = delete;
+	ProfileTimer(ProfileTimer &&) = delete;
+	void operator=(const ProfileTimer &) = delete;
+	void operator=(ProfileTimer &&) = delete;
+	~ProfileTimer() {
+		if (profile) {
+			profile->AddDuration(measure, period->Duration());
+		}
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+// Scintilla source code edit control
+/** @file PaintBands.h
+ ** Divide the visible lines into bands that can be painted on separate threads.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef PAINTBANDS_H
+#define PAINTBANDS_H
+
+namespace Scintilla::Internal {
+
+// A run of consecutive screen lines [start, end) painted into one pixmap.
+struct BandRange {
+	size_t start;
+	size_t end;
+};
+
+/**
+ * Split screen lines into about threads bands of similar size.
+ * Every screen line is placed in exactly one band, in order, so the bands tile the painted area.
+ * All the sub-lines of a wrapped document line go into the same band as they share a LineLayout.
+ * ScreenLine is any type with a lineDoc member.
+ */
+template <typename ScreenLine>
+std::vector<BandRange> PartitionBands(const std::vector<ScreenLine> &lines, size_t threads) {
+	std::vector<BandRange> bands;
+	if (lines.empty()) {
+		return bands;
+	}
+	threads = std::clamp<size_t>(threads, 1, lines.size());
+	const size_t linesPerBand = (lines.size() + threads - 1) / threads;
+	size_t startBand = 0;
+	while (startBand < lines.size()) {
+		size_t endBand = std::min(startBand + linesPerBand, lines.size());
+		while ((endBand < lines.size()) && (lines[endBand].lineDoc == lines[endBand - 1].lineDoc)) {
+			endBand++;
+		}
+		bands.push_back({ startBand, endBand });
+		startBand = endBand;
+	}
+	return bands;
+}
+
+}
+
+#endif
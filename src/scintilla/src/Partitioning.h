@@ -1,237 +1,607 @@
-// Scintilla source code edit control
-/** @file Partitioning.h
- ** Data structure used to partition an interval. Used for holding line start/end positions.
- **/
-// Copyright 1998-2007 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef PARTITIONING_H
-#define PARTITIONING_H
-
-namespace Scintilla::Internal {
-
-/// Divide an interval into multiple partitions.
-/// Useful for breaking a document down into sections such as lines.
-/// A 0 length interval has a single 0 length partition, numbered 0
-/// If interval not 0 length then each partition non-zero length
-/// When needed, positions after the interval are considered part of the last partition
-/// but the end of the last partition can be found with PositionFromPartition(last+1).
-
-template <typename T>
-class Partitioning {
-private:
-	// To avoid calculating all the partition positions whenever any text is inserted
-	// there may be a step somewhere in the list.
-	T stepPartition;
-	T stepLength;
-	SplitVector<T> body;
-
-	// Deleted so SplitVectorWithRangeAdd objects can not be copied.
-	void RangeAddDelta(T start, T end, T delta) noexcept {
-		// end is 1 past end, so end-start is number of elements to change
-		const ptrdiff_t position = start;
-		ptrdiff_t i = 0;
-		const ptrdiff_t rangeLength = end - position;
-		ptrdiff_t range1Length = rangeLength;
-		const ptrdiff_t part1Left = body.GapPosition() - position;
-		if (range1Length > part1Left)
-			range1Length = part1Left;
-		T *writer = &body[position];
-		while (i < range1Length) {
-			*writer += delta;
-			writer++;
-			i++;
-		}
-		if (i < rangeLength) {
-			T *writer2 = &body[position + i];
-			while (i < rangeLength) {
-				*writer2 += delta;
-				writer2++;
-				i++;
-			}
-		}
-	}
-
-	// Move step forward
-	void ApplyStep(T partitionUpTo) noexcept {
-		if (stepLength != 0) {
-			RangeAddDelta(stepPartition+1, partitionUpTo + 1, stepLength);
-		}
-		stepPartition = partitionUpTo;
-		if (stepPartition >= Partitions()) {
-			stepPartition = Partitions();
-			stepLength = 0;
-		}
-	}
-
-	// Move step backward
-	void BackStep(T partitionDownTo) noexcept {
-		if (stepLength != 0) {
-			RangeAddDelta(partitionDownTo+1, stepPartition+1, -stepLength);
-		}
-		stepPartition = partitionDownTo;
-	}
-
-public:
-	explicit Partitioning(size_t growSize=8) : stepPartition(0), stepLength(0), body(growSize) {
-		body.Insert(0, 0);	// This value stays 0 for ever
-		body.Insert(1, 0);	// This is the end of the first partition and will be the start of the second
-	}
-
-	T Partitions() const noexcept {
-		return static_cast<T>(body.Length())-1;
-	}
-
-	void ReAllocate(ptrdiff_t newSize) {
-		// + 1 accounts for initial element that is always 0.
-		body.ReAllocate(newSize + 1);
-	}
-
-	T Length() const noexcept {
-		return PositionFromPartition(Partitions());
-	}
-
-	void InsertPartition(T partition, T pos) {
-		if (stepPartition < partition) {
-			ApplyStep(partition);
-		}
-		body.Insert(partition, pos);
-		stepPartition++;
-	}
-
-	void InsertPartitions(T partition, const T *positions, size_t length) {
-		if (stepPartition < partition) {
-			ApplyStep(partition);
-		}
-		body.InsertFromArray(partition, positions, 0, length);
-		stepPartition += static_cast<T>(length);
-	}
-
-	void InsertPartitionsWithCast(T partition, const ptrdiff_t *positions, size_t length) {
-		// Used for 64-bit builds when T is 32-bits
-		if (stepPartition < partition) {
-			ApplyStep(partition);
-		}
-		T *pInsertion = body.InsertEmpty(partition, length);
-		for (size_t i = 0; i < length; i++) {
-			pInsertion[i] = static_cast<T>(positions[i]);
-		}
-		stepPartition += static_cast<T>(length);
-	}
-
-	void SetPartitionStartPosition(T partition, T pos) noexcept {
-		ApplyStep(partition+1);
-		if ((partition < 0) || (partition >= body.Length())) {
-			return;
-		}
-		body.SetValueAt(partition, pos);
-	}
-
-	void InsertText(T partitionInsert, T delta) noexcept {
-		// Point all the partitions after the insertion point further along in the buffer
-		if (stepLength != 0) {
-			if (partitionInsert >= stepPartition) {
-				// Fill in up to the new insertion point
-				ApplyStep(partitionInsert);
-				stepLength += delta;
-			} else if (partitionInsert >= (stepPartition - body.Length() / 10)) {
-				// Close to step but before so move step back
-				BackStep(partitionInsert);
-				stepLength += delta;
-			} else {
-				ApplyStep(Partitions());
-				stepPartition = partitionInsert;
-				stepLength = delta;
-			}
-		} else {
-			stepPartition = partitionInsert;
-			stepLength = delta;
-		}
-	}
-
-	void RemovePartition(T partition) {
-		if (partition > stepPartition) {
-			ApplyStep(partition);
-			stepPartition--;
-		} else {
-			stepPartition--;
-		}
-		body.Delete(partition);
-	}
-
-	T PositionFromPartition(T partition) const noexcept {
-		PLATFORM_ASSERT(partition >= 0);
-		PLATFORM_ASSERT(partition < body.Length());
-		const ptrdiff_t lengthBody = body.Length();
-		if ((partition < 0) || (partition >= lengthBody)) {
-			return 0;
-		}
-		T pos = body.ValueAt(partition);
-		if (partition > stepPartition)
-			pos += stepLength;
-		return pos;
-	}
-
-	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
-	T PartitionFromPosition(T pos) const noexcept {
-		if (body.Length() <= 1)
-			return 0;
-		if (pos >= (PositionFromPartition(Partitions())))
-			return Partitions() - 1;
-		T lower = 0;
-		T upper = Partitions();
-		do {
-			const T middle = (upper + lower + 1) / 2; 	// Round high
-			T posMiddle = body[middle];
-			if (middle > stepPartition)
-				posMiddle += stepLength;
-			if (pos < posMiddle) {
-				upper = middle - 1;
-			} else {
-				lower = middle;
-			}
-		} while (lower < upper);
-		return lower;
-	}
-
-	void DeleteAll() {
-		body.DeleteAll();
-		stepPartition = 0;
-		stepLength = 0;
-		body.Insert(0, 0);	// This value stays 0 for ever
-		body.Insert(1, 0);	// This is the end of the first partition and will be the start of the second
-	}
-
-	void Check() const {
-#ifdef CHECK_CORRECTNESS
-		if (Length() < 0) {
-			throw std::runtime_error("Partitioning: Length can not be negative.");
-		}
-		if (Partitions() < 1) {
-			throw std::runtime_error("Partitioning: Must always have 1 or more partitions.");
-		}
-		if (Length() == 0) {
-			if ((PositionFromPartition(0) != 0) || (PositionFromPartition(1) != 0)) {
-				throw std::runtime_error("Partitioning: Invalid empty partitioning.");
-			}
-		} else {
-			// Positions should be a strictly ascending sequence
-			for (T i = 0; i < Partitions(); i++) {
-				const T pos = PositionFromPartition(i);
-				const T posNext = PositionFromPartition(i+1);
-				if (pos > posNext) {
-					throw std::runtime_error("Partitioning: Negative partition.");
-				} else if (pos == posNext) {
-					throw std::runtime_error("Partitioning: Empty partition.");
-				}
-			}
-		}
-#endif
-	}
-
-};
-
-
-}
-
-#endif
+// Scintilla source code edit control
+/** @file Partitioning.h
+ ** Data structure used to partition an interval. Used for holding line start/end positions.
+ **/
+// Copyright 1998-2007 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef PARTITIONING_H
+#define PARTITIONING_H
+
+namespace Scintilla::Internal {
+
+/// Divide an interval into multiple partitions.
+/// Useful for breaking a document down into sections such as lines.
+/// A 0 length interval has a single 0 length partition, numbered 0
+/// If interval not 0 length then each partition non-zero length
+/// When needed, positions after the interval are considered part of the last partition
+/// but the end of the last partition can be found with PositionFromPartition(last+1).
+
+template <typename T>
+class Partitioning {
+private:
+	// To avoid calculating all the partition positions whenever any text is inserted
+	// there may be a step somewhere in the list.
+	T stepPartition;
+	T stepLength;
+	SplitVector<T> body;
+
+	// Deleted so SplitVectorWithRangeAdd objects can not be copied.
+	void RangeAddDelta(T start, T end, T delta) noexcept {
+		// end is 1 past end, so end-start is number of elements to change
+		const ptrdiff_t position = start;
+		ptrdiff_t i = 0;
+		const ptrdiff_t rangeLength = end - position;
+		ptrdiff_t range1Length = rangeLength;
+		const ptrdiff_t part1Left = body.GapPosition() - position;
+		if (range1Length > part1Left)
+			range1Length = part1Left;
+		T *writer = &body[position];
+		while (i < range1Length) {
+			*writer += delta;
+			writer++;
+			i++;
+		}
+		if (i < rangeLength) {
+			T *writer2 = &body[position + i];
+			while (i < rangeLength) {
+				*writer2 += delta;
+				writer2++;
+				i++;
+			}
+		}
+	}
+
+	// Move step forward
+	void ApplyStep(T partitionUpTo) noexcept {
+		if (stepLength != 0) {
+			RangeAddDelta(stepPartition+1, partitionUpTo + 1, stepLength);
+		}
+		stepPartition = partitionUpTo;
+		if (stepPartition >= Partitions()) {
+			stepPartition = Partitions();
+			stepLength = 0;
+		}
+	}
+
+	// Move step backward
+	void BackStep(T partitionDownTo) noexcept {
+		if (stepLength != 0) {
+			RangeAddDelta(partitionDownTo+1, stepPartition+1, -stepLength);
+		}
+		stepPartition = partitionDownTo;
+	}
+
+public:
+	explicit Partitioning(size_t growSize=8) : stepPartition(0), stepLength(0), body(growSize) {
+		body.Insert(0, 0);	// This value stays 0 for ever
+		body.Insert(1, 0);	// This is the end of the first partition and will be the start of the second
+	}
+
+	T Partitions() const noexcept {
+		return static_cast<T>(body.Length())-1;
+	}
+
+	size_t SizeInBytes() const noexcept {
+		return body.SizeInBytes();
+	}
+
+	void ReAllocate(ptrdiff_t newSize) {
+		// + 1 accounts for initial element that is always 0.
+		body.ReAllocate(newSize + 1);
+	}
+
+	T Length() const noexcept {
+		return PositionFromPartition(Partitions());
+	}
+
+	void InsertPartition(T partition, T pos) {
+		if (stepPartition < partition) {
+			ApplyStep(partition);
+		}
+		body.Insert(partition, pos);
+		stepPartition++;
+	}
+
+	void InsertPartitions(T partition, const T *positions, size_t length) {
+		if (stepPartition < partition) {
+			ApplyStep(partition);
+		}
+		body.InsertFromArray(partition, positions, 0, length);
+		stepPartition += static_cast<T>(length);
+	}
+
+	void InsertPartitionsWithCast(T partition, const ptrdiff_t *positions, size_t length) {
+		// Used for 64-bit builds when T is 32-bits
+		if (stepPartition < partition) {
+			ApplyStep(partition);
+		}
+		T *pInsertion = body.InsertEmpty(partition, length);
+		for (size_t i = 0; i < length; i++) {
+			pInsertion[i] = static_cast<T>(positions[i]);
+		}
+		stepPartition += static_cast<T>(length);
+	}
+
+	void SetPartitionStartPosition(T partition, T pos) noexcept {
+		// Only move step forward as partitions before the step already have their final values
+		if (stepPartition < partition+1) {
+			ApplyStep(partition+1);
+		}
+		if ((partition < 0) || (partition >= body.Length())) {
+			return;
+		}
+		body.SetValueAt(partition, pos);
+	}
+
+	void InsertText(T partitionInsert, T delta) noexcept {
+		// Point all the partitions after the insertion point further along in the buffer
+		if (stepLength != 0) {
+			if (partitionInsert >= stepPartition) {
+				// Fill in up to the new insertion point
+				ApplyStep(partitionInsert);
+				stepLength += delta;
+			} else if (partitionInsert >= (stepPartition - body.Length() / 10)) {
+				// Close to step but before so move step back
+				BackStep(partitionInsert);
+				stepLength += delta;
+			} else {
+				ApplyStep(Partitions());
+				stepPartition = partitionInsert;
+				stepLength = delta;
+			}
+		} else {
+			stepPartition = partitionInsert;
+			stepLength = delta;
+		}
+	}
+
+	void RemovePartition(T partition) {
+		if (partition > stepPartition) {
+			ApplyStep(partition);
+			stepPartition--;
+		} else {
+			stepPartition--;
+		}
+		body.Delete(partition);
+	}
+
+	T PositionFromPartition(T partition) const noexcept {
+		PLATFORM_ASSERT(partition >= 0);
+		PLATFORM_ASSERT(partition < body.Length());
+		const ptrdiff_t lengthBody = body.Length();
+		if ((partition < 0) || (partition >= lengthBody)) {
+			return 0;
+		}
+		T pos = body.ValueAt(partition);
+		if (partition > stepPartition)
+			pos += stepLength;
+		return pos;
+	}
+
+	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
+	T PartitionFromPosition(T pos) const noexcept {
+		if (body.Length() <= 1)
+			return 0;
+		if (pos >= (PositionFromPartition(Partitions())))
+			return Partitions() - 1;
+		T lower = 0;
+		T upper = Partitions();
+		do {
+			const T middle = (upper + lower + 1) / 2; 	// Round high
+			T posMiddle = body[middle];
+			if (middle > stepPartition)
+				posMiddle += stepLength;
+			if (pos < posMiddle) {
+				upper = middle - 1;
+			} else {
+				lower = middle;
+			}
+		} while (lower < upper);
+		return lower;
+	}
+
+	void DeleteAll() {
+		body.DeleteAll();
+		stepPartition = 0;
+		stepLength = 0;
+		body.Insert(0, 0);	// This value stays 0 for ever
+		body.Insert(1, 0);	// This is the end of the first partition and will be the start of the second
+	}
+
+	void Check() const {
+#ifdef CHECK_CORRECTNESS
+		if (Length() < 0) {
+			throw std::runtime_error("Partitioning: Length can not be negative.");
+		}
+		if (Partitions() < 1) {
+			throw std::runtime_error("Partitioning: Must always have 1 or more partitions.");
+		}
+		if (Length() == 0) {
+			if ((PositionFromPartition(0) != 0) || (PositionFromPartition(1) != 0)) {
+				throw std::runtime_error("Partitioning: Invalid empty partitioning.");
+			}
+		} else {
+			// Positions should be a strictly ascending sequence
+			for (T i = 0; i < Partitions(); i++) {
+				const T pos = PositionFromPartition(i);
+				const T posNext = PositionFromPartition(i+1);
+				if (pos > posNext) {
+					throw std::runtime_error("Partitioning: Negative partition.");
+				} else if (pos == posNext) {
+					throw std::runtime_error("Partitioning: Empty partition.");
+				}
+			}
+		}
+#endif
+	}
+
+};
+
+/// Alternative to Partitioning with the same interface for documents with very many partitions
+/// that are modified at scattered places such as by multiple selections or replace all.
+/// Partitioning moves its step across every partition between two modifications
+/// which is slow when the modifications alternate between distant partitions.
+/// Here the partition starts are divided into blocks of limited size with the positions in each
+/// block relative to the first start of that block. Fenwick trees (binary indexed trees) sum the
+/// number of starts in blocks and the distances between blocks so locating a partition or
+/// a position and moving all following partitions take time logarithmic in the number of blocks.
+/// Each modification also updates the relative positions in one block.
+
+template <typename T>
+class TreePartitioning {
+private:
+	static constexpr size_t blockSize = 1024;
+	static constexpr size_t blockSplit = blockSize / 2;
+	static constexpr size_t blockMinimum = blockSize / 8;
+
+	// Starts of partitions relative to the first start of each block.
+	// Blocks are never empty and blocks after the first always start with 0.
+	std::vector<std::vector<T>> blocks;
+	// Distance from the first start of each block to the first start of the next block.
+	// Always 0 for the last block.
+	std::vector<T> lengths;
+	// Fenwick trees over the block sizes and lengths. The element at index i covers
+	// the blocks from (i + 1) with its lowest bit cleared up to i.
+	std::vector<T> treeCounts;
+	std::vector<T> treeLengths;
+	// Largest power of 2 not greater than the number of blocks
+	size_t treeStep = 1;
+	T partitions = 1;
+
+	struct Place {
+		size_t block;
+		size_t index;
+		T base;
+	};
+
+	static constexpr size_t LowBit(size_t i) noexcept {
+		return i & (~i + 1);
+	}
+
+	void RebuildTrees() {
+		const size_t blockCount = blocks.size();
+		treeCounts.resize(blockCount);
+		treeLengths.resize(blockCount);
+		for (size_t i = 0; i < blockCount; i++) {
+			treeCounts[i] = static_cast<T>(blocks[i].size());
+			treeLengths[i] = lengths[i];
+		}
+		for (size_t i = 1; i <= blockCount; i++) {
+			const size_t parent = i + LowBit(i);
+			if (parent <= blockCount) {
+				treeCounts[parent - 1] += treeCounts[i - 1];
+				treeLengths[parent - 1] += treeLengths[i - 1];
+			}
+		}
+		treeStep = 1;
+		while (treeStep * 2 <= blockCount) {
+			treeStep *= 2;
+		}
+	}
+
+	void AddCount(size_t block, T delta) noexcept {
+		for (size_t i = block + 1; i <= treeCounts.size(); i += LowBit(i)) {
+			treeCounts[i - 1] += delta;
+		}
+	}
+
+	void AddLength(size_t block, T delta) noexcept {
+		lengths[block] += delta;
+		for (size_t i = block + 1; i <= treeLengths.size(); i += LowBit(i)) {
+			treeLengths[i - 1] += delta;
+		}
+	}
+
+	// Find the block containing a partition and the position of that block.
+	Place Locate(T partition) const noexcept {
+		size_t block = 0;
+		T remaining = partition;
+		T base = 0;
+		for (size_t step = treeStep; step > 0; step >>= 1) {
+			const size_t next = block + step;
+			if ((next <= treeCounts.size()) && (treeCounts[next - 1] <= remaining)) {
+				block = next;
+				remaining -= treeCounts[next - 1];
+				base += treeLengths[next - 1];
+			}
+		}
+		return { block, static_cast<size_t>(remaining), base };
+	}
+
+	// Divide an oversized block into blocks of around blockSplit starts.
+	void SplitBlock(size_t block) {
+		const size_t size = blocks[block].size();
+		const size_t pieces = size / blockSplit;
+		const size_t pieceSize = (size + pieces - 1) / pieces;
+		const bool last = (block + 1) == blocks.size();
+		std::vector<std::vector<T>> added;
+		std::vector<T> addedLengths;
+		const std::vector<T> &starts = blocks[block];
+		for (size_t begin = pieceSize; begin < size; begin += pieceSize) {
+			const size_t end = std::min(size, begin + pieceSize);
+			const T offset = starts[begin];
+			std::vector<T> piece(starts.begin() + begin, starts.begin() + end);
+			for (T &start : piece) {
+				start -= offset;
+			}
+			added.push_back(std::move(piece));
+			if (end < size) {
+				addedLengths.push_back(starts[end] - offset);
+			} else {
+				addedLengths.push_back(last ? 0 : lengths[block] - offset);
+			}
+		}
+		lengths[block] = starts[pieceSize];
+		blocks[block].resize(pieceSize);
+		blocks.insert(blocks.begin() + block + 1, added.size(), std::vector<T>());
+		for (size_t i = 0; i < added.size(); i++) {
+			blocks[block + 1 + i] = std::move(added[i]);
+		}
+		lengths.insert(lengths.begin() + block + 1, addedLengths.begin(), addedLengths.end());
+		RebuildTrees();
+	}
+
+	// Join the block after block onto block.
+	void MergeBlocks(size_t block) {
+		const T offset = lengths[block];
+		std::vector<T> &starts = blocks[block];
+		for (const T start : blocks[block + 1]) {
+			starts.push_back(start + offset);
+		}
+		lengths[block] = ((block + 2) < blocks.size()) ? offset + lengths[block + 1] : 0;
+		blocks.erase(blocks.begin() + block + 1);
+		lengths.erase(lengths.begin() + block + 1);
+		if (starts.size() > blockSize) {
+			SplitBlock(block);
+		} else {
+			RebuildTrees();
+		}
+	}
+
+	template <typename P>
+	void InsertPositions(T partition, const P *positions, size_t length) {
+		if ((partition < 0) || (partition > partitions + 1) || (length == 0)) {
+			return;
+		}
+		// Add after the previous start so that the first start of a block never changes
+		Place place { 0, 0, 0 };
+		if (partition > 0) {
+			place = Locate(partition - 1);
+			place.index++;
+		}
+		std::vector<T> &starts = blocks[place.block];
+		starts.insert(starts.begin() + place.index, length, 0);
+		for (size_t i = 0; i < length; i++) {
+			starts[place.index + i] = static_cast<T>(positions[i]) - place.base;
+		}
+		partitions += static_cast<T>(length);
+		if (starts.size() > blockSize) {
+			SplitBlock(place.block);
+		} else {
+			AddCount(place.block, static_cast<T>(length));
+		}
+	}
+
+public:
+	// Blocks have a fixed maximum size so there is no use for the growth size of Partitioning
+	explicit TreePartitioning(size_t = 8) {
+		DeleteAll();
+	}
+
+	T Partitions() const noexcept {
+		return partitions;
+	}
+
+	void ReAllocate(ptrdiff_t newSize) {
+		const size_t blocksNeeded = static_cast<size_t>(newSize + 1) / blockSplit + 1;
+		blocks.reserve(blocksNeeded);
+		lengths.reserve(blocksNeeded);
+	}
+
+	T Length() const noexcept {
+		return PositionFromPartition(Partitions());
+	}
+
+	void InsertPartition(T partition, T pos) {
+		InsertPositions(partition, &pos, 1);
+	}
+
+	void InsertPartitions(T partition, const T *positions, size_t length) {
+		InsertPositions(partition, positions, length);
+	}
+
+	void InsertPartitionsWithCast(T partition, const ptrdiff_t *positions, size_t length) {
+		// Used for 64-bit builds when T is 32-bits
+		InsertPositions(partition, positions, length);
+	}
+
+	void SetPartitionStartPosition(T partition, T pos) noexcept {
+		if ((partition < 0) || (partition > partitions)) {
+			return;
+		}
+		const Place place = Locate(partition);
+		std::vector<T> &starts = blocks[place.block];
+		if ((place.index == 0) && (place.block > 0)) {
+			// Moving the first start moves the whole block so compensate the other starts
+			const T delta = pos - place.base;
+			AddLength(place.block - 1, delta);
+			if ((place.block + 1) < blocks.size()) {
+				AddLength(place.block, -delta);
+			}
+			for (size_t i = 1; i < starts.size(); i++) {
+				starts[i] -= delta;
+			}
+		} else {
+			starts[place.index] = pos - place.base;
+		}
+	}
+
+	void InsertText(T partitionInsert, T delta) noexcept {
+		// Point all the partitions after the insertion point further along in the buffer
+		if ((partitionInsert < 0) || (partitionInsert > partitions) || (delta == 0)) {
+			return;
+		}
+		const Place place = Locate(partitionInsert);
+		std::vector<T> &starts = blocks[place.block];
+		for (size_t i = place.index + 1; i < starts.size(); i++) {
+			starts[i] += delta;
+		}
+		if ((place.block + 1) < blocks.size()) {
+			AddLength(place.block, delta);
+		}
+	}
+
+	void RemovePartition(T partition) {
+		if ((partition < 0) || (partition > partitions)) {
+			return;
+		}
+		const Place place = Locate(partition);
+		const size_t block = place.block;
+		std::vector<T> &starts = blocks[block];
+		partitions--;
+		if ((starts.size() == 1) && (blocks.size() > 1)) {
+			// Remove the block, joining its length onto a neighbour
+			if (block > 0) {
+				lengths[block - 1] = ((block + 1) < blocks.size()) ? lengths[block - 1] + lengths[block] : 0;
+			} else {
+				for (T &start : blocks[1]) {
+					start += lengths[0];
+				}
+				lengths[1] = (blocks.size() > 2) ? lengths[0] + lengths[1] : 0;
+			}
+			blocks.erase(blocks.begin() + block);
+			lengths.erase(lengths.begin() + block);
+			RebuildTrees();
+			return;
+		}
+		if ((place.index == 0) && (block > 0)) {
+			// The second start becomes the first so rebase the block on it
+			const T shift = starts[1];
+			starts.erase(starts.begin());
+			for (T &start : starts) {
+				start -= shift;
+			}
+			AddLength(block - 1, shift);
+			if ((block + 1) < blocks.size()) {
+				AddLength(block, -shift);
+			}
+		} else {
+			starts.erase(starts.begin() + place.index);
+		}
+		AddCount(block, -1);
+		if ((starts.size() < blockMinimum) && (blocks.size() > 1)) {
+			MergeBlocks(((block + 1) < blocks.size()) ? block : block - 1);
+		}
+	}
+
+	T PositionFromPartition(T partition) const noexcept {
+		PLATFORM_ASSERT(partition >= 0);
+		PLATFORM_ASSERT(partition <= partitions);
+		if ((partition < 0) || (partition > partitions)) {
+			return 0;
+		}
+		const Place place = Locate(partition);
+		return place.base + blocks[place.block][place.index];
+	}
+
+	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
+	T PartitionFromPosition(T pos) const noexcept {
+		if (pos >= Length())
+			return Partitions() - 1;
+		// Find the last block starting at or before pos
+		size_t block = 0;
+		T remaining = pos;
+		T before = 0;
+		for (size_t step = treeStep; step > 0; step >>= 1) {
+			const size_t next = block + step;
+			if ((next <= treeLengths.size()) && (treeLengths[next - 1] <= remaining)) {
+				block = next;
+				remaining -= treeLengths[next - 1];
+				before += treeCounts[next - 1];
+			}
+		}
+		if (block == blocks.size()) {
+			block--;
+			remaining += lengths[block];
+			before -= static_cast<T>(blocks[block].size());
+		}
+		const std::vector<T> &starts = blocks[block];
+		const auto it = std::upper_bound(starts.begin(), starts.end(), remaining);
+		if (it == starts.begin()) {
+			return 0;
+		}
+		return before + static_cast<T>(it - starts.begin()) - 1;
+	}
+
+	void DeleteAll() {
+		// This first value stays 0 for ever and the second is the end of the first partition
+		blocks.assign(1, std::vector<T>(2, 0));
+		lengths.assign(1, 0);
+		partitions = 1;
+		RebuildTrees();
+	}
+
+	void Check() const {
+#ifdef CHECK_CORRECTNESS
+		for (size_t block = 0; block < blocks.size(); block++) {
+			if (blocks[block].empty()) {
+				throw std::runtime_error("TreePartitioning: Empty block.");
+			}
+			if ((block > 0) && (blocks[block].front() != 0)) {
+				throw std::runtime_error("TreePartitioning: Block not relative to first start.");
+			}
+		}
+		if (lengths.back() != 0) {
+			throw std::runtime_error("TreePartitioning: Last block has a length.");
+		}
+		if (Length() < 0) {
+			throw std::runtime_error("TreePartitioning: Length can not be negative.");
+		}
+		if (Partitions() < 1) {
+			throw std::runtime_error("TreePartitioning: Must always have 1 or more partitions.");
+		}
+		if (Length() == 0) {
+			if ((PositionFromPartition(0) != 0) || (PositionFromPartition(1) != 0)) {
+				throw std::runtime_error("TreePartitioning: Invalid empty partitioning.");
+			}
+		} else {
+			// Positions should be a strictly ascending sequence
+			for (T i = 0; i < Partitions(); i++) {
+				const T pos = PositionFromPartition(i);
+				const T posNext = PositionFromPartition(i+1);
+				if (pos > posNext) {
+					throw std::runtime_error("TreePartitioning: Negative partition.");
+				} else if (pos == posNext) {
+					throw std::runtime_error("TreePartitioning: Empty partition.");
+				}
+			}
+		}
+#endif
+	}
+
+};
+
+}
+
+#endif
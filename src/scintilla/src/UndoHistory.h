@@ -1,161 +1,242 @@
-// Scintilla source code edit control
-/** @file UndoHistory.h
- ** Manages undo for the document.
- **/
-// Copyright 1998-2024 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef UNDOHISTORY_H
-#define UNDOHISTORY_H
-
-namespace Scintilla::Internal {
-
-// ScaledVector is a vector of unsigned integers that uses elements sized to hold the largest value.
-// Thus, if an undo history only contains short insertions and deletions the lengths vector may
-// only use 2 bytes or even 1 byte for each length.
-// This saves much memory often reducing by 50% for 32-bit builds and 75% for 64-bit builds.
-
-struct SizeMax {
-	size_t size = 1;
-	size_t maxValue = UINT8_MAX;
-};
-
-class ScaledVector {
-	SizeMax element;
-	std::vector<uint8_t> bytes;
-public:
-	[[nodiscard]] size_t Size() const noexcept;
-	[[nodiscard]] size_t ValueAt(size_t index) const noexcept;
-	[[nodiscard]] intptr_t SignedValueAt(size_t index) const noexcept;
-	void SetValueAt(size_t index, size_t value);
-	void ClearValueAt(size_t index) noexcept;
-	void Clear() noexcept;
-	void Truncate(size_t length) noexcept;
-	void ReSize(size_t length);
-	void PushBack();
-
-	// For testing
-	[[nodiscard]] size_t SizeInBytes() const noexcept;
-};
-
-class UndoActionType {
-public:
-	ActionType at : 4;
-	bool mayCoalesce : 1;
-	UndoActionType() noexcept;
-};
-
-struct UndoActions {
-	std::vector<UndoActionType> types;
-	ScaledVector positions;
-	ScaledVector lengths;
-
-	UndoActions() noexcept;
-	void Truncate(size_t length) noexcept;
-	void PushBack();
-	void Clear() noexcept;
-	[[nodiscard]] intptr_t SSize() const noexcept;
-	void Create(size_t index, ActionType at_, Sci::Position position_, Sci::Position lenData_, bool mayCoalesce_);
-	[[nodiscard]] bool AtStart(size_t index) const noexcept;
-	[[nodiscard]] size_t LengthTo(size_t index) const noexcept;
-	[[nodiscard]] Sci::Position Position(int action) const noexcept;
-	[[nodiscard]] Sci::Position Length(int action) const noexcept;
-};
-
-class ScrapStack {
-	std::string stack;
-	size_t current = 0;
-public:
-	void Clear() noexcept;
-	const char *Push(const char *text, size_t length);
-	void SetCurrent(size_t position) noexcept;
-	void MoveForward(size_t length) noexcept;
-	void MoveBack(size_t length) noexcept;
-	[[nodiscard]] const char *CurrentText() const noexcept;
-	[[nodiscard]] const char *TextAt(size_t position) const noexcept;
-};
-
-constexpr int coalesceFlag = 0x100;
-
-/**
- *
- */
-class UndoHistory {
-	UndoActions actions;
-	int currentAction = 0;
-	int undoSequenceDepth = 0;
-	int savePoint = 0;
-	int tentativePoint = -1;
-	std::optional<int> detach;	// Never set if savePoint set (>= 0)
-	std::unique_ptr<ScrapStack> scraps;
-	struct actPos { int act; size_t position; };
-	std::optional<actPos> memory;
-
-	int PreviousAction() const noexcept;
-
-public:
-	UndoHistory();
-	~UndoHistory() noexcept;
-
-	const char *AppendAction(ActionType at, Sci::Position position, const char *data, Sci::Position lengthData, bool &startSequence, bool mayCoalesce=true);
-
-	void BeginUndoAction(bool mayCoalesce=false) noexcept;
-	void EndUndoAction() noexcept;
-	int UndoSequenceDepth() const noexcept;
-	bool AfterUndoSequenceStart() const noexcept;
-	void DropUndoSequence() noexcept;
-	void DeleteUndoHistory() noexcept;
-
-	[[nodiscard]] int Actions() const noexcept;
-
-	/// The save point is a marker in the undo stack where the container has stated that
-	/// the buffer was saved. Undo and redo can move over the save point.
-	void SetSavePoint(int action) noexcept;
-	[[nodiscard]] int SavePoint() const noexcept;
-	void SetSavePoint() noexcept;
-	bool IsSavePoint() const noexcept;
-	bool BeforeSavePoint() const noexcept;
-	bool PreviousBeforeSavePoint() const noexcept;
-	bool BeforeReachableSavePoint() const noexcept;
-	bool AfterSavePoint() const noexcept;
-
-	/// The detach point is the last action that was before an inaccessible missing save point.
-	void SetDetachPoint(int action) noexcept;
-	[[nodiscard]] int DetachPoint() const noexcept;
-	bool AfterDetachPoint() const noexcept;
-	bool AfterOrAtDetachPoint() const noexcept;
-
-	[[nodiscard]] intptr_t Delta(int action) const noexcept;
-	[[nodiscard]] bool Validate(intptr_t lengthDocument) const noexcept;
-	void SetCurrent(int action, intptr_t lengthDocument);
-	[[nodiscard]] int Current() const noexcept;
-	[[nodiscard]] int Type(int action) const noexcept;
-	[[nodiscard]] Sci::Position Position(int action) const noexcept;
-	[[nodiscard]] Sci::Position Length(int action) const noexcept;
-	[[nodiscard]] std::string_view Text(int action) noexcept;
-	void PushUndoActionType(int type, Sci::Position position);
-	void ChangeLastUndoActionText(size_t length, const char *text);
-
-	// Tentative actions are used for input composition so that it can be undone cleanly
-	void SetTentative(int action) noexcept;
-	[[nodiscard]] int TentativePoint() const noexcept;
-	void TentativeStart() noexcept;
-	void TentativeCommit() noexcept;
-	bool TentativeActive() const noexcept;
-	int TentativeSteps() const noexcept;
-
-	/// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
-	/// called that many times. Similarly for redo.
-	bool CanUndo() const noexcept;
-	int StartUndo() const noexcept;
-	Action GetUndoStep() const noexcept;
-	void CompletedUndoStep() noexcept;
-	bool CanRedo() const noexcept;
-	int StartRedo() const noexcept;
-	Action GetRedoStep() const noexcept;
-	void CompletedRedoStep() noexcept;
-};
-
-}
-
-#endif
+// Scintilla source code edit control
+/** @file UndoHistory.h
+ ** Manages undo for the document.
+ **/
+// Copyright 1998-2024 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef UNDOHISTORY_H
+#define UNDOHISTORY_H
+
+namespace Scintilla::Internal {
+
+// ScaledVector is a vector of unsigned integers that uses elements sized to hold the largest value.
+// Thus, if an undo history only contains short insertions and deletions the lengths vector may
+// only use 2 bytes or even 1 byte for each length.
+// This saves much memory often reducing by 50% for 32-bit builds and 75% for 64-bit builds.
+
+struct SizeMax {
+	size_t size = 1;
+	size_t maxValue = UINT8_MAX;
+};
+
+class ScaledVector {
+	SizeMax element;
+	std::vector<uint8_t> bytes;
+public:
+	[[nodiscard]] size_t Size() const noexcept;
+	[[nodiscard]] size_t ValueAt(size_t index) const noexcept;
+	[[nodiscard]] intptr_t SignedValueAt(size_t index) const noexcept;
+	void SetValueAt(size_t index, size_t value);
+	void ClearValueAt(size_t index) noexcept;
+	void Clear() noexcept;
+	void Truncate(size_t length) noexcept;
+	void ReSize(size_t length);
+	void PushBack();
+
+	// For testing
+	[[nodiscard]] size_t SizeInBytes() const noexcept;
+};
+
+class UndoActionType {
+public:
+	ActionType at : 4;
+	bool mayCoalesce : 1;
+	UndoActionType() noexcept;
+};
+
+struct UndoActions {
+	std::vector<UndoActionType> types;
+	ScaledVector positions;
+	ScaledVector lengths;
+
+	UndoActions() noexcept;
+	void Truncate(size_t length) noexcept;
+	void PushBack();
+	void Clear() noexcept;
+	[[nodiscard]] intptr_t SSize() const noexcept;
+	void Create(size_t index, ActionType at_, Sci::Position position_, Sci::Position lenData_, bool mayCoalesce_);
+	[[nodiscard]] bool AtStart(size_t index) const noexcept;
+	[[nodiscard]] size_t LengthTo(size_t index) const noexcept;
+	[[nodiscard]] Sci::Position Position(int action) const noexcept;
+	[[nodiscard]] Sci::Position Length(int action) const noexcept;
+};
+
+// ScrapStack holds the text of all the actions end to end.
+// When a memory limit is set, text well before the current position is compressed in blocks
+// and, if spilling is on, compressed blocks beyond the limit are written to a temporary file.
+// Only the text after base is held uncompressed in stack so blocks are restored with
+// Thaw before their text is needed for undo.
+
+class SpillFile;
+
+class ScrapStack {
+	struct ScrapBlock {
+		size_t length = 0;
+		size_t lengthCompressed = 0;
+		std::string compressed;	// Empty when spilled to file
+	};
+	std::string stack;
+	size_t base = 0;	// Position of stack[0]
+	size_t current = 0;
+	std::vector<ScrapBlock> blocks;	// Compressed text before base
+	size_t blocksSpilled = 0;	// Leading blocks that are in spillFile
+	size_t compressedMemory = 0;
+	size_t memoryLimit = 0;
+	bool spill = false;
+	std::unique_ptr<SpillFile> spillFile;
+	void CompressBlocks(size_t end);
+	void Freeze();
+	void SpillBlocks(size_t limit);
+	void ThawTo(size_t position);
+public:
+	ScrapStack() noexcept;
+	// Deleted so ScrapStack objects can not be copied.
+	ScrapStack(const ScrapStack &) = delete;
+	ScrapStack(ScrapStack &&) = delete;
+	ScrapStack &operator=(const ScrapStack &) = delete;
+	ScrapStack &operator=(ScrapStack &&) = delete;
+	~ScrapStack() noexcept;
+	void Clear() noexcept;
+	const char *Push(const char *text, size_t length);
+	void SetCurrent(size_t position) noexcept;
+	void MoveForward(size_t length) noexcept;
+	void MoveBack(size_t length) noexcept;
+	[[nodiscard]] const char *CurrentText() const noexcept;
+	[[nodiscard]] const char *TextAt(size_t position);
+	/// Ensure the lengthBefore bytes before current and all text after current are uncompressed.
+	void Thaw(size_t lengthBefore);
+	/// Compress all whole blocks before current and, if spill, write them all to the temporary file.
+	void Compact(bool spillCompressed);
+	void SetMemoryLimit(size_t limit) noexcept;
+	[[nodiscard]] size_t MemoryLimit() const noexcept;
+	void SetSpill(bool spill_) noexcept;
+	[[nodiscard]] bool Spilling() const noexcept;
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+	[[nodiscard]] size_t SpilledBytes() const noexcept;
+};
+
+// CompressedText holds a whole text as compressed blocks which may be written to a temporary
+// file. Used to hibernate a document that is not being shown.
+
+class CompressedText {
+	struct CompressedBlock {
+		size_t length = 0;
+		size_t lengthCompressed = 0;
+		std::string compressed;	// Empty when spilled to file
+	};
+	std::vector<CompressedBlock> blocks;
+	size_t length = 0;
+	bool spilled = false;
+	std::unique_ptr<SpillFile> spillFile;
+public:
+	CompressedText() noexcept;
+	// Deleted so CompressedText objects can not be copied.
+	CompressedText(const CompressedText &) = delete;
+	CompressedText(CompressedText &&) = delete;
+	CompressedText &operator=(const CompressedText &) = delete;
+	CompressedText &operator=(CompressedText &&) = delete;
+	~CompressedText() noexcept;
+	void Append(std::string_view text);
+	/// Write the compressed blocks to a temporary file. Stays in memory if that fails.
+	bool Spill();
+	/// Append the whole text to out.
+	void Retrieve(std::string &out);
+	[[nodiscard]] size_t Length() const noexcept;
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+};
+
+constexpr int coalesceFlag = 0x100;
+
+/**
+ *
+ */
+class UndoHistory {
+	UndoActions actions;
+	int currentAction = 0;
+	int undoSequenceDepth = 0;
+	int savePoint = 0;
+	int tentativePoint = -1;
+	std::optional<int> detach;	// Never set if savePoint set (>= 0)
+	std::unique_ptr<ScrapStack> scraps;
+	struct actPos { int act; size_t position; };
+	std::optional<actPos> memory;
+
+	int PreviousAction() const noexcept;
+
+public:
+	UndoHistory();
+	~UndoHistory() noexcept;
+
+	const char *AppendAction(ActionType at, Sci::Position position, const char *data, Sci::Position lengthData, bool &startSequence, bool mayCoalesce=true);
+
+	void BeginUndoAction(bool mayCoalesce=false) noexcept;
+	void EndUndoAction() noexcept;
+	int UndoSequenceDepth() const noexcept;
+	bool AfterUndoSequenceStart() const noexcept;
+	void DropUndoSequence() noexcept;
+	void DeleteUndoHistory() noexcept;
+
+	[[nodiscard]] int Actions() const noexcept;
+
+	/// The save point is a marker in the undo stack where the container has stated that
+	/// the buffer was saved. Undo and redo can move over the save point.
+	void SetSavePoint(int action) noexcept;
+	[[nodiscard]] int SavePoint() const noexcept;
+	void SetSavePoint() noexcept;
+	bool IsSavePoint() const noexcept;
+	bool BeforeSavePoint() const noexcept;
+	bool PreviousBeforeSavePoint() const noexcept;
+	bool BeforeReachableSavePoint() const noexcept;
+	bool AfterSavePoint() const noexcept;
+
+	/// The detach point is the last action that was before an inaccessible missing save point.
+	void SetDetachPoint(int action) noexcept;
+	[[nodiscard]] int DetachPoint() const noexcept;
+	bool AfterDetachPoint() const noexcept;
+	bool AfterOrAtDetachPoint() const noexcept;
+
+	[[nodiscard]] intptr_t Delta(int action) const noexcept;
+	[[nodiscard]] bool Validate(intptr_t lengthDocument) const noexcept;
+	void SetCurrent(int action, intptr_t lengthDocument);
+	[[nodiscard]] int Current() const noexcept;
+	[[nodiscard]] int Type(int action) const noexcept;
+	[[nodiscard]] Sci::Position Position(int action) const noexcept;
+	[[nodiscard]] Sci::Position Length(int action) const noexcept;
+	[[nodiscard]] std::string_view Text(int action);
+	void PushUndoActionType(int type, Sci::Position position);
+	void ChangeLastUndoActionText(size_t length, const char *text);
+
+	/// Older text may be compressed to stay within a memory limit and, optionally,
+	/// then written to a temporary file.
+	void SetMemoryLimit(size_t limit) noexcept;
+	[[nodiscard]] size_t MemoryLimit() const noexcept;
+	void SetSpill(bool spill) noexcept;
+	[[nodiscard]] bool Spill() const noexcept;
+	[[nodiscard]] size_t MemoryUse() const noexcept;
+	/// Minimize memory use, as when the document is hibernated.
+	void Compact(bool spill);
+
+	// Tentative actions are used for input composition so that it can be undone cleanly
+	void SetTentative(int action) noexcept;
+	[[nodiscard]] int TentativePoint() const noexcept;
+	void TentativeStart() noexcept;
+	void TentativeCommit() noexcept;
+	bool TentativeActive() const noexcept;
+	int TentativeSteps();
+
+	/// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
+	/// called that many times. Similarly for redo.
+	bool CanUndo() const noexcept;
+	int StartUndo();
+	Action GetUndoStep() const noexcept;
+	void CompletedUndoStep() noexcept;
+	bool CanRedo() const noexcept;
+	int StartRedo();
+	Action GetRedoStep() const noexcept;
+	void CompletedRedoStep() noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+// Scintilla source code edit control
+/** @file WrapPending.h
+ ** Track the lines that need wrapping and estimate the height of lines not yet wrapped.
+ **/
+// Copyright 1998-2011 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef WRAPPENDING_H
+#define WRAPPENDING_H
+
+namespace Scintilla::Internal {
+
+struct WrapPending {
+	// The range of lines that need to be wrapped
+	enum { lineLarge = 0x7ffffff };
+	Sci::Line start;	// When there are wraps pending, will be in document range
+	Sci::Line end;	// May be lineLarge to indicate all of document after start
+	WrapPending() noexcept {
+		start = lineLarge;
+		end = lineLarge;
+	}
+	void Reset() noexcept {
+		start = lineLarge;
+		end = lineLarge;
+	}
+	void Wrapped(Sci::Line line) noexcept {
+		if (start == line)
+			start++;
+	}
+	// A block of lines [lineStart, lineEnd) has been wrapped.
+	// As the pending range is a single range, only a block reaching one of its ends can shrink it.
+	void WrappedBlock(Sci::Line lineStart, Sci::Line lineEnd) noexcept {
+		if ((lineStart <= start) && (lineEnd > start)) {
+			start = lineEnd;
+		}
+		if ((lineEnd >= end) && (lineStart < end)) {
+			end = std::max(lineStart, start);
+		}
+	}
+	bool NeedsWrap() const noexcept {
+		return start < end;
+	}
+	bool AddRange(Sci::Line lineStart, Sci::Line lineEnd) noexcept {
+		const bool neededWrap = NeedsWrap();
+		bool changed = false;
+		if (start > lineStart) {
+			start = lineStart;
+			changed = true;
+		}
+		if ((end < lineEnd) || !neededWrap) {
+			end = lineEnd;
+			changed = true;
+		}
+		return changed;
+	}
+};
+
+// Estimate how many sub-lines a line of lengthLine bytes wraps into when charsPerLine
+// characters fit across the text area. Used for lines that have not been wrapped yet.
+constexpr int EstimateWrapLines(Sci::Position lengthLine, double charsPerLine) noexcept {
+	if ((lengthLine <= 0) || (charsPerLine < 1.0)) {
+		return 1;
+	}
+	const double linesWrapped = static_cast<double>(lengthLine) / charsPerLine;
+	const Sci::Position whole = static_cast<Sci::Position>(linesWrapped);
+	const Sci::Position rounded = (whole < linesWrapped) ? whole + 1 : whole;
+	return static_cast<int>(std::clamp<Sci::Position>(rounded, 1, 0x7fffffff));
+}
+
+}
+
+#endif
@@ -0,0 +1,790 @@
+// Scintilla source code edit control
+/** @file PlatHeadless.cxx
+ ** Implementation of platform facilities without a display.
+ ** Drawing goes into memory images and text is measured with a fixed model so that
+ ** painting can be benchmarked on machines without a window system.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <cmath>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+#include "DBCS.h"
+#include "UniConversion.h"
+
+#include "PlatHeadless.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace Scintilla::Internal {
+
+XYPOSITION HeadlessCharacterWidth(XYPOSITION size, bool bold, unsigned int character) noexcept {
+	const XYPOSITION width = std::max(std::round(size * 0.6), 1.0) + (bold ? 1.0 : 0.0);
+	// Approximation of the East Asian wide ranges: Hangul Jamo, CJK, Hangul syllables, fullwidth forms
+	const bool wide = ((character >= 0x1100) && (character <= 0x115F)) ||
+		((character >= 0x2E80) && (character <= 0xA4CF)) ||
+		((character >= 0xAC00) && (character <= 0xD7A3)) ||
+		((character >= 0xF900) && (character <= 0xFAFF)) ||
+		((character >= 0xFF00) && (character <= 0xFF60)) ||
+		((character >= 0x20000) && (character <= 0x3FFFD));
+	return wide ? width * 2 : width;
+}
+
+}
+
+namespace {
+
+class FontHeadless : public Font {
+public:
+	XYPOSITION size;
+	bool bold;
+	explicit FontHeadless(const FontParameters &fp) noexcept :
+		size(std::max<XYPOSITION>(fp.size, 1.0)),
+		bold(fp.weight >= FontWeight::SemiBold) {
+	}
+};
+
+const FontHeadless *HeadlessFont(const Font *font) noexcept {
+	return dynamic_cast<const FontHeadless *>(font);
+}
+
+XYPOSITION FontSize(const Font *font) noexcept {
+	const FontHeadless *pfh = HeadlessFont(font);
+	return pfh ? pfh->size : 10.0;
+}
+
+bool FontBold(const Font *font) noexcept {
+	const FontHeadless *pfh = HeadlessFont(font);
+	return pfh && pfh->bold;
+}
+
+// Iterate over the characters of text calling fn with the byte range and width of each.
+template <typename F>
+void ForEachCharacter(const Font *font, std::string_view text, int codePage, F fn) {
+	const XYPOSITION size = FontSize(font);
+	const bool bold = FontBold(font);
+	size_t i = 0;
+	while (i < text.length()) {
+		size_t lenChar = 1;
+		unsigned int character = static_cast<unsigned char>(text[i]);
+		if (codePage == CpUtf8) {
+			const int utf8Status = UTF8Classify(text.substr(i));
+			if (!(utf8Status & UTF8MaskInvalid)) {
+				lenChar = utf8Status & UTF8MaskWidth;
+				character = UnicodeFromUTF8(reinterpret_cast<const unsigned char *>(text.data() + i));
+			}
+		} else if (IsDBCSCodePage(codePage) && (i + 1 < text.length()) && DBCSIsLeadByte(codePage, text[i])) {
+			lenChar = 2;
+			// Double byte characters are treated as wide
+			character = 0x4E00;
+		}
+		fn(i, lenChar, HeadlessCharacterWidth(size, bold, character));
+		i += lenChar;
+	}
+}
+
+class SurfaceHeadless : public Surface {
+	SurfaceMode mode;
+	int width = 0;
+	int height = 0;
+	std::vector<ColourRGBA> pixels;
+	std::vector<PRectangle> clips;
+	bool initialised = false;
+
+	void SetSize(int width_, int height_);
+	[[nodiscard]] PRectangle ClipRectangle() const noexcept;
+	void FillPixels(PRectangle rc, ColourRGBA colour) noexcept;
+	void StrokeLine(Point start, Point end, Stroke stroke) noexcept;
+	void DrawTextBase(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, int codePage, ColourRGBA fore);
+	void MeasureWidthsCodePage(const Font *font_, std::string_view text, int codePage, XYPOSITION *positions);
+public:
+	SurfaceHeadless() noexcept = default;
+	SurfaceHeadless(int width_, int height_, SurfaceMode mode_);
+
+	void Init(WindowID wid) override;
+	void Init(SurfaceID sid, WindowID wid) override;
+	std::unique_ptr<Surface> AllocatePixMap(int width_, int height_) override;
+
+	void SetMode(SurfaceMode mode_) override;
+
+	void Release() noexcept override;
+	int SupportsFeature(Supports feature) noexcept override;
+	bool Initialised() override;
+	int LogPixelsY() override;
+	int PixelDivisions() override;
+	int DeviceHeightFont(int points) override;
+	void LineDraw(Point start, Point end, Stroke stroke) override;
+	void PolyLine(const Point *pts, size_t npts, Stroke stroke) override;
+	void Polygon(const Point *pts, size_t npts, FillStroke fillStroke) override;
+	void RectangleDraw(PRectangle rc, FillStroke fillStroke) override;
+	void RectangleFrame(PRectangle rc, Stroke stroke) override;
+	void FillRectangle(PRectangle rc, Fill fill) override;
+	void FillRectangleAligned(PRectangle rc, Fill fill) override;
+	void FillRectangle(PRectangle rc, Surface &surfacePattern) override;
+	void RoundedRectangle(PRectangle rc, FillStroke fillStroke) override;
+	void AlphaRectangle(PRectangle rc, XYPOSITION cornerSize, FillStroke fillStroke) override;
+	void GradientRectangle(PRectangle rc, const std::vector<ColourStop> &stops, GradientOptions options) override;
+	void DrawRGBAImage(PRectangle rc, int width_, int height_, const unsigned char *pixelsImage) override;
+	void Ellipse(PRectangle rc, FillStroke fillStroke) override;
+	void Stadium(PRectangle rc, FillStroke fillStroke, Ends ends) override;
+	void Copy(PRectangle rc, Point from, Surface &surfaceSource) override;
+
+	std::unique_ptr<IScreenLineLayout> Layout(const IScreenLine *screenLine) override;
+
+	void DrawTextNoClip(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) override;
+	void DrawTextClipped(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) override;
+	void DrawTextTransparent(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore) override;
+	void MeasureWidths(const Font *font_, std::string_view text, XYPOSITION *positions) override;
+	XYPOSITION WidthText(const Font *font_, std::string_view text) override;
+
+	void DrawTextNoClipUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) override;
+	void DrawTextClippedUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) override;
+	void DrawTextTransparentUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore) override;
+	void MeasureWidthsUTF8(const Font *font_, std::string_view text, XYPOSITION *positions) override;
+	XYPOSITION WidthTextUTF8(const Font *font_, std::string_view text) override;
+
+	XYPOSITION Ascent(const Font *font_) override;
+	XYPOSITION Descent(const Font *font_) override;
+	XYPOSITION InternalLeading(const Font *font_) override;
+	XYPOSITION Height(const Font *font_) override;
+	XYPOSITION AverageCharWidth(const Font *font_) override;
+
+	void SetClip(PRectangle rc) override;
+	void PopClip() override;
+	void FlushCachedState() override;
+	void FlushDrawing() override;
+};
+
+SurfaceHeadless::SurfaceHeadless(int width_, int height_, SurfaceMode mode_) : mode(mode_) {
+	SetSize(width_, height_);
+	initialised = true;
+}
+
+void SurfaceHeadless::SetSize(int width_, int height_) {
+	width = std::max(width_, 1);
+	height = std::max(height_, 1);
+	pixels.assign(static_cast<size_t>(width) * height, white);
+	clips.clear();
+}
+
+PRectangle SurfaceHeadless::ClipRectangle() const noexcept {
+	PRectangle rcClip(0, 0, static_cast<XYPOSITION>(width), static_cast<XYPOSITION>(height));
+	if (!clips.empty()) {
+		const PRectangle &rcTop = clips.back();
+		rcClip = PRectangle(std::max(rcClip.left, rcTop.left), std::max(rcClip.top, rcTop.top),
+			std::min(rcClip.right, rcTop.right), std::min(rcClip.bottom, rcTop.bottom));
+	}
+	return rcClip;
+}
+
+void SurfaceHeadless::FillPixels(PRectangle rc, ColourRGBA colour) noexcept {
+	if (pixels.empty() || (colour.GetAlpha() == 0)) {
+		return;
+	}
+	const PRectangle rcClip = ClipRectangle();
+	const int left = static_cast<int>(std::floor(std::max(rc.left, rcClip.left)));
+	const int top = static_cast<int>(std::floor(std::max(rc.top, rcClip.top)));
+	const int right = static_cast<int>(std::ceil(std::min(rc.right, rcClip.right)));
+	const int bottom = static_cast<int>(std::ceil(std::min(rc.bottom, rcClip.bottom)));
+	const bool opaque = colour.IsOpaque();
+	const double proportion = colour.GetAlphaComponent();
+	for (int y = top; y < bottom; y++) {
+		ColourRGBA *row = pixels.data() + static_cast<size_t>(y) * width;
+		if (opaque) {
+			std::fill(row + left, row + std::max(left, right), colour);
+		} else {
+			for (int x = left; x < right; x++) {
+				row[x] = row[x].MixedWith(colour.Opaque(), proportion);
+			}
+		}
+	}
+}
+
+void SurfaceHeadless::StrokeLine(Point start, Point end, Stroke stroke) noexcept {
+	const XYPOSITION dx = end.x - start.x;
+	const XYPOSITION dy = end.y - start.y;
+	const int steps = static_cast<int>(std::ceil(std::max(std::abs(dx), std::abs(dy))));
+	const XYPOSITION widthStroke = std::max<XYPOSITION>(stroke.width, 1.0);
+	for (int step = 0; step < steps; step++) {
+		const XYPOSITION proportion = static_cast<XYPOSITION>(step) / steps;
+		const XYPOSITION x = std::floor(start.x + dx * proportion);
+		const XYPOSITION y = std::floor(start.y + dy * proportion);
+		FillPixels(PRectangle(x, y, x + widthStroke, y + widthStroke), stroke.colour);
+	}
+}
+
+void SurfaceHeadless::Init(WindowID) {
+	Release();
+	initialised = true;
+}
+
+void SurfaceHeadless::Init(SurfaceID, WindowID wid) {
+	Release();
+	const HeadlessWindow *window = static_cast<const HeadlessWindow *>(wid);
+	if (window) {
+		SetSize(static_cast<int>(window->position.Width()), static_cast<int>(window->position.Height()));
+	}
+	initialised = true;
+}
+
+std::unique_ptr<Surface> SurfaceHeadless::AllocatePixMap(int width_, int height_) {
+	return std::make_unique<SurfaceHeadless>(width_, height_, mode);
+}
+
+void SurfaceHeadless::SetMode(SurfaceMode mode_) {
+	mode = mode_;
+}
+
+void SurfaceHeadless::Release() noexcept {
+	width = 0;
+	height = 0;
+	pixels.clear();
+	clips.clear();
+	initialised = false;
+}
+
+int SurfaceHeadless::SupportsFeature(Supports feature) noexcept {
+	switch (feature) {
+	case Supports::LineDrawsFinal:
+	case Supports::FractionalStrokeWidth:
+	case Supports::TranslucentStroke:
+	case Supports::PixelModification:
+	case Supports::ThreadSafeMeasureWidths:
+	case Supports::ThreadSafeImageSurfaces:
+		// Surfaces share no state so may be used on any thread
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+bool SurfaceHeadless::Initialised() {
+	return initialised;
+}
+
+int SurfaceHeadless::LogPixelsY() {
+	// 72 so that a point is a pixel
+	return 72;
+}
+
+int SurfaceHeadless::PixelDivisions() {
+	return 1;
+}
+
+int SurfaceHeadless::DeviceHeightFont(int points) {
+	return points * LogPixelsY() / 72;
+}
+
+void SurfaceHeadless::LineDraw(Point start, Point end, Stroke stroke) {
+	StrokeLine(start, end, stroke);
+}
+
+void SurfaceHeadless::PolyLine(const Point *pts, size_t npts, Stroke stroke) {
+	for (size_t i = 1; i < npts; i++) {
+		StrokeLine(pts[i - 1], pts[i], stroke);
+	}
+}
+
+void SurfaceHeadless::Polygon(const Point *pts, size_t npts, FillStroke fillStroke) {
+	if (npts == 0) {
+		return;
+	}
+	// Fill the bounding box which costs about the same as filling the shape
+	PRectangle rcBounds(pts[0].x, pts[0].y, pts[0].x, pts[0].y);
+	for (size_t i = 1; i < npts; i++) {
+		rcBounds.left = std::min(rcBounds.left, pts[i].x);
+		rcBounds.top = std::min(rcBounds.top, pts[i].y);
+		rcBounds.right = std::max(rcBounds.right, pts[i].x);
+		rcBounds.bottom = std::max(rcBounds.bottom, pts[i].y);
+	}
+	FillPixels(rcBounds, fillStroke.fill.colour);
+	PolyLine(pts, npts, fillStroke.stroke);
+	StrokeLine(pts[npts - 1], pts[0], fillStroke.stroke);
+}
+
+void SurfaceHeadless::RectangleDraw(PRectangle rc, FillStroke fillStroke) {
+	FillPixels(rc.Inset(fillStroke.stroke.width), fillStroke.fill.colour);
+	RectangleFrame(rc, fillStroke.stroke);
+}
+
+void SurfaceHeadless::RectangleFrame(PRectangle rc, Stroke stroke) {
+	const XYPOSITION widthStroke = stroke.width;
+	FillPixels(PRectangle(rc.left, rc.top, rc.right, rc.top + widthStroke), stroke.colour);
+	FillPixels(PRectangle(rc.left, rc.bottom - widthStroke, rc.right, rc.bottom), stroke.colour);
+	FillPixels(PRectangle(rc.left, rc.top + widthStroke, rc.left + widthStroke, rc.bottom - widthStroke), stroke.colour);
+	FillPixels(PRectangle(rc.right - widthStroke, rc.top + widthStroke, rc.right, rc.bottom - widthStroke), stroke.colour);
+}
+
+void SurfaceHeadless::FillRectangle(PRectangle rc, Fill fill) {
+	FillPixels(rc, fill.colour);
+}
+
+void SurfaceHeadless::FillRectangleAligned(PRectangle rc, Fill fill) {
+	FillPixels(PixelAlign(rc, 1), fill.colour);
+}
+
+void SurfaceHeadless::FillRectangle(PRectangle rc, Surface &surfacePattern) {
+	SurfaceHeadless *pattern = dynamic_cast<SurfaceHeadless *>(&surfacePattern);
+	if (!pattern || pattern->pixels.empty()) {
+		FillPixels(rc, black);
+		return;
+	}
+	// Tile the pattern starting from the top left of the rectangle
+	for (XYPOSITION y = rc.top; y < rc.bottom; y += pattern->height) {
+		for (XYPOSITION x = rc.left; x < rc.right; x += pattern->width) {
+			const PRectangle rcTile(x, y, std::min(x + pattern->width, rc.right), std::min(y + pattern->height, rc.bottom));
+			Copy(rcTile, Point(0, 0), *pattern);
+		}
+	}
+}
+
+void SurfaceHeadless::RoundedRectangle(PRectangle rc, FillStroke fillStroke) {
+	RectangleDraw(rc, fillStroke);
+}
+
+void SurfaceHeadless::AlphaRectangle(PRectangle rc, XYPOSITION, FillStroke fillStroke) {
+	RectangleDraw(rc, fillStroke);
+}
+
+void SurfaceHeadless::GradientRectangle(PRectangle rc, const std::vector<ColourStop> &stops, GradientOptions) {
+	if (!stops.empty()) {
+		FillPixels(rc, stops.front().colour.MixedWith(stops.back().colour));
+	}
+}
+
+void SurfaceHeadless::DrawRGBAImage(PRectangle rc, int width_, int height_, const unsigned char *pixelsImage) {
+	const PRectangle rcClip = ClipRectangle();
+	const int xOrigin = static_cast<int>(std::floor(rc.left + (rc.Width() - width_) / 2));
+	const int yOrigin = static_cast<int>(std::floor(rc.top + (rc.Height() - height_) / 2));
+	for (int y = 0; y < height_; y++) {
+		for (int x = 0; x < width_; x++) {
+			const unsigned char *pixel = pixelsImage + (static_cast<size_t>(y) * width_ + x) * 4;
+			const int xDest = xOrigin + x;
+			const int yDest = yOrigin + y;
+			if ((xDest >= rcClip.left) && (xDest < rcClip.right) && (yDest >= rcClip.top) && (yDest < rcClip.bottom)) {
+				FillPixels(PRectangle::FromInts(xDest, yDest, xDest + 1, yDest + 1),
+					ColourRGBA(pixel[0], pixel[1], pixel[2], pixel[3]));
+			}
+		}
+	}
+}
+
+void SurfaceHeadless::Ellipse(PRectangle rc, FillStroke fillStroke) {
+	RectangleDraw(rc, fillStroke);
+}
+
+void SurfaceHeadless::Stadium(PRectangle rc, FillStroke fillStroke, Ends) {
+	RectangleDraw(rc, fillStroke);
+}
+
+void SurfaceHeadless::Copy(PRectangle rc, Point from, Surface &surfaceSource) {
+	const SurfaceHeadless *source = dynamic_cast<const SurfaceHeadless *>(&surfaceSource);
+	if (!source || source->pixels.empty() || pixels.empty()) {
+		return;
+	}
+	const PRectangle rcClip = ClipRectangle();
+	const int left = static_cast<int>(std::max(rc.left, rcClip.left));
+	const int top = static_cast<int>(std::max(rc.top, rcClip.top));
+	const int right = static_cast<int>(std::min(rc.right, rcClip.right));
+	const int bottom = static_cast<int>(std::min(rc.bottom, rcClip.bottom));
+	const int xOffset = static_cast<int>(from.x - rc.left);
+	const int yOffset = static_cast<int>(from.y - rc.top);
+	for (int y = top; y < bottom; y++) {
+		const int ySource = y + yOffset;
+		if ((ySource < 0) || (ySource >= source->height)) {
+			continue;
+		}
+		const int xSourceStart = std::clamp(left + xOffset, 0, source->width);
+		const int xSourceEnd = std::clamp(right + xOffset, 0, source->width);
+		if (xSourceStart < xSourceEnd) {
+			const ColourRGBA *rowSource = source->pixels.data() + static_cast<size_t>(ySource) * source->width;
+			std::copy(rowSource + xSourceStart, rowSource + xSourceEnd,
+				pixels.data() + static_cast<size_t>(y) * width + (xSourceStart - xOffset));
+		}
+	}
+}
+
+std::unique_ptr<IScreenLineLayout> SurfaceHeadless::Layout(const IScreenLine *) {
+	// Bidirectional text is not supported
+	return {};
+}
+
+void SurfaceHeadless::DrawTextBase(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, int codePage, ColourRGBA fore) {
+	// Each glyph is drawn as a vertical bar so that drawing cost follows the amount of text
+	const XYPOSITION top = ybase - std::round(Ascent(font_) * 0.6);
+	XYPOSITION x = rc.left;
+	ForEachCharacter(font_, text, codePage, [&](size_t start, size_t, XYPOSITION widthCharacter) {
+		if (text[start] != ' ') {
+			FillPixels(PRectangle(x + 1, top, x + std::max<XYPOSITION>(widthCharacter - 1, 2), ybase), fore);
+		}
+		x += widthCharacter;
+	});
+}
+
+void SurfaceHeadless::DrawTextNoClip(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) {
+	FillPixels(rc, back);
+	DrawTextBase(rc, font_, ybase, text, mode.codePage, fore);
+}
+
+void SurfaceHeadless::DrawTextClipped(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) {
+	FillPixels(rc, back);
+	SetClip(rc);
+	DrawTextBase(rc, font_, ybase, text, mode.codePage, fore);
+	PopClip();
+}
+
+void SurfaceHeadless::DrawTextTransparent(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore) {
+	DrawTextBase(rc, font_, ybase, text, mode.codePage, fore);
+}
+
+void SurfaceHeadless::MeasureWidthsCodePage(const Font *font_, std::string_view text, int codePage, XYPOSITION *positions) {
+	// All bytes of a character are given the position of the end of that character
+	XYPOSITION x = 0;
+	ForEachCharacter(font_, text, codePage, [&](size_t start, size_t lenChar, XYPOSITION widthCharacter) {
+		x += widthCharacter;
+		std::fill(positions + start, positions + start + lenChar, x);
+	});
+}
+
+void SurfaceHeadless::MeasureWidths(const Font *font_, std::string_view text, XYPOSITION *positions) {
+	MeasureWidthsCodePage(font_, text, mode.codePage, positions);
+}
+
+XYPOSITION SurfaceHeadless::WidthText(const Font *font_, std::string_view text) {
+	XYPOSITION width_ = 0;
+	ForEachCharacter(font_, text, mode.codePage, [&](size_t, size_t, XYPOSITION widthCharacter) {
+		width_ += widthCharacter;
+	});
+	return width_;
+}
+
+void SurfaceHeadless::DrawTextNoClipUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) {
+	FillPixels(rc, back);
+	DrawTextBase(rc, font_, ybase, text, CpUtf8, fore);
+}
+
+void SurfaceHeadless::DrawTextClippedUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore, ColourRGBA back) {
+	FillPixels(rc, back);
+	SetClip(rc);
+	DrawTextBase(rc, font_, ybase, text, CpUtf8, fore);
+	PopClip();
+}
+
+void SurfaceHeadless::DrawTextTransparentUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, ColourRGBA fore) {
+	DrawTextBase(rc, font_, ybase, text, CpUtf8, fore);
+}
+
+void SurfaceHeadless::MeasureWidthsUTF8(const Font *font_, std::string_view text, XYPOSITION *positions) {
+	MeasureWidthsCodePage(font_, text, CpUtf8, positions);
+}
+
+XYPOSITION SurfaceHeadless::WidthTextUTF8(const Font *font_, std::string_view text) {
+	XYPOSITION width_ = 0;
+	ForEachCharacter(font_, text, CpUtf8, [&](size_t, size_t, XYPOSITION widthCharacter) {
+		width_ += widthCharacter;
+	});
+	return width_;
+}
+
+XYPOSITION SurfaceHeadless::Ascent(const Font *font_) {
+	return std::round(FontSize(font_) * 0.8);
+}
+
+XYPOSITION SurfaceHeadless::Descent(const Font *font_) {
+	return std::round(FontSize(font_) * 0.2) + 1;
+}
+
+XYPOSITION SurfaceHeadless::InternalLeading(const Font *font_) {
+	return std::round(FontSize(font_) * 0.1);
+}
+
+XYPOSITION SurfaceHeadless::Height(const Font *font_) {
+	return Ascent(font_) + Descent(font_);
+}
+
+XYPOSITION SurfaceHeadless::AverageCharWidth(const Font *font_) {
+	return HeadlessCharacterWidth(FontSize(font_), FontBold(font_), 'n');
+}
+
+void SurfaceHeadless::SetClip(PRectangle rc) {
+	const PRectangle rcClip = ClipRectangle();
+	clips.emplace_back(std::max(rc.left, rcClip.left), std::max(rc.top, rcClip.top),
+		std::min(rc.right, rcClip.right), std::min(rc.bottom, rcClip.bottom));
+}
+
+void SurfaceHeadless::PopClip() {
+	if (!clips.empty()) {
+		clips.pop_back();
+	}
+}
+
+void SurfaceHeadless::FlushCachedState() {
+}
+
+void SurfaceHeadless::FlushDrawing() {
+}
+
+HeadlessWindow *HeadlessFromWindow(WindowID wid) noexcept {
+	return static_cast<HeadlessWindow *>(wid);
+}
+
+}
+
+std::shared_ptr<Font> Font::Allocate(const FontParameters &fp) {
+	return std::make_shared<FontHeadless>(fp);
+}
+
+std::unique_ptr<Surface> Surface::Allocate(Technology) {
+	return std::make_unique<SurfaceHeadless>();
+}
+
+Window::~Window() noexcept {
+}
+
+void Window::Destroy() noexcept {
+	wid = nullptr;
+}
+
+PRectangle Window::GetPosition() const {
+	const HeadlessWindow *window = HeadlessFromWindow(wid);
+	return window ? window->position : PRectangle(0, 0, 1000, 1000);
+}
+
+void Window::SetPosition(PRectangle rc) {
+	HeadlessWindow *window = HeadlessFromWindow(wid);
+	if (window) {
+		window->position = rc;
+	}
+}
+
+void Window::SetPositionRelative(PRectangle rc, const Window *relativeTo) {
+	const PRectangle rcOther = relativeTo->GetPosition();
+	rc.Move(rcOther.left, rcOther.top);
+	SetPosition(rc);
+}
+
+PRectangle Window::GetClientPosition() const {
+	const PRectangle rc = GetPosition();
+	return PRectangle(0, 0, rc.Width(), rc.Height());
+}
+
+void Window::Show(bool show) {
+	HeadlessWindow *window = HeadlessFromWindow(wid);
+	if (window) {
+		window->visible = show;
+	}
+}
+
+void Window::InvalidateAll() {
+	HeadlessWindow *window = HeadlessFromWindow(wid);
+	if (window) {
+		window->invalidations++;
+	}
+}
+
+void Window::InvalidateRectangle(PRectangle) {
+	InvalidateAll();
+}
+
+void Window::SetCursor(Cursor curs) {
+	cursorLast = curs;
+}
+
+PRectangle Window::GetMonitorRect(Point) {
+	return PRectangle(0, 0, 4000, 4000);
+}
+
+namespace {
+
+/**
+ * List box that holds its items without displaying them.
+ */
+class ListBoxHeadless : public ListBox {
+	HeadlessWindow window;
+	std::vector<std::string> items;
+	int selection = -1;
+	int visibleRows = 5;
+	int lineHeight = 10;
+	int aveCharWidth = 8;
+	IListBoxDelegate *delegate = nullptr;
+public:
+	ListBoxHeadless() noexcept {
+		wid = &window;
+	}
+	void SetFont(const Font *) override {
+	}
+	void Create(Window &, int, Point location, int lineHeight_, bool, Technology) override {
+		lineHeight = lineHeight_;
+		window.position = PRectangle(location.x, location.y, location.x + 100, location.y + 100);
+	}
+	void SetAverageCharWidth(int width) override {
+		aveCharWidth = width;
+	}
+	void SetVisibleRows(int rows) override {
+		visibleRows = rows;
+	}
+	int GetVisibleRows() const override {
+		return visibleRows;
+	}
+	PRectangle GetDesiredRect() override {
+		size_t widthMax = 12;
+		for (const std::string &item : items) {
+			widthMax = std::max(widthMax, item.length());
+		}
+		const int rows = std::min(visibleRows, Length());
+		return PRectangle::FromInts(0, 0, static_cast<int>(widthMax) * aveCharWidth, rows * lineHeight);
+	}
+	int CaretFromEdge() override {
+		return 0;
+	}
+	void Clear() noexcept override {
+		items.clear();
+		selection = -1;
+	}
+	void Append(char *s, int = -1) override {
+		items.emplace_back(s);
+	}
+	int Length() override {
+		return static_cast<int>(items.size());
+	}
+	void Select(int n) override {
+		selection = n;
+		if (delegate) {
+			ListBoxEvent event(ListBoxEvent::EventType::selectionChange);
+			delegate->ListNotify(&event);
+		}
+	}
+	int GetSelection() override {
+		return selection;
+	}
+	int Find(const char *prefix) override {
+		const std::string_view svPrefix(prefix);
+		for (size_t i = 0; i < items.size(); i++) {
+			if (items[i].compare(0, svPrefix.length(), svPrefix) == 0) {
+				return static_cast<int>(i);
+			}
+		}
+		return -1;
+	}
+	std::string GetValue(int n) override {
+		if ((n < 0) || (static_cast<size_t>(n) >= items.size())) {
+			return {};
+		}
+		return items[n];
+	}
+	void RegisterImage(int, const char *) override {
+	}
+	void RegisterRGBAImage(int, int, int, const unsigned char *) override {
+	}
+	void ClearRegisteredImages() override {
+	}
+	void SetDelegate(IListBoxDelegate *lbDelegate) override {
+		delegate = lbDelegate;
+	}
+	void SetList(const char *list, char separator, char typesep) override {
+		Clear();
+		std::string_view remaining(list);
+		while (!remaining.empty()) {
+			const size_t end = remaining.find(separator);
+			std::string_view item = remaining.substr(0, end);
+			const size_t type = item.find(typesep);
+			if (type != std::string_view::npos) {
+				item = item.substr(0, type);
+			}
+			items.emplace_back(item);
+			if (end == std::string_view::npos) {
+				break;
+			}
+			remaining.remove_prefix(end + 1);
+		}
+	}
+	void SetOptions(ListOptions) override {
+	}
+};
+
+}
+
+ListBox::ListBox() noexcept {
+}
+
+ListBox::~ListBox() noexcept {
+}
+
+std::unique_ptr<ListBox> ListBox::Allocate() {
+	return std::make_unique<ListBoxHeadless>();
+}
+
+Menu::Menu() noexcept : mid(nullptr) {
+}
+
+void Menu::CreatePopUp() {
+}
+
+void Menu::Destroy() noexcept {
+	mid = nullptr;
+}
+
+void Menu::Show(Point, const Window &) {
+}
+
+ColourRGBA Platform::Chrome() {
+	return ColourRGBA(0xe0, 0xe0, 0xe0);
+}
+
+ColourRGBA Platform::ChromeHighlight() {
+	return ColourRGBA(0xff, 0xff, 0xff);
+}
+
+const char *Platform::DefaultFont() {
+	return "Headless";
+}
+
+int Platform::DefaultFontSize() {
+	return 10;
+}
+
+unsigned int Platform::DoubleClickTime() {
+	return 500;
+}
+
+void Platform::DebugDisplay(const char *s) noexcept {
+	fprintf(stderr, "%s", s);
+}
+
+void Platform::DebugPrintf(const char *format, ...) noexcept {
+	char buffer[2000];
+	va_list pArguments;
+	va_start(pArguments, format);
+	vsnprintf(buffer, std::size(buffer), format, pArguments);
+	va_end(pArguments);
+	Platform::DebugDisplay(buffer);
+}
+
+bool Platform::ShowAssertionPopUps(bool) noexcept {
+	return false;
+}
+
+void Platform::Assert(const char *c, const char *file, int line) noexcept {
+	fprintf(stderr, "Assertion [%s] failed at %s %d\n", c, file, line);
+	abort();
+}
@@ -0,0 +1,31 @@
+// Scintilla source code edit control
+/** @file PlatHeadless.h
+ ** Platform layer that draws into memory so Scintilla can be exercised without a display.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef PLATHEADLESS_H
+#define PLATHEADLESS_H
+
+namespace Scintilla::Internal {
+
+/**
+ * The WindowID of a headless window points to one of these.
+ * There is no window system so position and visibility are just recorded.
+ */
+struct HeadlessWindow {
+	PRectangle position;
+	bool visible = false;
+	size_t invalidations = 0;
+};
+
+/**
+ * Text is measured with a fixed model instead of real fonts so results are the same on every machine:
+ * each character is 0.6 of the font size wide, rounded, with wide East Asian characters taking double that.
+ */
+XYPOSITION HeadlessCharacterWidth(XYPOSITION size, bool bold, unsigned int character) noexcept;
+
+}
+
+#endif
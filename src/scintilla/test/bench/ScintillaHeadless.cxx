@@ -0,0 +1,197 @@
+// Scintilla source code edit control
+/** @file ScintillaHeadless.cxx
+ ** Scintilla editor without a window, driven directly by messages and painted into memory.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+#include "ScintillaMessages.h"
+#include "ScintillaStructures.h"
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+#include "CharacterCategoryMap.h"
+#include "Position.h"
+#include "UniqueString.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "ContractionState.h"
+#include "CellBuffer.h"
+#include "CallTip.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "CaseConvert.h"
+#include "UniConversion.h"
+#include "Selection.h"
+#include "PositionCache.h"
+#include "EditModel.h"
+#include "MarginView.h"
+#include "EditView.h"
+#include "WrapPending.h"
+#include "Editor.h"
+#include "AutoComplete.h"
+#include "ScintillaBase.h"
+
+#include "PlatHeadless.h"
+#include "ScintillaHeadless.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+ScintillaHeadless::ScintillaHeadless(int width, int height) {
+	window.position = PRectangle::FromInts(0, 0, width, height);
+	window.visible = true;
+	wMain = &window;
+	Initialise();
+}
+
+ScintillaHeadless::~ScintillaHeadless() {
+	Finalise();
+}
+
+void ScintillaHeadless::Initialise() {
+	// There is no window system so nothing to connect to
+}
+
+void ScintillaHeadless::SetVerticalScrollPos() {
+}
+
+void ScintillaHeadless::SetHorizontalScrollPos() {
+}
+
+bool ScintillaHeadless::ModifyScrollBars(Sci::Line, Sci::Line) {
+	return false;
+}
+
+void ScintillaHeadless::Copy() {
+	if (!sel.Empty()) {
+		SelectionText selectedText;
+		CopySelectionRange(&selectedText);
+		CopyToClipboard(selectedText);
+	}
+}
+
+void ScintillaHeadless::Paste() {
+	UndoGroup ug(pdoc);
+	ClearSelection(multiPasteMode == MultiPaste::Each);
+	InsertPasteShape(clipboard.c_str(), clipboard.length(), PasteShape::stream);
+	EnsureCaretVisible();
+}
+
+void ScintillaHeadless::ClaimSelection() {
+}
+
+void ScintillaHeadless::NotifyChange() {
+}
+
+void ScintillaHeadless::NotifyParent(NotificationData) {
+	// No container to receive notifications
+}
+
+void ScintillaHeadless::CopyToClipboard(const SelectionText &selectedText) {
+	clipboard.assign(selectedText.Data(), selectedText.Length());
+}
+
+bool ScintillaHeadless::SetIdle(bool on) {
+	idleRequested = on;
+	return true;
+}
+
+void ScintillaHeadless::SetMouseCapture(bool) {
+}
+
+bool ScintillaHeadless::HaveMouseCapture() {
+	return false;
+}
+
+std::string ScintillaHeadless::UTF8FromEncoded(std::string_view encoded) const {
+	// Only UTF-8 and ASCII documents are benchmarked so no conversion is needed
+	return std::string(encoded);
+}
+
+std::string ScintillaHeadless::EncodedFromUTF8(std::string_view utf8) const {
+	return std::string(utf8);
+}
+
+sptr_t ScintillaHeadless::DefWndProc(Message, uptr_t, sptr_t) {
+	return 0;
+}
+
+void ScintillaHeadless::CreateCallTipWindow(PRectangle rc) {
+	windowCallTip.position = rc;
+	ct.wCallTip = &windowCallTip;
+}
+
+void ScintillaHeadless::AddToPopUp(const char *, int, bool) {
+}
+
+sptr_t ScintillaHeadless::Send(Message iMessage, uptr_t wParam, sptr_t lParam) {
+	return WndProc(iMessage, wParam, lParam);
+}
+
+void ScintillaHeadless::Resize(int width, int height) {
+	window.position = PRectangle::FromInts(0, 0, width, height);
+	ChangeSize();
+}
+
+void ScintillaHeadless::PaintWindow() {
+	const PRectangle rcClient = GetClientRectangle();
+	// Painting is abandoned when styling changes the area to paint so retry a limited number of times
+	for (int attempt = 0; attempt < 3; attempt++) {
+		paintState = PaintState::painting;
+		rcPaint = rcClient;
+		paintingAllText = true;
+		std::unique_ptr<Surface> surfaceWindow = CreateDrawingSurface(nullptr);
+		Paint(surfaceWindow.get(), rcPaint);
+		surfaceWindow->Release();
+		const bool abandoned = paintState == PaintState::abandoned;
+		paintState = PaintState::notPainting;
+		if (!abandoned) {
+			break;
+		}
+	}
+}
+
+void ScintillaHeadless::Type(std::string_view text) {
+	InsertCharacter(text, CharacterSource::DirectInput);
+}
+
+size_t ScintillaHeadless::IdleUntilDone() {
+	size_t calls = 0;
+	while (idleRequested) {
+		idleRequested = Idle();
+		calls++;
+	}
+	return calls;
+}
@@ -0,0 +1,60 @@
+// Scintilla source code edit control
+/** @file ScintillaHeadless.h
+ ** Scintilla editor without a window, driven directly by messages and painted into memory.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef SCINTILLAHEADLESS_H
+#define SCINTILLAHEADLESS_H
+
+namespace Scintilla::Internal {
+
+class ScintillaHeadless : public ScintillaBase {
+	HeadlessWindow window;
+	HeadlessWindow windowCallTip;
+	bool idleRequested = false;
+	std::string clipboard;
+
+	void Initialise() override;
+	void SetVerticalScrollPos() override;
+	void SetHorizontalScrollPos() override;
+	bool ModifyScrollBars(Sci::Line nMax, Sci::Line nPage) override;
+	void Copy() override;
+	void Paste() override;
+	void ClaimSelection() override;
+	void NotifyChange() override;
+	void NotifyParent(Scintilla::NotificationData scn) override;
+	void CopyToClipboard(const SelectionText &selectedText) override;
+	bool SetIdle(bool on) override;
+	void SetMouseCapture(bool on) override;
+	bool HaveMouseCapture() override;
+	std::string UTF8FromEncoded(std::string_view encoded) const override;
+	std::string EncodedFromUTF8(std::string_view utf8) const override;
+	Scintilla::sptr_t DefWndProc(Scintilla::Message iMessage, Scintilla::uptr_t wParam, Scintilla::sptr_t lParam) override;
+	void CreateCallTipWindow(PRectangle rc) override;
+	void AddToPopUp(const char *label, int cmd=0, bool enabled=true) override;
+
+public:
+	ScintillaHeadless(int width, int height);
+	// Deleted so ScintillaHeadless objects can not be copied.
+	ScintillaHeadless(const ScintillaHeadless &) = delete;
+	ScintillaHeadless(ScintillaHeadless &&) = delete;
+	ScintillaHeadless &operator=(const ScintillaHeadless &) = delete;
+	ScintillaHeadless &operator=(ScintillaHeadless &&) = delete;
+	~ScintillaHeadless() override;
+
+	Scintilla::sptr_t Send(Scintilla::Message iMessage, Scintilla::uptr_t wParam=0, Scintilla::sptr_t lParam=0);
+	void Resize(int width, int height);
+	// Paint the whole window into an image, repeating when painting was abandoned for styling.
+	void PaintWindow();
+	// Insert text at each caret as if typed.
+	void Type(std::string_view text);
+	// Run idle work such as background wrapping until there is none left.
+	// Returns the number of idle calls made.
+	size_t IdleUntilDone();
+};
+
+}
+
+#endif
@@ -0,0 +1,414 @@
+// Scintilla source code edit control
+/** @file bench.cxx
+ ** Benchmark loading, lexing, wrapping and painting documents without a display.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+
+#include "ScintillaTypes.h"
+#include "ScintillaMessages.h"
+#include "ScintillaStructures.h"
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Lexilla.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+#include "CharacterCategoryMap.h"
+#include "Position.h"
+#include "UniqueString.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "ContractionState.h"
+#include "CellBuffer.h"
+#include "CallTip.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "CaseConvert.h"
+#include "UniConversion.h"
+#include "Selection.h"
+#include "PositionCache.h"
+#include "EditModel.h"
+#include "MarginView.h"
+#include "EditView.h"
+#include "WrapPending.h"
+#include "Editor.h"
+#include "AutoComplete.h"
+#include "ScintillaBase.h"
+#include "ElapsedPeriod.h"
+
+#include "PlatHeadless.h"
+#include "ScintillaHeadless.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+struct Options {
+	int width = 1200;
+	int height = 900;
+	int frames = 200;
+	std::string lexer;
+	bool wrap = false;
+	bool fold = false;
+	int markers = 0;
+	int scattered = 0;
+	int columnEdit = 0;
+	bool linesTree = false;
+	bool wrapEstimate = false;
+	int layoutThreads = 1;
+	int paintThreads = 1;
+	std::vector<std::string> files;
+};
+
+constexpr const char *measureNames[] = {
+	"frame",
+	"style",
+	"wrap",
+	"layout",
+	"margin",
+	"back",
+	"indicators back",
+	"text",
+	"indentation guides",
+	"indicators fore",
+	"selection translucent",
+	"line translucent",
+	"fold lines",
+	"carets",
+	"lines",
+	"position cache hits",
+	"position cache misses",
+};
+
+void Usage() {
+	fprintf(stderr,
+		"Usage: bench [options] file...\n"
+		"  -lexer name          lexer to apply, such as cpp or xml\n"
+		"  -size width height   window size in pixels, default 1200 900\n"
+		"  -frames n            number of pages to scroll and paint, default 200\n"
+		"  -wrap                wrap lines at word boundaries\n"
+		"  -fold                time contracting and expanding all folds\n"
+		"  -markers n           time adding, finding and removing n markers\n"
+		"  -scattered n         time n line insertions alternating between distant lines\n"
+		"  -columnedit n        time typing and deleting with a caret on each of n lines\n"
+		"  -linestree           hold line positions in a tree (SC_DOCUMENTOPTION_LINES_TREE)\n"
+		"  -estimate            estimate heights of lines not yet wrapped\n"
+		"  -layoutthreads n     threads used for layout, default 1\n"
+		"  -paintthreads n      threads used for painting, default 1\n");
+}
+
+std::optional<Options> ParseArguments(int argc, char *argv[]) {
+	Options options;
+	for (int i = 1; i < argc; i++) {
+		const std::string_view arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if ((arg == "-lexer") && hasValue) {
+			options.lexer = argv[++i];
+		} else if ((arg == "-size") && (i + 2 < argc)) {
+			options.width = std::atoi(argv[++i]);
+			options.height = std::atoi(argv[++i]);
+		} else if ((arg == "-frames") && hasValue) {
+			options.frames = std::atoi(argv[++i]);
+		} else if (arg == "-wrap") {
+			options.wrap = true;
+		} else if (arg == "-fold") {
+			options.fold = true;
+		} else if ((arg == "-markers") && hasValue) {
+			options.markers = std::atoi(argv[++i]);
+		} else if ((arg == "-scattered") && hasValue) {
+			options.scattered = std::atoi(argv[++i]);
+		} else if ((arg == "-columnedit") && hasValue) {
+			options.columnEdit = std::atoi(argv[++i]);
+		} else if (arg == "-linestree") {
+			options.linesTree = true;
+		} else if (arg == "-estimate") {
+			options.wrapEstimate = true;
+		} else if ((arg == "-layoutthreads") && hasValue) {
+			options.layoutThreads = std::atoi(argv[++i]);
+		} else if ((arg == "-paintthreads") && hasValue) {
+			options.paintThreads = std::atoi(argv[++i]);
+		} else if (!arg.empty() && arg[0] == '-') {
+			return {};
+		} else {
+			options.files.emplace_back(arg);
+		}
+	}
+	if (options.files.empty() || (options.width <= 0) || (options.height <= 0) || (options.frames <= 0)) {
+		return {};
+	}
+	return options;
+}
+
+// Give each style a different appearance so that lexing affects painting.
+void SetStyles(ScintillaHeadless &sci) {
+	constexpr uptr_t styleDefault = static_cast<uptr_t>(StylesCommon::Default);
+	sci.Send(Message::StyleSetFont, styleDefault, reinterpret_cast<sptr_t>("Headless"));
+	sci.Send(Message::StyleSetSize, styleDefault, 10);
+	sci.Send(Message::StyleClearAll);
+	for (uptr_t style = 0; style < styleDefault; style++) {
+		const sptr_t colour = (style * 0x3F1D5) & 0xC0C0C0;
+		sci.Send(Message::StyleSetFore, style, colour);
+		sci.Send(Message::StyleSetBold, style, (style % 5) == 1);
+	}
+	sci.Send(Message::SetMarginTypeN, 0, static_cast<sptr_t>(MarginType::Number));
+	sci.Send(Message::SetMarginWidthN, 0, 50);
+	sci.Send(Message::SetMarginWidthN, 2, 16);
+}
+
+void PrintDuration(const char *phase, double duration) {
+	printf("  %-24s %10.3f ms\n", phase, duration * 1000.0);
+}
+
+// Spread markers evenly through the document then navigate between them as bookmarks do.
+void TimeMarkers(ScintillaHeadless &sci, int markers) {
+	constexpr uptr_t markerBookmark = 1;
+	constexpr sptr_t maskBookmark = 1 << markerBookmark;
+	const Sci::Line lines = sci.Send(Message::GetLineCount);
+	const Sci::Line spacing = std::max<Sci::Line>(lines / markers, 1);
+	std::vector<int> handles;
+	ElapsedPeriod epMarkers;
+	for (Sci::Line line = spacing / 2; line < lines; line += spacing) {
+		handles.push_back(static_cast<int>(sci.Send(Message::MarkerAdd, line, markerBookmark)));
+	}
+	PrintDuration("marker add", epMarkers.Duration(true));
+	size_t found = 0;
+	for (Sci::Line line = sci.Send(Message::MarkerNext, 0, maskBookmark); line >= 0;
+		line = sci.Send(Message::MarkerNext, line + 1, maskBookmark)) {
+		found++;
+	}
+	PrintDuration("marker next all", epMarkers.Duration(true));
+	for (Sci::Line line = sci.Send(Message::MarkerPrevious, lines, maskBookmark); line >= 0;
+		line = sci.Send(Message::MarkerPrevious, line - 1, maskBookmark)) {
+		found++;
+	}
+	PrintDuration("marker previous all", epMarkers.Duration(true));
+	for (const int handle : handles) {
+		found += sci.Send(Message::MarkerLineFromHandle, handle) >= 0;
+	}
+	PrintDuration("marker line from handle", epMarkers.Duration(true));
+	// Each insertion moves the following markers so searching after the edit has to reindex
+	const Sci::Line lineEdit = lines / 2;
+	const sptr_t positionEdit = sci.Send(Message::PositionFromLine, lineEdit);
+	for (int edit = 0; edit < 100; edit++) {
+		sci.Send(Message::InsertText, positionEdit, reinterpret_cast<sptr_t>("\n"));
+		found += sci.Send(Message::MarkerNext, lineEdit, maskBookmark) >= 0;
+		found += sci.Send(Message::MarkerPrevious, lineEdit, maskBookmark) >= 0;
+	}
+	PrintDuration("marker insert and next", epMarkers.Duration(true));
+	sci.Send(Message::Undo);
+	sci.Send(Message::MarkerDeleteAll, markerBookmark);
+	PrintDuration("marker delete all", epMarkers.Duration(true));
+	printf("  %-24s %10zu\n", "markers found", found);
+}
+
+// Insert and then remove lines alternately near the start and end of the document as
+// multiple selections and replace all do.
+void TimeScatteredEdits(ScintillaHeadless &sci, int edits) {
+	const Sci::Line lines = sci.Send(Message::GetLineCount);
+	Sci::Line total = 0;
+	ElapsedPeriod epEdits;
+	for (int edit = 0; edit < edits; edit++) {
+		const Sci::Line line = (edit % 2) ? (lines / 10 + edit % 97) : (lines * 9 / 10 - edit % 89);
+		sci.Send(Message::InsertText, sci.Send(Message::PositionFromLine, line), reinterpret_cast<sptr_t>("x\n"));
+		total += sci.Send(Message::LineFromPosition, sci.Send(Message::GetLength) / 2);
+	}
+	PrintDuration("scattered insert", epEdits.Duration(true));
+	for (int edit = 0; edit < edits; edit++) {
+		const Sci::Line line = (edit % 2) ? (lines / 10 + edit % 97) : (lines * 9 / 10 - edit % 89);
+		sci.Send(Message::DeleteRange, sci.Send(Message::PositionFromLine, line), 2);
+		total += sci.Send(Message::LineFromPosition, sci.Send(Message::GetLength) / 2);
+	}
+	PrintDuration("scattered delete", epEdits.Duration(true));
+	printf("  %-24s %10lld\n", "line total", static_cast<long long>(total));
+}
+
+// Type and then delete at the start of many lines with a thin rectangular selection.
+void TimeColumnEdit(ScintillaHeadless &sci, int lines) {
+	constexpr int characters = 10;
+	const Sci::Line lineLast = std::min<Sci::Line>(lines, sci.Send(Message::GetLineCount)) - 1;
+	sci.Send(Message::SetAdditionalSelectionTyping, 1);
+	sci.Send(Message::SetRectangularSelectionAnchor, 0);
+	sci.Send(Message::SetRectangularSelectionCaret, sci.Send(Message::PositionFromLine, lineLast));
+	printf("  %-24s %10lld\n", "carets", static_cast<long long>(sci.Send(Message::GetSelections)));
+	ElapsedPeriod epEdit;
+	for (int ch = 0; ch < characters; ch++) {
+		sci.Type("x");
+	}
+	PrintDuration("column type", epEdit.Duration(true));
+	for (int ch = 0; ch < characters; ch++) {
+		sci.Send(Message::DeleteBack);
+	}
+	PrintDuration("column delete back", epEdit.Duration(true));
+	for (int ch = 0; ch < characters * 2; ch++) {
+		sci.Send(Message::Undo);
+	}
+	PrintDuration("column undo", epEdit.Duration(true));
+	sci.Send(Message::SetEmptySelection, 0);
+}
+
+bool RunFile(const Options &options, const std::string &path) {
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs) {
+		fprintf(stderr, "Can not open %s\n", path.c_str());
+		return false;
+	}
+	const std::string text((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	ScintillaHeadless sci(options.width, options.height);
+	if (options.linesTree) {
+		const sptr_t doc = sci.Send(Message::CreateDocument, text.length(),
+			static_cast<sptr_t>(DocumentOption::LinesTree));
+		sci.Send(Message::SetDocPointer, 0, doc);
+		sci.Send(Message::ReleaseDocument, 0, doc);
+	}
+	sci.Send(Message::SetCodePage, CpUtf8);
+	sci.Send(Message::SetLayoutThreads, options.layoutThreads);
+	sci.Send(Message::SetPaintThreads, options.paintThreads);
+	sci.Send(Message::SetWrapEstimate, options.wrapEstimate);
+	sci.Send(Message::SetProfileSize, options.frames);
+	SetStyles(sci);
+
+	printf("%s: %zu bytes\n", path.c_str(), text.length());
+
+	ElapsedPeriod epLoad;
+	sci.Send(Message::AppendText, text.length(), reinterpret_cast<sptr_t>(text.data()));
+	sci.Send(Message::EmptyUndoBuffer);
+	PrintDuration("load", epLoad.Duration());
+	printf("  %-24s %10lld\n", "lines", static_cast<long long>(sci.Send(Message::GetLineCount)));
+
+	if (!options.lexer.empty()) {
+		ILexer5 *lexer = CreateLexer(options.lexer.c_str());
+		if (!lexer) {
+			fprintf(stderr, "Unknown lexer %s\n", options.lexer.c_str());
+			return false;
+		}
+		sci.Send(Message::SetILexer, 0, reinterpret_cast<sptr_t>(lexer));
+		sci.Send(Message::SetProperty, reinterpret_cast<uptr_t>("fold"), reinterpret_cast<sptr_t>("1"));
+		sci.Send(Message::SetProperty, reinterpret_cast<uptr_t>("fold.html"), reinterpret_cast<sptr_t>("1"));
+		ElapsedPeriod epLex;
+		sci.Send(Message::Colourise, 0, -1);
+		PrintDuration("lex", epLex.Duration());
+	}
+
+	if (options.wrap) {
+		ElapsedPeriod epWrap;
+		sci.Send(Message::SetWrapMode, static_cast<uptr_t>(Wrap::Word));
+		sci.PaintWindow();
+		PrintDuration("wrap first frame", epWrap.Duration());
+		const size_t idleCalls = sci.IdleUntilDone();
+		PrintDuration("wrap all", epWrap.Duration());
+		printf("  %-24s %10zu\n", "wrap idle calls", idleCalls);
+	}
+
+	if (options.fold) {
+		ElapsedPeriod epFold;
+		sci.Send(Message::FoldAll, static_cast<uptr_t>(FoldAction::Contract));
+		PrintDuration("fold contract all", epFold.Duration(true));
+		sci.Send(Message::FoldAll, static_cast<uptr_t>(FoldAction::Expand));
+		PrintDuration("fold expand all", epFold.Duration(true));
+		sci.Send(Message::FoldAllToDepth, 2);
+		PrintDuration("fold to depth 2", epFold.Duration(true));
+		printf("  %-24s %10lld\n", "visible lines", static_cast<long long>(
+			sci.Send(Message::VisibleFromDocLine, sci.Send(Message::GetLineCount))));
+		sci.Send(Message::FoldAll, static_cast<uptr_t>(FoldAction::Expand));
+	}
+
+	if (options.markers > 0) {
+		TimeMarkers(sci, options.markers);
+	}
+
+	if (options.scattered > 0) {
+		TimeScatteredEdits(sci, options.scattered);
+	}
+
+	if (options.columnEdit > 0) {
+		TimeColumnEdit(sci, options.columnEdit);
+	}
+
+	// Discard frames painted while loading and wrapping so only scrolling is measured
+	sci.PaintWindow();
+	sci.Send(Message::ClearProfile);
+
+	const Sci::Line linesOnScreen = sci.Send(Message::LinesOnScreen);
+	const Sci::Line linesDisplay = sci.Send(Message::VisibleFromDocLine, sci.Send(Message::GetLineCount));
+	ElapsedPeriod epScroll;
+	for (int frame = 0; frame < options.frames; frame++) {
+		const Sci::Line firstVisible = sci.Send(Message::GetFirstVisibleLine);
+		if (firstVisible + linesOnScreen >= linesDisplay) {
+			sci.Send(Message::SetFirstVisibleLine, 0);
+		} else {
+			sci.Send(Message::LineScroll, 0, linesOnScreen);
+		}
+		sci.PaintWindow();
+	}
+	const double durationScroll = epScroll.Duration();
+	PrintDuration("scroll", durationScroll);
+	printf("  %-24s %10.1f\n", "frames per second", options.frames / std::max(durationScroll, 1.0e-9));
+
+	// Average each profile measure over the frames painted
+	const int framesProfiled = static_cast<int>(sci.Send(Message::GetProfileFrameCount));
+	if (framesProfiled > 0) {
+		printf("  per frame averages over %d frames (microseconds or counts):\n", framesProfiled);
+		for (size_t measure = 0; measure < std::size(measureNames); measure++) {
+			long long total = 0;
+			for (int frame = 0; frame < framesProfiled; frame++) {
+				total += sci.Send(Message::GetProfileValue, frame, static_cast<sptr_t>(measure));
+			}
+			if (total > 0) {
+				printf("    %-22s %10.1f\n", measureNames[measure], static_cast<double>(total) / framesProfiled);
+			}
+		}
+	}
+	return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	const std::optional<Options> options = ParseArguments(argc, argv);
+	if (!options) {
+		Usage();
+		return 2;
+	}
+	int result = 0;
+	for (const std::string &path : options->files) {
+		if (!RunFile(*options, path)) {
+			result = 1;
+		}
+	}
+	return result;
+}
@@ -1,1243 +1,1638 @@
-/** @file testDocument.cxx
- ** Unit Tests for Scintilla internal data structures
- **/
-
-#include <cstddef>
-#include <cstdint>
-#include <cstring>
-#include <stdexcept>
-#include <string_view>
-#include <vector>
-#include <map>
-#include <set>
-#include <optional>
-#include <algorithm>
-#include <memory>
-#include <iostream>
-#include <fstream>
-#include <iomanip>
-
-#include "ScintillaTypes.h"
-
-#include "ILoader.h"
-#include "ILexer.h"
-
-#include "Debugging.h"
-
-#include "CharacterCategoryMap.h"
-#include "Position.h"
-#include "SplitVector.h"
-#include "Partitioning.h"
-#include "RunStyles.h"
-#include "CellBuffer.h"
-#include "CharClassify.h"
-#include "Decoration.h"
-#include "CaseFolder.h"
-#include "Document.h"
-#include "UniConversion.h"
-
-#include "catch.hpp"
-
-using namespace Scintilla;
-using namespace Scintilla::Internal;
-
-// set global locale to pass std::regex related tests
-// see https://gcc.gnu.org/bugzilla/show_bug.cgi?id=63776
-struct GlobalLocaleInitializer {
-	GlobalLocaleInitializer() {
-		try {
-			std::locale::global(std::locale("en_US.UTF-8"));
-		} catch (...) {}
-	}
-} globalLocaleInitializer;
-
-// Test Document.
-
-struct Folding {
-	int from;
-	int to;
-	int length;
-};
-
-// Table of case folding for non-ASCII bytes in Windows Latin code page 1252
-const Folding foldings1252[] = {
-	{0x8a, 0x9a, 0x01},
-	{0x8c, 0x9c, 0x01},
-	{0x8e, 0x9e, 0x01},
-	{0x9f, 0xff, 0x01},
-	{0xc0, 0xe0, 0x17},
-	{0xd8, 0xf8, 0x07},
-};
-
-std::string ReadFile(const std::string &path) {
-	std::ifstream ifs(path, std::ios::binary);
-	std::string content((std::istreambuf_iterator<char>(ifs)),
-		(std::istreambuf_iterator<char>()));
-	return content;
-}
-
-struct Match {
-	Sci::Position location = 0;
-	Sci::Position length = 0;
-	constexpr Match() = default;
-	constexpr Match(Sci::Position location_, Sci::Position length_=0) : location(location_), length(length_) {
-	}
-	constexpr bool operator==(const Match &other) const {
-		return location == other.location && length == other.length;
-	}
-};
-
-std::ostream &operator << (std::ostream &os, Match const &value) {
-	os << value.location << "," << value.length;
-	return os;
-}
-
-struct DocPlus {
-	Document document;
-
-	DocPlus(std::string_view svInitial, int codePage) : document(DocumentOption::Default) {
-		SetCodePage(codePage);
-		document.InsertString(0, svInitial);
-	}
-
-	void SetCodePage(int codePage) {
-		document.SetDBCSCodePage(codePage);
-		if (codePage == CpUtf8) {
-			document.SetCaseFolder(std::make_unique<CaseFolderUnicode>());
-		} else {
-			// This case folder will not handle many DBCS cases. Scintilla uses platform-specific code for DBCS
-			// case folding which can not easily be inserted in platform-independent tests.
-			std::unique_ptr<CaseFolderTable> pcft = std::make_unique<CaseFolderTable>();
-			document.SetCaseFolder(std::move(pcft));
-		}
-	}
-
-	void SetSBCSFoldings(const Folding *foldings, size_t length) {
-		std::unique_ptr<CaseFolderTable> pcft = std::make_unique<CaseFolderTable>();
-		for (size_t block = 0; block < length; block++) {
-			for (int fold = 0; fold < foldings[block].length; fold++) {
-				pcft->SetTranslation(foldings[block].from + fold, foldings[block].to + fold);
-			}
-		}
-		document.SetCaseFolder(std::move(pcft));
-	}
-
-	Sci::Position FindNeedle(std::string_view needle, FindOption options, Sci::Position *length) {
-		assert(*length == static_cast<Sci::Position>(needle.length()));
-		return document.FindText(0, document.Length(), needle.data(), options, length);
-	}
-	Sci::Position FindNeedleReverse(std::string_view needle, FindOption options, Sci::Position *length) {
-		assert(*length == static_cast<Sci::Position>(needle.length()));
-		return document.FindText(document.Length(), 0, needle.data(), options, length);
-	}
-
-	Match FindString(Sci::Position minPos, Sci::Position maxPos, std::string_view needle, FindOption flags) {
-		Sci::Position lengthFinding = needle.length();
-		const Sci::Position location = document.FindText(minPos, maxPos, needle.data(), flags, &lengthFinding);
-		return { location, lengthFinding };
-	}
-
-	std::string Substitute(std::string_view substituteText) {
-		Sci::Position lengthsubstitute = substituteText.length();
-		std::string substituted = document.SubstituteByPosition(substituteText.data(), &lengthsubstitute);
-		assert(lengthsubstitute == static_cast<Sci::Position>(substituted.length()));
-		return substituted;
-	}
-
-	void MoveGap(Sci::Position gapNew) {
-		// Move gap to gapNew by inserting
-		document.InsertString(gapNew, "!", 1);
-		// Remove insertion
-		document.DeleteChars(gapNew, 1);
-	}
-
-	[[nodiscard]] std::string Contents() const {
-		const Sci::Position length = document.Length();
-		std::string contents(length, 0);
-		document.GetCharRange(contents.data(), 0, length);
-		return contents;
-	}
-};
-
-void TimeTrace(std::string_view sv, const Catch::Timer &tikka) {
-	std::cout << sv << std::setw(5) << tikka.getElapsedMilliseconds() << " milliseconds" << std::endl;
-}
-
-TEST_CASE("Document") {
-
-	constexpr std::string_view sText = "Scintilla";
-	constexpr Sci::Position sLength = sText.length();
-	constexpr FindOption rePosix = FindOption::RegExp | FindOption::Posix;
-	constexpr FindOption reCxx11 = FindOption::RegExp | FindOption::Cxx11RegEx;
-
-	SECTION("InsertOneLine") {
-		DocPlus doc("", 0);
-		const Sci::Position length = doc.document.InsertString(0, sText);
-		REQUIRE(sLength == doc.document.Length());
-		REQUIRE(length == sLength);
-		REQUIRE(1 == doc.document.LinesTotal());
-		REQUIRE(0 == doc.document.LineStart(0));
-		REQUIRE(0 == doc.document.LineFromPosition(0));
-		REQUIRE(0 == doc.document.LineStartPosition(0));
-		REQUIRE(sLength == doc.document.LineStart(1));
-		REQUIRE(0 == doc.document.LineFromPosition(static_cast<int>(sLength)));
-		REQUIRE(doc.document.CanUndo());
-		REQUIRE(!doc.document.CanRedo());
-	}
-
-	// Search ranges are from first argument to just before second argument
-	// Arguments are expected to be at character boundaries and will be tweaked if
-	// part way through a character.
-	SECTION("SearchInLatin") {
-		DocPlus doc("abcde", 0);	// a b c d e
-		constexpr std::string_view finding = "b";
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.FindNeedleReverse(finding, FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(0, 2, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(0, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == -1);
-	}
-
-	SECTION("SearchInBothSegments") {
-		DocPlus doc("ab-ab", 0);	// a b - a b
-		constexpr std::string_view finding = "ab";
-		for (int gapPos = 0; gapPos <= 5; gapPos++) {
-			doc.MoveGap(gapPos);
-			Sci::Position lengthFinding = finding.length();
-			Sci::Position location = doc.document.FindText(0, doc.document.Length(), finding.data(), FindOption::MatchCase, &lengthFinding);
-			REQUIRE(location == 0);
-			location = doc.document.FindText(2, doc.document.Length(), finding.data(), FindOption::MatchCase, &lengthFinding);
-			REQUIRE(location == 3);
-		}
-	}
-
-	SECTION("InsensitiveSearchInLatin") {
-		DocPlus doc("abcde", 0);	// a b c d e
-		constexpr std::string_view finding = "B";
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(0, 2, finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(0, 1, finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == -1);
-	}
-
-	SECTION("InsensitiveSearchIn1252") {
-		// In Windows Latin, code page 1252, C6 is AE and E6 is ae
-		DocPlus doc("tru\xc6s\xe6t", 0);	// t r u AE s ae t
-		doc.SetSBCSFoldings(foldings1252, std::size(foldings1252));
-
-		// Search for upper-case AE
-		std::string_view finding = "\xc6";
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 3);
-		location = doc.document.FindText(4, doc.document.Length(), finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 5);
-		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 5);
-
-		// Search for lower-case ae
-		finding = "\xe6";
-		location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 3);
-		location = doc.document.FindText(4, doc.document.Length(), finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 5);
-		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 5);
-	}
-
-	SECTION("Search2InLatin") {
-		// Checks that the initial '_' and final 'f' are ignored since they are outside the search bounds
-		DocPlus doc("_abcdef", 0);	// _ a b c d e f
-		constexpr std::string_view finding = "cd";
-		Sci::Position lengthFinding = finding.length();
-		const size_t docLength = doc.document.Length() - 1;
-		Sci::Position location = doc.document.FindText(1, docLength, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 3);
-		location = doc.document.FindText(docLength, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 3);
-		location = doc.document.FindText(docLength, 1, "bc", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(docLength, 1, "ab", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(docLength, 1, "de", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 4);
-		location = doc.document.FindText(docLength, 1, "_a", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == -1);
-		location = doc.document.FindText(docLength, 1, "ef", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == -1);
-		lengthFinding = 3;
-		location = doc.document.FindText(docLength, 1, "cde", FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 3);
-	}
-
-	SECTION("SearchInUTF8") {
-		DocPlus doc("ab\xCE\x93" "d", CpUtf8);	// a b gamma d
-		constexpr std::string_view finding = "b";
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(0, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == -1);
-		// Check doesn't try to follow a lead-byte past the search end
-		constexpr std::string_view findingUTF = "\xCE\x93";
-		lengthFinding = findingUTF.length();
-		location = doc.document.FindText(0, 4, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 2);
-		// Only succeeds as 3 is partway through character so adjusted to 4
-		location = doc.document.FindText(0, 3, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(0, 2, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == -1);
-	}
-
-	SECTION("InsensitiveSearchInUTF8") {
-		DocPlus doc("ab\xCE\x93" "d", CpUtf8);	// a b gamma d
-		constexpr std::string_view finding = "b";
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		constexpr std::string_view findingUTF = "\xCE\x93";
-		lengthFinding = findingUTF.length();
-		location = doc.FindNeedle(findingUTF, FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(doc.document.Length(), 0, findingUTF.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(0, 4, findingUTF.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		// Only succeeds as 3 is partway through character so adjusted to 4
-		location = doc.document.FindText(0, 3, findingUTF.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(0, 2, findingUTF.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == -1);
-	}
-
-	SECTION("SearchInShiftJIS") {
-		// {CJK UNIFIED IDEOGRAPH-9955} is two bytes: {0xE9, 'b'} in Shift-JIS
-		// The 'b' can be incorrectly matched by the search string 'b' when the search
-		// does not iterate the text correctly.
-		DocPlus doc("ab\xe9" "b ", 932);	// a b {CJK UNIFIED IDEOGRAPH-9955} {space}
-		constexpr std::string_view finding = "b";
-		// Search forwards
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-		// Search backwards
-		lengthFinding = finding.length();
-		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::MatchCase, &lengthFinding);
-		REQUIRE(location == 1);
-	}
-
-	SECTION("InsensitiveSearchInShiftJIS") {
-		// {CJK UNIFIED IDEOGRAPH-9955} is two bytes: {0xE9, 'b'} in Shift-JIS
-		// The 'b' can be incorrectly matched by the search string 'b' when the search
-		// does not iterate the text correctly.
-		DocPlus doc("ab\xe9" "b ", 932);	// a b {CJK UNIFIED IDEOGRAPH-9955} {space}
-		constexpr std::string_view finding = "b";
-		// Search forwards
-		Sci::Position lengthFinding = finding.length();
-		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		// Search backwards
-		lengthFinding = finding.length();
-		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 1);
-		constexpr std::string_view finding932 = "\xe9" "b";
-		// Search forwards
-		lengthFinding = finding932.length();
-		location = doc.FindNeedle(finding932, FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		// Search backwards
-		lengthFinding = finding932.length();
-		location = doc.document.FindText(doc.document.Length(), 0, finding932.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(0, 3, finding932.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == 2);
-		location = doc.document.FindText(0, 2, finding932.data(), FindOption::None, &lengthFinding);
-		REQUIRE(location == -1);
-		// Can not test case mapping of double byte text as folder available here does not implement this
-	}
-
-	SECTION("GetCharacterAndWidth DBCS") {
-		Document doc(DocumentOption::Default);
-		doc.SetDBCSCodePage(932);
-		REQUIRE(doc.CodePage() == 932);
-		const Sci::Position length = doc.InsertString(0, "H\x84\xff\x84H", 5);
-		// This text is invalid in code page 932.
-		// A reasonable interpretation is as 4 items: 2 characters and 2 character fragments
-		// The last item is a 2-byte CYRILLIC CAPITAL LETTER ZE character
-		// H [84] [FF] ZE
-		REQUIRE(5 == length);
-		REQUIRE(5 == doc.Length());
-		Sci::Position width = 0;
-		// test GetCharacterAndWidth()
-		int ch = doc.GetCharacterAndWidth(0, &width);
-		REQUIRE(width == 1);
-		REQUIRE(ch == 'H');
-		ch = doc.GetCharacterAndWidth(1, &width);
-		REQUIRE(width == 1);
-		REQUIRE(ch == 0x84);
-		width = 0;
-		ch = doc.GetCharacterAndWidth(2, &width);
-		REQUIRE(width == 1);
-		REQUIRE(ch == 0xff);
-		width = 0;
-		ch = doc.GetCharacterAndWidth(3, &width);
-		REQUIRE(width == 2);
-		REQUIRE(ch == 0x8448);
-		// test LenChar()
-		width = doc.LenChar(0);
-		REQUIRE(width == 1);
-		width = doc.LenChar(1);
-		REQUIRE(width == 1);
-		width = doc.LenChar(2);
-		REQUIRE(width == 1);
-		width = doc.LenChar(3);
-		REQUIRE(width == 2);
-		// test MovePositionOutsideChar()
-		Sci::Position pos = doc.MovePositionOutsideChar(1, 1);
-		REQUIRE(pos == 1);
-		pos = doc.MovePositionOutsideChar(2, 1);
-		REQUIRE(pos == 2);
-		pos = doc.MovePositionOutsideChar(3, 1);
-		REQUIRE(pos == 3);
-		pos = doc.MovePositionOutsideChar(4, 1);
-		REQUIRE(pos == 5);
-		pos = doc.MovePositionOutsideChar(1, -1);
-		REQUIRE(pos == 1);
-		pos = doc.MovePositionOutsideChar(2, -1);
-		REQUIRE(pos == 2);
-		pos = doc.MovePositionOutsideChar(3, -1);
-		REQUIRE(pos == 3);
-		pos = doc.MovePositionOutsideChar(4, -1);
-		REQUIRE(pos == 3);
-		// test NextPosition()
-		pos = doc.NextPosition(0, 1);
-		REQUIRE(pos == 1);
-		pos = doc.NextPosition(1, 1);
-		REQUIRE(pos == 2);
-		pos = doc.NextPosition(2, 1);
-		REQUIRE(pos == 3);
-		pos = doc.NextPosition(3, 1);
-		REQUIRE(pos == 5);
-		pos = doc.NextPosition(1, -1);
-		REQUIRE(pos == 0);
-		pos = doc.NextPosition(2, -1);
-		REQUIRE(pos == 1);
-		pos = doc.NextPosition(3, -1);
-		REQUIRE(pos == 2);
-		pos = doc.NextPosition(5, -1);
-		REQUIRE(pos == 3);
-	}
-
-	SECTION("NextPosition Valid DBCS") {
-		Document doc(DocumentOption::Default);
-		doc.SetDBCSCodePage(932);
-		REQUIRE(doc.CodePage() == 932);
-		// This text is valid in code page 932.
-		// O p e n = U+958B Ku ( O ) U+7DE8 -
-		// U+958B open
-		// U+7DE8 arrange
-		constexpr std::string_view japaneseText = "Open=\x8aJ\x82\xad(O)\x95\xd2-";
-		const Sci::Position length = doc.InsertString(0, japaneseText);
-		REQUIRE(length == 15);
-		// Forwards
-		REQUIRE(doc.NextPosition( 0, 1) == 1);
-		REQUIRE(doc.NextPosition( 1, 1) == 2);
-		REQUIRE(doc.NextPosition( 2, 1) == 3);
-		REQUIRE(doc.NextPosition( 3, 1) == 4);
-		REQUIRE(doc.NextPosition( 4, 1) == 5);
-		REQUIRE(doc.NextPosition( 5, 1) == 7);	// Double byte
-		REQUIRE(doc.NextPosition( 6, 1) == 7);
-		REQUIRE(doc.NextPosition( 7, 1) == 9);	// Double byte
-		REQUIRE(doc.NextPosition( 8, 1) == 9);
-		REQUIRE(doc.NextPosition( 9, 1) == 10);
-		REQUIRE(doc.NextPosition(10, 1) == 11);
-		REQUIRE(doc.NextPosition(11, 1) == 12);
-		REQUIRE(doc.NextPosition(12, 1) == 14);	// Double byte
-		REQUIRE(doc.NextPosition(13, 1) == 14);
-		REQUIRE(doc.NextPosition(14, 1) == 15);
-		REQUIRE(doc.NextPosition(15, 1) == 15);
-		// Backwards
-		REQUIRE(doc.NextPosition( 0, -1) == 0);
-		REQUIRE(doc.NextPosition( 1, -1) == 0);
-		REQUIRE(doc.NextPosition( 2, -1) == 1);
-		REQUIRE(doc.NextPosition( 3, -1) == 2);
-		REQUIRE(doc.NextPosition( 4, -1) == 3);
-		REQUIRE(doc.NextPosition( 5, -1) == 4);
-		REQUIRE(doc.NextPosition( 6, -1) == 5);	// Double byte
-		REQUIRE(doc.NextPosition( 7, -1) == 5);
-		REQUIRE(doc.NextPosition( 8, -1) == 7);	// Double byte
-		REQUIRE(doc.NextPosition( 9, -1) == 7);
-		REQUIRE(doc.NextPosition(10, -1) == 9);
-		REQUIRE(doc.NextPosition(11, -1) == 10);
-		REQUIRE(doc.NextPosition(12, -1) == 11);
-		REQUIRE(doc.NextPosition(13, -1) == 12);	// Double byte
-		REQUIRE(doc.NextPosition(14, -1) == 12);
-		REQUIRE(doc.NextPosition(15, -1) == 14);
-	}
-
-	SECTION("RegexSearchAndSubstitution") {
-		DocPlus doc("\n\r\r\n 1a\xCE\x93z \n\r\r\n 2b\xCE\x93y \n\r\r\n", CpUtf8);// 1a gamma z 2b gamma y
-		const Sci::Position docLength = doc.document.Length();
-		Match match;
-
-		constexpr std::string_view finding = R"(\d+(\w+))";
-		constexpr std::string_view substituteText = R"(\t\1\n)";
-		constexpr std::string_view longest = "\\w+";
-		std::string substituted;
-
-		match = doc.FindString(0, docLength, finding, rePosix);
-		REQUIRE(match == Match(5, 5));
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\ta\xCE\x93z\n");
-
-		match = doc.FindString(docLength, 0, finding, rePosix);
-		REQUIRE(match == Match(16, 5));
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\tb\xCE\x93y\n");
-
-		match = doc.FindString(docLength, 0, longest, rePosix);
-		REQUIRE(match == Match(16, 5));
-
-		#ifndef NO_CXX11_REGEX
-		match = doc.FindString(0, docLength, finding, reCxx11);
-		REQUIRE(match == Match(5, 5));
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\ta\xCE\x93z\n");
-
-		match = doc.FindString(docLength, 0, finding, reCxx11);
-		REQUIRE(match == Match(16, 5));
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\tb\xCE\x93y\n");
-
-		match = doc.FindString(docLength, 0, longest, reCxx11);
-		REQUIRE(match == Match(16, 5));
-		#endif
-	}
-
-	SECTION("RegexAssertion") {
-		DocPlus doc("ab cd ef\r\ngh ij kl", CpUtf8);
-		const Sci::Position docLength = doc.document.Length();
-		Match match;
-
-		constexpr std::string_view findingBOL = "^";
-		match = doc.FindString(0, docLength, findingBOL, rePosix);
-		REQUIRE(match == Match(0));
-		match = doc.FindString(1, docLength, findingBOL, rePosix);
-		REQUIRE(match == Match(10));
-		match = doc.FindString(docLength, 0, findingBOL, rePosix);
-		REQUIRE(match == Match(10));
-		match = doc.FindString(docLength - 1, 0, findingBOL, rePosix);
-		REQUIRE(match == Match(10));
-
-		#ifndef NO_CXX11_REGEX
-		match = doc.FindString(0, docLength, findingBOL, reCxx11);
-		REQUIRE(match == Match(0));
-		match = doc.FindString(1, docLength, findingBOL, reCxx11);
-		REQUIRE(match == Match(10));
-		match = doc.FindString(docLength, 0, findingBOL, reCxx11);
-		REQUIRE(match == Match(10));
-		match = doc.FindString(docLength - 1, 0, findingBOL, reCxx11);
-		REQUIRE(match == Match(10));
-		#endif
-
-		constexpr std::string_view findingEOL = "$";
-		match = doc.FindString(0, docLength, findingEOL, rePosix);
-		REQUIRE(match == Match(8));
-		match = doc.FindString(1, docLength, findingEOL, rePosix);
-		REQUIRE(match == Match(8));
-		match = doc.FindString(docLength, 0, findingEOL, rePosix);
-		REQUIRE(match == Match(18));
-		match = doc.FindString(docLength - 1, 0, findingEOL, rePosix);
-		REQUIRE(match == Match(8));
-
-		#if !defined(NO_CXX11_REGEX) && !defined(_LIBCPP_VERSION)
-		match = doc.FindString(0, docLength, findingEOL, reCxx11);
-		REQUIRE(match == Match(8));
-		match = doc.FindString(1, docLength, findingEOL, reCxx11);
-		REQUIRE(match == Match(8));
-		match = doc.FindString(docLength, 0, findingEOL, reCxx11);
-		REQUIRE(match == Match(18));
-		match = doc.FindString(docLength - 1, 0, findingEOL, reCxx11);
-		REQUIRE(match == Match(8));
-		#endif
-
-		constexpr std::string_view findingBOW = "\\<";
-		match = doc.FindString(0, docLength, findingBOW, rePosix);
-		REQUIRE(match == Match(0));
-		match = doc.FindString(1, docLength, findingBOW, rePosix);
-		REQUIRE(match == Match(3));
-		match = doc.FindString(docLength, 0, findingBOW, rePosix);
-		REQUIRE(match == Match(16));
-		match = doc.FindString(docLength - 1, 0, findingBOW, rePosix);
-		REQUIRE(match == Match(16));
-
-		constexpr std::string_view findingEOW = "\\>";
-		match = doc.FindString(0, docLength, findingEOW, rePosix);
-		REQUIRE(match == Match(2));
-		match = doc.FindString(1, docLength, findingEOW, rePosix);
-		REQUIRE(match == Match(2));
-		match = doc.FindString(docLength, 0, findingEOW, rePosix);
-		REQUIRE(match == Match(18));
-		match = doc.FindString(docLength - 1, 0, findingEOW, rePosix);
-		REQUIRE(match == Match(15));
-
-		constexpr std::string_view findingEOWEOL = "\\>$";
-		match = doc.FindString(0, docLength, findingEOWEOL, rePosix);
-		REQUIRE(match == Match(8));
-		match = doc.FindString(10, docLength, findingEOWEOL, rePosix);
-		REQUIRE(match == Match(18));
-
-		#ifndef NO_CXX11_REGEX
-		constexpr std::string_view findingWB = "\\b";
-		match = doc.FindString(0, docLength, findingWB, reCxx11);
-		REQUIRE(match == Match(0));
-		match = doc.FindString(1, docLength, findingWB, reCxx11);
-		REQUIRE(match == Match(2));
-		match = doc.FindString(docLength, 0, findingWB, reCxx11);
-		#ifdef _LIBCPP_VERSION
-		REQUIRE(match == Match(16));
-		#else
-		REQUIRE(match == Match(18));
-		#endif
-		match = doc.FindString(docLength - 1, 0, findingWB, reCxx11);
-		REQUIRE(match == Match(16));
-
-		constexpr std::string_view findingNWB = "\\B";
-		match = doc.FindString(0, docLength, findingNWB, reCxx11);
-		REQUIRE(match == Match(1));
-		match = doc.FindString(1, docLength, findingNWB, reCxx11);
-		REQUIRE(match == Match(1));
-		#ifdef _LIBCPP_VERSION
-		match = doc.FindString(docLength, 0, findingNWB, reCxx11);
-		REQUIRE(match == Match(18));
-		match = doc.FindString(docLength - 1, 0, findingNWB, reCxx11);
-		REQUIRE(match == Match(14));
-		#else
-		match = doc.FindString(docLength, 0, findingNWB, reCxx11);
-		REQUIRE(match == Match(17));
-		match = doc.FindString(docLength - 1, 0, findingNWB, reCxx11);
-		REQUIRE(match == Match(17));
-		#endif
-		#endif
-	}
-
-	SECTION("RegexContextualAssertion") {
-		// For std::regex, check the use of assertions next to text in forward direction
-		// These are more common than empty assertions
-		DocPlus doc("ab cd ef\r\ngh ij kl", CpUtf8);
-		const Sci::Position docLength = doc.document.Length();
-		Match match;
-
-		#ifndef NO_CXX11_REGEX
-
-		match = doc.FindString(0, docLength, "^[a-z]", reCxx11);
-		REQUIRE(match == Match(0, 1));
-		match = doc.FindString(1, docLength, "^[a-z]", reCxx11);
-		REQUIRE(match == Match(10, 1));
-
-		match = doc.FindString(0, docLength, "[a-z]$", reCxx11);
-		REQUIRE(match == Match(7, 1));
-		match = doc.FindString(10, docLength, "[a-z]$", reCxx11);
-		REQUIRE(match == Match(17, 1));
-
-		match = doc.FindString(0, docLength, "\\b[a-z]", reCxx11);
-		REQUIRE(match == Match(0, 1));
-		match = doc.FindString(1, docLength, "\\b[a-z]", reCxx11);
-		REQUIRE(match == Match(3, 1));
-		match = doc.FindString(0, docLength, "[a-z]\\b", reCxx11);
-		REQUIRE(match == Match(1, 1));
-		match = doc.FindString(2, docLength, "[a-z]\\b", reCxx11);
-		REQUIRE(match == Match(4, 1));
-
-		match = doc.FindString(0, docLength, "\\B[a-z]", reCxx11);
-		REQUIRE(match == Match(1, 1));
-		match = doc.FindString(1, docLength, "\\B[a-z]", reCxx11);
-		REQUIRE(match == Match(1, 1));
-		match = doc.FindString(0, docLength, "[a-z]\\B", reCxx11);
-		REQUIRE(match == Match(0, 1));
-		match = doc.FindString(2, docLength, "[a-z]\\B", reCxx11);
-		REQUIRE(match == Match(3, 1));
-
-		#endif
-	}
-
-	SECTION("RESearchMovePositionOutsideCharUTF8") {
-		DocPlus doc(" a\xCE\x93\xCE\x93z ", CpUtf8);// a gamma gamma z
-		const Sci::Position docLength = doc.document.Length();
-		constexpr std::string_view finding = R"([a-z](\w)\1)";
-
-		Match match = doc.FindString(0, docLength, finding, rePosix);
-		REQUIRE(match == Match(1, 5));
-
-		constexpr std::string_view substituteText = R"(\t\1\n)";
-		std::string substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\t\xCE\x93\n");
-
-		#ifndef NO_CXX11_REGEX
-		match = doc.FindString(0, docLength, finding, reCxx11);
-		REQUIRE(match == Match(1, 5));
-
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\t\xCE\x93\n");
-		#endif
-	}
-
-	SECTION("RESearchMovePositionOutsideCharDBCS") {
-		DocPlus doc(" \x98\x61xx 1aa\x83\xA1\x83\xA1z ", 932);// U+548C xx 1aa gamma gamma z
-		const Sci::Position docLength = doc.document.Length();
-
-		Match match = doc.FindString(0, docLength, R"([a-z](\w)\1)", rePosix);
-		REQUIRE(match == Match(8, 5));
-
-		constexpr std::string_view substituteText = R"(\t\1\n)";
-		std::string substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\t\x83\xA1\n");
-
-		match = doc.FindString(0, docLength, R"(\w([a-z])\1)", rePosix);
-		REQUIRE(match == Match(6, 3));
-
-		substituted = doc.Substitute(substituteText);
-		REQUIRE(substituted == "\ta\n");
-	}
-
-	SECTION("BraceMatch") {
-		DocPlus doc("{}(()())[]", CpUtf8);
-		constexpr Sci::Position maxReStyle = 0; // unused parameter
-		Sci::Position pos = doc.document.BraceMatch(0, maxReStyle, 0, false);
-		REQUIRE(pos == 1);
-		pos = doc.document.BraceMatch(1, maxReStyle, 0, false);
-		REQUIRE(pos == 0);
-		pos = doc.document.BraceMatch(8, maxReStyle, 0, false);
-		REQUIRE(pos == 9);
-		pos = doc.document.BraceMatch(9, maxReStyle, 0, false);
-		REQUIRE(pos == 8);
-		pos = doc.document.BraceMatch(2, maxReStyle, 0, false);
-		REQUIRE(pos == 7);
-		pos = doc.document.BraceMatch(7, maxReStyle, 0, false);
-		REQUIRE(pos == 2);
-
-		// BraceMatchNext()
-		pos = doc.document.BraceMatch(2, maxReStyle, 3, true);
-		REQUIRE(pos == 7);
-		pos = doc.document.BraceMatch(2, maxReStyle, 4, true);
-		REQUIRE(pos == 4);
-		pos = doc.document.BraceMatch(2, maxReStyle, 5, true);
-		REQUIRE(pos == 7);
-		pos = doc.document.BraceMatch(2, maxReStyle, 6, true);
-		REQUIRE(pos == 6);
-		pos = doc.document.BraceMatch(2, maxReStyle, 7, true);
-		REQUIRE(pos == 7);
-
-		pos = doc.document.BraceMatch(7, maxReStyle, 6, true);
-		REQUIRE(pos == 2);
-		pos = doc.document.BraceMatch(7, maxReStyle, 5, true);
-		REQUIRE(pos == 5);
-		pos = doc.document.BraceMatch(7, maxReStyle, 4, true);
-		REQUIRE(pos == 2);
-		pos = doc.document.BraceMatch(7, maxReStyle, 3, true);
-		REQUIRE(pos == 3);
-		pos = doc.document.BraceMatch(7, maxReStyle, 2, true);
-		REQUIRE(pos == 2);
-	}
-
-	SECTION("BraceMatch DBCS") {
-		DocPlus doc("{\x81}\x81{}", 932); // { U+00B1 U+FF0B }
-		constexpr Sci::Position maxReStyle = 0; // unused parameter
-		Sci::Position pos = doc.document.BraceMatch(0, maxReStyle, 0, false);
-		REQUIRE(pos == 5);
-		pos = doc.document.BraceMatch(5, maxReStyle, 0, false);
-		REQUIRE(pos == 0);
-	}
-
-}
-
-TEST_CASE("DocumentUndo") {
-
-	// These tests check that Undo reports the end of coalesced deletes
-
-	constexpr std::string_view sText = "Scintilla";
-	DocPlus doc(sText, 0);
-
-	SECTION("CheckDeleteForwards") {
-		// Delete forwards like the Del key
-		doc.document.DeleteUndoHistory();
-		doc.document.DeleteChars(1, 1);
-		doc.document.DeleteChars(1, 1);
-		doc.document.DeleteChars(1, 1);
-		const Sci::Position position = doc.document.Undo();
-		REQUIRE(position == 4);	// End of reinsertion
-		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
-		REQUIRE(doc.document.CanRedo());
-	}
-
-	SECTION("CheckDeleteBackwards") {
-		// Delete backwards like the backspace key
-		doc.document.DeleteUndoHistory();
-		doc.document.DeleteChars(5, 1);
-		doc.document.DeleteChars(4, 1);
-		doc.document.DeleteChars(3, 1);
-		const Sci::Position position = doc.document.Undo();
-		REQUIRE(position == 6);	// End of reinsertion
-		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
-	}
-
-	SECTION("CheckBothWays") {
-		// Delete backwards like the backspace key
-		doc.document.DeleteUndoHistory();
-		// Like having the caret at position 5 then
-		doc.document.DeleteChars(5, 1);	// Del
-		doc.document.DeleteChars(4, 1); // Backspace
-		doc.document.DeleteChars(4, 1); // Del
-		doc.document.DeleteChars(3, 1); // Backspace
-		const Sci::Position position = doc.document.Undo();
-		REQUIRE(position == 7);	// End of reinsertion, Start at 5, 2*Del
-		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
-	}
-
-	SECTION("CheckInsert") {
-		// Insertions are only coalesced when following previous
-		doc.document.DeleteUndoHistory();
-		doc.document.InsertString(1, "1");
-		doc.document.InsertString(2, "2");
-		doc.document.InsertString(3, "3");
-		REQUIRE(doc.Contents() == "S123cintilla");
-		const Sci::Position position = doc.document.Undo();
-		REQUIRE(position == 1);	// Start of insertions
-		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
-	}
-
-	SECTION("CheckGrouped") {
-		// Check that position returned for group is that at end of first deletion set
-		// Also include a container undo action.
-		doc.document.DeleteUndoHistory();
-		doc.document.BeginUndoAction();
-		// At 1, 2*Del so end of initial deletion sequence is 3
-		doc.document.DeleteChars(1, 1); // 'c'
-		doc.document.DeleteChars(1, 1); // 'i'
-		doc.document.AddUndoAction(99, true);
-		doc.document.InsertString(1, "1");
-		doc.document.DeleteChars(4, 2); // 'il'
-		doc.document.BeginUndoAction();
-		REQUIRE(doc.Contents() == "S1ntla");
-		const Sci::Position position = doc.document.Undo();
-		REQUIRE(position == 3);	// Start of insertions
-		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
-	}
-}
-
-TEST_CASE("Words") {
-
-	SECTION("WordsInText") {
-		const DocPlus doc(" abc ", 0);
-		REQUIRE(doc.document.IsWordAt(1, 4));
-		REQUIRE(!doc.document.IsWordAt(0, 1));
-		REQUIRE(!doc.document.IsWordAt(1, 2));
-		const DocPlus docPunct(" [!] ", 0);
-		REQUIRE(docPunct.document.IsWordAt(1, 4));
-		REQUIRE(!docPunct.document.IsWordAt(0, 1));
-		REQUIRE(!docPunct.document.IsWordAt(1, 2));
-		const DocPlus docMixed(" -ab ", 0);	// '-' is punctuation, 'ab' is word
-		REQUIRE(docMixed.document.IsWordAt(2, 4));
-		REQUIRE(docMixed.document.IsWordAt(1, 4));
-		REQUIRE(docMixed.document.IsWordAt(1, 2));
-		REQUIRE(!docMixed.document.IsWordAt(1, 3));	// 3 is between a and b so not word edge
-		// Scintilla's word definition just examines the ends
-		const DocPlus docOverSpace(" a b ", 0);
-		REQUIRE(docOverSpace.document.IsWordAt(1, 4));
-	}
-
-	SECTION("WordsAtEnds") {
-		const DocPlus doc("a c", 0);
-		REQUIRE(doc.document.IsWordAt(0, 1));
-		REQUIRE(doc.document.IsWordAt(2, 3));
-		const DocPlus docEndSpace(" a c ", 0);
-		REQUIRE(!docEndSpace.document.IsWordAt(0, 2));
-		REQUIRE(!docEndSpace.document.IsWordAt(3, 5));
-	}
-}
-
-TEST_CASE("SafeSegment") {
-	SECTION("Short") {
-		const DocPlus doc("", 0);
-		// all encoding: break before or after last space
-		constexpr std::string_view text = "12 ";
-		const size_t length = doc.document.SafeSegment(text);
-		REQUIRE(length <= text.length());
-		REQUIRE(text[length - 1] == '2');
-		REQUIRE(text[length] == ' ');
-	}
-
-	SECTION("ASCII") {
-		const DocPlus doc("", 0);
-		// all encoding: break before or after last space
-		std::string_view text = "12 3 \t45";
-		size_t length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == ' ');
-		REQUIRE(text[length] == '\t');
-
-		// UTF-8 and ASCII: word and punctuation boundary in middle of text
-		text = "(IsBreakSpace(text[j]))";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'j');
-		REQUIRE(text[length] == ']');
-
-		// UTF-8 and ASCII: word and punctuation boundary near start of text
-		text = "(IsBreakSpace";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '(');
-		REQUIRE(text[length] == 'I');
-
-		// UTF-8 and ASCII: word and punctuation boundary near end of text
-		text = "IsBreakSpace)";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'e');
-		REQUIRE(text[length] == ')');
-
-		// break before last character
-		text = "JapaneseJa";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'J');
-		REQUIRE(text[length] == 'a');
-	}
-
-	SECTION("UTF-8") {
-		const DocPlus doc("", CpUtf8);
-		// break before last character: no trail byte
-		std::string_view text = "JapaneseJa";
-		size_t length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'J');
-		REQUIRE(text[length] == 'a');
-
-		// break before last character: 1 trail byte
-		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xc2\xa9";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\x9e');
-		REQUIRE(text[length] == '\xc2');
-
-		// break before last character: 2 trail bytes
-		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\xac');
-		REQUIRE(text[length] == '\xe8');
-
-		// break before last character: 3 trail bytes
-		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xf0\x9f\x98\x8a";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\x9e');
-		REQUIRE(text[length] == '\xf0');
-	}
-
-	SECTION("UTF-8 Character Fragments") {
-		// PositionCache breaks long texts into fixed length sub-strings that are passed to SafeSegment
-		// so the final character in the sub-string may be incomplete without all needed trail bytes.
-		// For UTF-8, SafeSegment first discards any final bytes that do not represent a valid character
-		// then discards the final whole character.
-
-		const DocPlus doc("", CpUtf8);
-
-		// break before last character after discarding incomplete last character: 0 trail byte
-		std::string_view text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xc2";	// Invalid text as ends with start byte
-		size_t length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\xac');
-		REQUIRE(text[length] == '\xe8');
-		REQUIRE(UTF8IsValid(text.substr(0, length)));
-
-		// break before last character after discarding incomplete last character: 1 trail byte and 2 needed
-		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe6\x97";	// Invalid text as ends with only 1 trail byte
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\xac');
-		REQUIRE(text[length] == '\xe8');
-		REQUIRE(UTF8IsValid(text.substr(0, length)));
-	}
-
-	SECTION("UTF-8 Combining Characters") {
-		const DocPlus doc("", CpUtf8);
-
-		// There may be combining characters like accents and tone marks after the
-		// last letter in a sub-string and these may be included in the sub-string
-		// or follow it.
-		// Correct display requires that the combining characters are measured and
-		// drawn with the letter they follow. Thus the final letter and any
-		// following combining characters are discarded.
-
-		// A Thai text example with 8 characters, each taking 3 bytes:
-		// HO HIP, SARA AA, KHO KHAI, MAI THO, O ANG, MO MA, SARA UU, LO LING
-		// Most are letters (Lo) but 2 characters are modifiers (Mn):
-		// MAI THO is a tone mark and SARA UU is a vowel.
-		const std::string_view text = "\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\x82\xe0\xb9\x89\xe0\xb8\xad\xe0\xb8\xa1\xe0\xb8\xb9\xe0\xb8\xa5";
-		REQUIRE(text.length() == 8 * 3);
-		size_t length = doc.document.SafeSegment(text);
-		REQUIRE(length == (8 - 1) * 3);	// Discard last character
-
-		// Remove last character (letter LO LING) then run again.
-		// Should skip past SARA UU combining vowel mark to discard letter MO MA and SARA UU.
-		const std::string_view textWithoutLoLing = text.substr(0, length);
-		length = doc.document.SafeSegment(textWithoutLoLing);
-		REQUIRE(length == (8 - 3) * 3);	// Discard 2 characters
-
-		// Remove last character SARA UU combining vowel mark then run again
-		// Final letter may have following combining mark so discard producing same text as previous step.
-		const std::string_view textWithoutSaraUu = text.substr(0, (8 - 2) * 3);
-		length = doc.document.SafeSegment(textWithoutSaraUu);
-		REQUIRE(length == (8 - 3) * 3);	// Discard 1 character
-	}
-
-	SECTION("DBCS Shift-JIS") {
-		const DocPlus doc("", 932);
-		// word and punctuation boundary in middle of text: single byte
-		std::string_view text = "(IsBreakSpace(text[j]))";
-		size_t length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'j');
-		REQUIRE(text[length] == ']');
-
-		// word and punctuation boundary in middle of text: double byte
-		text = "(IsBreakSpace(text[\x8c\xea]))";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\xea');
-		REQUIRE(text[length] == ']');
-
-		// word and punctuation boundary near start of text
-		text = "(IsBreakSpace";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '(');
-		REQUIRE(text[length] == 'I');
-
-		// word and punctuation boundary near end of text: single byte
-		text = "IsBreakSpace)";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'e');
-		REQUIRE(text[length] == ')');
-
-		// word and punctuation boundary near end of text: double byte
-		text = "IsBreakSpace\x8c\xea)";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\xea');
-		REQUIRE(text[length] == ')');
-
-		// break before last character: single byte
-		text = "JapaneseJa";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == 'J');
-		REQUIRE(text[length] == 'a');
-
-		// break before last character: double byte
-		text = "Japanese\x93\xfa\x96\x7b\x8c\xea";
-		length = doc.document.SafeSegment(text);
-		REQUIRE(text[length - 1] == '\x7b');
-		REQUIRE(text[length] == '\x8c');
-	}
-}
-
-TEST_CASE("DiscardLastCombinedCharacter") {
-	SECTION("Short") {
-		const std::string_view base = "12345";
-		// Short strings (up to 4 bytes) aren't changed to avoid null and problematic results
-		for (size_t len = 0; len < 5; len++) {
-			std::string_view text = base.substr(0, len);
-			REQUIRE(text.length() == len);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(!changed);
-			REQUIRE(text.length() == len);
-		}
-	}
-
-	SECTION("ASCII") {
-		std::string_view text = "12345";
-		REQUIRE(text.length() == 5);
-		const bool changed = DiscardLastCombinedCharacter(text);
-		REQUIRE(changed);
-		REQUIRE(text.length() == 4);
-	}
-
-	SECTION("Control") {
-		{
-			std::string_view text = "12345\007";
-			REQUIRE(text.length() == 6);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			REQUIRE(text.length() == 5);
-		}
-		{
-			std::string_view text = "12345\007Z";
-			REQUIRE(text.length() == 7);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			REQUIRE(text.length() == 6);
-		}
-	}
-
-	SECTION("Japanese") {
-		std::string_view text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
-		REQUIRE(text.length() == 17);
-		const bool changed = DiscardLastCombinedCharacter(text);
-		REQUIRE(changed);
-		REQUIRE(text.length() == 14);
-	}
-
-	SECTION("Thai Combining") {
-		// Ends with two combined characters
-		// 7 characters, 5 base characters and 2 combining
-		// HO HIP, SARA AA, KHO KHAI, MAI THO, O ANG, MO MA, SARA UU
-		std::string_view text = "\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\x82\xe0\xb9\x89\xe0\xb8\xad\xe0\xb8\xa1\xe0\xb8\xb9";
-		REQUIRE(text.length() == 21);
-		const bool changed = DiscardLastCombinedCharacter(text);
-		REQUIRE(changed);
-		// Discarded 2 x 3-byte characters
-		REQUIRE(text.length() == 15);
-	}
-
-	SECTION("Invalid UTF-8") {
-		{
-			// Ends with isolated lead byte
-			std::string_view text = "1234\xe0";
-			REQUIRE(text.length() == 5);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded final invalid byte
-			REQUIRE(text.length() == 4);
-		}
-		{
-			// Ends with isolated trail byte
-			std::string_view text = "1234\xb8";
-			REQUIRE(text.length() == 5);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded final invalid byte
-			REQUIRE(text.length() == 4);
-		}
-		{
-			// Ends with lead byte and only one of two required trail bytes
-			std::string_view text = "1234\xe0\xb8";
-			REQUIRE(text.length() == 6);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded final invalid byte
-			REQUIRE(text.length() == 5);
-		}
-	}
-
-	SECTION("Private Use UTF-8") {
-		{
-			// Ends with private use area U+F8FF - Apple uses for apple symbol.
-			std::string_view text = "1234\xEF\xA3\xBF";
-			REQUIRE(text.length() == 7);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded whole final character
-			REQUIRE(text.length() == 4);
-		}
-		{
-			// At end: PUA + letter: PUA acts as base
-			std::string_view text = "1234\xEF\xA3\xBFZ";
-			REQUIRE(text.length() == 8);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded just final character
-			REQUIRE(text.length() == 7);
-		}
-	}
-
-	SECTION("Surrogates") {
-		{
-			// Ends with surrogate U+D800.
-			std::string_view text = "1234\xED\xA0\x80";
-			REQUIRE(text.length() == 7);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded final invalid byte
-			REQUIRE(text.length() == 6);
-		}
-		{
-			// Ends with surrogate U+DC00.
-			std::string_view text = "1234\xED\xB0\x80";
-			REQUIRE(text.length() == 7);
-			const bool changed = DiscardLastCombinedCharacter(text);
-			REQUIRE(changed);
-			// Discarded final invalid byte
-			REQUIRE(text.length() == 6);
-		}
-	}
-}
-
-TEST_CASE("PerLine") {
-	SECTION("LineMarkers") {
-		DocPlus doc("1\n2\n", CpUtf8);
-		REQUIRE(doc.document.LinesTotal() == 3);
-		const int mh1 = doc.document.AddMark(0, 0);
-		const int mh2 = doc.document.AddMark(1, 1);
-		const int mh3 = doc.document.AddMark(2, 2);
-		REQUIRE(mh1 != -1);
-		REQUIRE(mh2 != -1);
-		REQUIRE(mh3 != -1);
-		REQUIRE(doc.document.AddMark(3, 3) == -1);
-
-		// delete first character, no change
-		REQUIRE(doc.document.CharAt(0) == '1');
-		doc.document.DeleteChars(0, 1);
-		REQUIRE(doc.document.LinesTotal() == 3);
-		REQUIRE(doc.document.MarkerHandleFromLine(0, 0) == mh1);
-		REQUIRE(doc.document.MarkerHandleFromLine(0, 1) == -1);
-		REQUIRE(doc.document.MarkerHandleFromLine(1, 0) == mh2);
-		REQUIRE(doc.document.MarkerHandleFromLine(1, 1) == -1);
-
-		// delete first line, so merged
-		REQUIRE(doc.document.CharAt(0) == '\n');
-		doc.document.DeleteChars(0, 1);
-		REQUIRE(doc.document.CharAt(0) == '2');
-		const std::set handleSet {mh1, mh2};
-		const int handle1 = doc.document.MarkerHandleFromLine(0, 0);
-		const int handle2 = doc.document.MarkerHandleFromLine(0, 1);
-		REQUIRE(handle1 != handle2);
-		REQUIRE(handleSet.count(handle1) == 1);
-		REQUIRE(handleSet.count(handle2) == 1);
-		REQUIRE(doc.document.MarkerHandleFromLine(0, 2) == -1);
-		REQUIRE(doc.document.MarkerHandleFromLine(1, 0) == mh3);
-		REQUIRE(doc.document.MarkerHandleFromLine(1, 1) == -1);
-	}
-
-	SECTION("LineAnnotation") {
-		DocPlus doc("1\n2\n", CpUtf8);
-		REQUIRE(doc.document.LinesTotal() == 3);
-		Sci::Position length = doc.document.Length();
-		doc.document.AnnotationSetText(0, "1");
-		doc.document.AnnotationSetText(1, "1\n2");
-		doc.document.AnnotationSetText(2, "1\n2\n3");
-		REQUIRE(doc.document.AnnotationLines(0) == 1);
-		REQUIRE(doc.document.AnnotationLines(1) == 2);
-		REQUIRE(doc.document.AnnotationLines(2) == 3);
-		REQUIRE(doc.document.AnnotationLines(3) == 0);
-
-		// delete last line
-		length -= 1;
-		doc.document.DeleteChars(length, 1);
-		// Deleting the last line moves its 3-line annotation to previous line,
-		// deleting the 2-line annotation of the previous line.
-		REQUIRE(doc.document.LinesTotal() == 2);
-		REQUIRE(doc.document.AnnotationLines(0) == 1);
-		REQUIRE(doc.document.AnnotationLines(1) == 3);
-		REQUIRE(doc.document.AnnotationLines(2) == 0);
-
-		// delete last character, no change
-		length -= 1;
-		REQUIRE(doc.document.CharAt(length) == '2');
-		doc.document.DeleteChars(length, 1);
-		REQUIRE(doc.document.LinesTotal() == 2);
-		REQUIRE(doc.document.AnnotationLines(0) == 1);
-		REQUIRE(doc.document.AnnotationLines(1) == 3);
-		REQUIRE(doc.document.AnnotationLines(2) == 0);
-	}
-}
+/** @file testDocument.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+
+#include "ScintillaTypes.h"
+
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+
+#include "CharacterCategoryMap.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// set global locale to pass std::regex related tests
+// see https://gcc.gnu.org/bugzilla/show_bug.cgi?id=63776
+struct GlobalLocaleInitializer {
+	GlobalLocaleInitializer() {
+		try {
+			std::locale::global(std::locale("en_US.UTF-8"));
+		} catch (...) {}
+	}
+} globalLocaleInitializer;
+
+// Test Document.
+
+struct Folding {
+	int from;
+	int to;
+	int length;
+};
+
+// Table of case folding for non-ASCII bytes in Windows Latin code page 1252
+const Folding foldings1252[] = {
+	{0x8a, 0x9a, 0x01},
+	{0x8c, 0x9c, 0x01},
+	{0x8e, 0x9e, 0x01},
+	{0x9f, 0xff, 0x01},
+	{0xc0, 0xe0, 0x17},
+	{0xd8, 0xf8, 0x07},
+};
+
+std::string ReadFile(const std::string &path) {
+	std::ifstream ifs(path, std::ios::binary);
+	std::string content((std::istreambuf_iterator<char>(ifs)),
+		(std::istreambuf_iterator<char>()));
+	return content;
+}
+
+struct Match {
+	Sci::Position location = 0;
+	Sci::Position length = 0;
+	constexpr Match() = default;
+	constexpr Match(Sci::Position location_, Sci::Position length_=0) : location(location_), length(length_) {
+	}
+	constexpr bool operator==(const Match &other) const {
+		return location == other.location && length == other.length;
+	}
+};
+
+std::ostream &operator << (std::ostream &os, Match const &value) {
+	os << value.location << "," << value.length;
+	return os;
+}
+
+struct DocPlus {
+	Document document;
+
+	DocPlus(std::string_view svInitial, int codePage) : document(DocumentOption::Default) {
+		SetCodePage(codePage);
+		document.InsertString(0, svInitial);
+	}
+
+	void SetCodePage(int codePage) {
+		document.SetDBCSCodePage(codePage);
+		if (codePage == CpUtf8) {
+			document.SetCaseFolder(std::make_unique<CaseFolderUnicode>());
+		} else {
+			// This case folder will not handle many DBCS cases. Scintilla uses platform-specific code for DBCS
+			// case folding which can not easily be inserted in platform-independent tests.
+			std::unique_ptr<CaseFolderTable> pcft = std::make_unique<CaseFolderTable>();
+			document.SetCaseFolder(std::move(pcft));
+		}
+	}
+
+	void SetSBCSFoldings(const Folding *foldings, size_t length) {
+		std::unique_ptr<CaseFolderTable> pcft = std::make_unique<CaseFolderTable>();
+		for (size_t block = 0; block < length; block++) {
+			for (int fold = 0; fold < foldings[block].length; fold++) {
+				pcft->SetTranslation(foldings[block].from + fold, foldings[block].to + fold);
+			}
+		}
+		document.SetCaseFolder(std::move(pcft));
+	}
+
+	Sci::Position FindNeedle(std::string_view needle, FindOption options, Sci::Position *length) {
+		assert(*length == static_cast<Sci::Position>(needle.length()));
+		return document.FindText(0, document.Length(), needle.data(), options, length);
+	}
+	Sci::Position FindNeedleReverse(std::string_view needle, FindOption options, Sci::Position *length) {
+		assert(*length == static_cast<Sci::Position>(needle.length()));
+		return document.FindText(document.Length(), 0, needle.data(), options, length);
+	}
+
+	Match FindString(Sci::Position minPos, Sci::Position maxPos, std::string_view needle, FindOption flags) {
+		Sci::Position lengthFinding = needle.length();
+		const Sci::Position location = document.FindText(minPos, maxPos, needle.data(), flags, &lengthFinding);
+		return { location, lengthFinding };
+	}
+
+	std::string Substitute(std::string_view substituteText) {
+		Sci::Position lengthsubstitute = substituteText.length();
+		std::string substituted = document.SubstituteByPosition(substituteText.data(), &lengthsubstitute);
+		assert(lengthsubstitute == static_cast<Sci::Position>(substituted.length()));
+		return substituted;
+	}
+
+	void MoveGap(Sci::Position gapNew) {
+		// Move gap to gapNew by inserting
+		document.InsertString(gapNew, "!", 1);
+		// Remove insertion
+		document.DeleteChars(gapNew, 1);
+	}
+
+	[[nodiscard]] std::string Contents() const {
+		const Sci::Position length = document.Length();
+		std::string contents(length, 0);
+		document.GetCharRange(contents.data(), 0, length);
+		return contents;
+	}
+};
+
+void TimeTrace(std::string_view sv, const Catch::Timer &tikka) {
+	std::cout << sv << std::setw(5) << tikka.getElapsedMilliseconds() << " milliseconds" << std::endl;
+}
+
+TEST_CASE("Document") {
+
+	constexpr std::string_view sText = "Scintilla";
+	constexpr Sci::Position sLength = sText.length();
+	constexpr FindOption rePosix = FindOption::RegExp | FindOption::Posix;
+	constexpr FindOption reCxx11 = FindOption::RegExp | FindOption::Cxx11RegEx;
+
+	SECTION("InsertOneLine") {
+		DocPlus doc("", 0);
+		const Sci::Position length = doc.document.InsertString(0, sText);
+		REQUIRE(sLength == doc.document.Length());
+		REQUIRE(length == sLength);
+		REQUIRE(1 == doc.document.LinesTotal());
+		REQUIRE(0 == doc.document.LineStart(0));
+		REQUIRE(0 == doc.document.LineFromPosition(0));
+		REQUIRE(0 == doc.document.LineStartPosition(0));
+		REQUIRE(sLength == doc.document.LineStart(1));
+		REQUIRE(0 == doc.document.LineFromPosition(static_cast<int>(sLength)));
+		REQUIRE(doc.document.CanUndo());
+		REQUIRE(!doc.document.CanRedo());
+	}
+
+	// Search ranges are from first argument to just before second argument
+	// Arguments are expected to be at character boundaries and will be tweaked if
+	// part way through a character.
+	SECTION("SearchInLatin") {
+		DocPlus doc("abcde", 0);	// a b c d e
+		constexpr std::string_view finding = "b";
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.FindNeedleReverse(finding, FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(0, 2, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(0, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == -1);
+	}
+
+	SECTION("SearchInBothSegments") {
+		DocPlus doc("ab-ab", 0);	// a b - a b
+		constexpr std::string_view finding = "ab";
+		for (int gapPos = 0; gapPos <= 5; gapPos++) {
+			doc.MoveGap(gapPos);
+			Sci::Position lengthFinding = finding.length();
+			Sci::Position location = doc.document.FindText(0, doc.document.Length(), finding.data(), FindOption::MatchCase, &lengthFinding);
+			REQUIRE(location == 0);
+			location = doc.document.FindText(2, doc.document.Length(), finding.data(), FindOption::MatchCase, &lengthFinding);
+			REQUIRE(location == 3);
+		}
+	}
+
+	SECTION("InsensitiveSearchInLatin") {
+		DocPlus doc("abcde", 0);	// a b c d e
+		constexpr std::string_view finding = "B";
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(0, 2, finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(0, 1, finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == -1);
+	}
+
+	SECTION("InsensitiveSearchIn1252") {
+		// In Windows Latin, code page 1252, C6 is AE and E6 is ae
+		DocPlus doc("tru\xc6s\xe6t", 0);	// t r u AE s ae t
+		doc.SetSBCSFoldings(foldings1252, std::size(foldings1252));
+
+		// Search for upper-case AE
+		std::string_view finding = "\xc6";
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 3);
+		location = doc.document.FindText(4, doc.document.Length(), finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 5);
+		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 5);
+
+		// Search for lower-case ae
+		finding = "\xe6";
+		location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 3);
+		location = doc.document.FindText(4, doc.document.Length(), finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 5);
+		location = doc.FindNeedleReverse(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 5);
+	}
+
+	SECTION("Search2InLatin") {
+		// Checks that the initial '_' and final 'f' are ignored since they are outside the search bounds
+		DocPlus doc("_abcdef", 0);	// _ a b c d e f
+		constexpr std::string_view finding = "cd";
+		Sci::Position lengthFinding = finding.length();
+		const size_t docLength = doc.document.Length() - 1;
+		Sci::Position location = doc.document.FindText(1, docLength, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 3);
+		location = doc.document.FindText(docLength, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 3);
+		location = doc.document.FindText(docLength, 1, "bc", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(docLength, 1, "ab", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(docLength, 1, "de", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 4);
+		location = doc.document.FindText(docLength, 1, "_a", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == -1);
+		location = doc.document.FindText(docLength, 1, "ef", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == -1);
+		lengthFinding = 3;
+		location = doc.document.FindText(docLength, 1, "cde", FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 3);
+	}
+
+	SECTION("SearchInUTF8") {
+		DocPlus doc("ab\xCE\x93" "d", CpUtf8);	// a b gamma d
+		constexpr std::string_view finding = "b";
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(0, 1, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == -1);
+		// Check doesn't try to follow a lead-byte past the search end
+		constexpr std::string_view findingUTF = "\xCE\x93";
+		lengthFinding = findingUTF.length();
+		location = doc.document.FindText(0, 4, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 2);
+		// Only succeeds as 3 is partway through character so adjusted to 4
+		location = doc.document.FindText(0, 3, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(0, 2, findingUTF.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == -1);
+	}
+
+	SECTION("InsensitiveSearchInUTF8") {
+		DocPlus doc("ab\xCE\x93" "d", CpUtf8);	// a b gamma d
+		constexpr std::string_view finding = "b";
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		constexpr std::string_view findingUTF = "\xCE\x93";
+		lengthFinding = findingUTF.length();
+		location = doc.FindNeedle(findingUTF, FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(doc.document.Length(), 0, findingUTF.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(0, 4, findingUTF.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		// Only succeeds as 3 is partway through character so adjusted to 4
+		location = doc.document.FindText(0, 3, findingUTF.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(0, 2, findingUTF.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == -1);
+	}
+
+	SECTION("SearchInShiftJIS") {
+		// {CJK UNIFIED IDEOGRAPH-9955} is two bytes: {0xE9, 'b'} in Shift-JIS
+		// The 'b' can be incorrectly matched by the search string 'b' when the search
+		// does not iterate the text correctly.
+		DocPlus doc("ab\xe9" "b ", 932);	// a b {CJK UNIFIED IDEOGRAPH-9955} {space}
+		constexpr std::string_view finding = "b";
+		// Search forwards
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+		// Search backwards
+		lengthFinding = finding.length();
+		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::MatchCase, &lengthFinding);
+		REQUIRE(location == 1);
+	}
+
+	SECTION("InsensitiveSearchInShiftJIS") {
+		// {CJK UNIFIED IDEOGRAPH-9955} is two bytes: {0xE9, 'b'} in Shift-JIS
+		// The 'b' can be incorrectly matched by the search string 'b' when the search
+		// does not iterate the text correctly.
+		DocPlus doc("ab\xe9" "b ", 932);	// a b {CJK UNIFIED IDEOGRAPH-9955} {space}
+		constexpr std::string_view finding = "b";
+		// Search forwards
+		Sci::Position lengthFinding = finding.length();
+		Sci::Position location = doc.FindNeedle(finding, FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		// Search backwards
+		lengthFinding = finding.length();
+		location = doc.document.FindText(doc.document.Length(), 0, finding.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 1);
+		constexpr std::string_view finding932 = "\xe9" "b";
+		// Search forwards
+		lengthFinding = finding932.length();
+		location = doc.FindNeedle(finding932, FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		// Search backwards
+		lengthFinding = finding932.length();
+		location = doc.document.FindText(doc.document.Length(), 0, finding932.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(0, 3, finding932.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == 2);
+		location = doc.document.FindText(0, 2, finding932.data(), FindOption::None, &lengthFinding);
+		REQUIRE(location == -1);
+		// Can not test case mapping of double byte text as folder available here does not implement this
+	}
+
+	SECTION("GetCharacterAndWidth DBCS") {
+		Document doc(DocumentOption::Default);
+		doc.SetDBCSCodePage(932);
+		REQUIRE(doc.CodePage() == 932);
+		const Sci::Position length = doc.InsertString(0, "H\x84\xff\x84H", 5);
+		// This text is invalid in code page 932.
+		// A reasonable interpretation is as 4 items: 2 characters and 2 character fragments
+		// The last item is a 2-byte CYRILLIC CAPITAL LETTER ZE character
+		// H [84] [FF] ZE
+		REQUIRE(5 == length);
+		REQUIRE(5 == doc.Length());
+		Sci::Position width = 0;
+		// test GetCharacterAndWidth()
+		int ch = doc.GetCharacterAndWidth(0, &width);
+		REQUIRE(width == 1);
+		REQUIRE(ch == 'H');
+		ch = doc.GetCharacterAndWidth(1, &width);
+		REQUIRE(width == 1);
+		REQUIRE(ch == 0x84);
+		width = 0;
+		ch = doc.GetCharacterAndWidth(2, &width);
+		REQUIRE(width == 1);
+		REQUIRE(ch == 0xff);
+		width = 0;
+		ch = doc.GetCharacterAndWidth(3, &width);
+		REQUIRE(width == 2);
+		REQUIRE(ch == 0x8448);
+		// test LenChar()
+		width = doc.LenChar(0);
+		REQUIRE(width == 1);
+		width = doc.LenChar(1);
+		REQUIRE(width == 1);
+		width = doc.LenChar(2);
+		REQUIRE(width == 1);
+		width = doc.LenChar(3);
+		REQUIRE(width == 2);
+		// test MovePositionOutsideChar()
+		Sci::Position pos = doc.MovePositionOutsideChar(1, 1);
+		REQUIRE(pos == 1);
+		pos = doc.MovePositionOutsideChar(2, 1);
+		REQUIRE(pos == 2);
+		pos = doc.MovePositionOutsideChar(3, 1);
+		REQUIRE(pos == 3);
+		pos = doc.MovePositionOutsideChar(4, 1);
+		REQUIRE(pos == 5);
+		pos = doc.MovePositionOutsideChar(1, -1);
+		REQUIRE(pos == 1);
+		pos = doc.MovePositionOutsideChar(2, -1);
+		REQUIRE(pos == 2);
+		pos = doc.MovePositionOutsideChar(3, -1);
+		REQUIRE(pos == 3);
+		pos = doc.MovePositionOutsideChar(4, -1);
+		REQUIRE(pos == 3);
+		// test NextPosition()
+		pos = doc.NextPosition(0, 1);
+		REQUIRE(pos == 1);
+		pos = doc.NextPosition(1, 1);
+		REQUIRE(pos == 2);
+		pos = doc.NextPosition(2, 1);
+		REQUIRE(pos == 3);
+		pos = doc.NextPosition(3, 1);
+		REQUIRE(pos == 5);
+		pos = doc.NextPosition(1, -1);
+		REQUIRE(pos == 0);
+		pos = doc.NextPosition(2, -1);
+		REQUIRE(pos == 1);
+		pos = doc.NextPosition(3, -1);
+		REQUIRE(pos == 2);
+		pos = doc.NextPosition(5, -1);
+		REQUIRE(pos == 3);
+	}
+
+	SECTION("NextPosition Valid DBCS") {
+		Document doc(DocumentOption::Default);
+		doc.SetDBCSCodePage(932);
+		REQUIRE(doc.CodePage() == 932);
+		// This text is valid in code page 932.
+		// O p e n = U+958B Ku ( O ) U+7DE8 -
+		// U+958B open
+		// U+7DE8 arrange
+		constexpr std::string_view japaneseText = "Open=\x8aJ\x82\xad(O)\x95\xd2-";
+		const Sci::Position length = doc.InsertString(0, japaneseText);
+		REQUIRE(length == 15);
+		// Forwards
+		REQUIRE(doc.NextPosition( 0, 1) == 1);
+		REQUIRE(doc.NextPosition( 1, 1) == 2);
+		REQUIRE(doc.NextPosition( 2, 1) == 3);
+		REQUIRE(doc.NextPosition( 3, 1) == 4);
+		REQUIRE(doc.NextPosition( 4, 1) == 5);
+		REQUIRE(doc.NextPosition( 5, 1) == 7);	// Double byte
+		REQUIRE(doc.NextPosition( 6, 1) == 7);
+		REQUIRE(doc.NextPosition( 7, 1) == 9);	// Double byte
+		REQUIRE(doc.NextPosition( 8, 1) == 9);
+		REQUIRE(doc.NextPosition( 9, 1) == 10);
+		REQUIRE(doc.NextPosition(10, 1) == 11);
+		REQUIRE(doc.NextPosition(11, 1) == 12);
+		REQUIRE(doc.NextPosition(12, 1) == 14);	// Double byte
+		REQUIRE(doc.NextPosition(13, 1) == 14);
+		REQUIRE(doc.NextPosition(14, 1) == 15);
+		REQUIRE(doc.NextPosition(15, 1) == 15);
+		// Backwards
+		REQUIRE(doc.NextPosition( 0, -1) == 0);
+		REQUIRE(doc.NextPosition( 1, -1) == 0);
+		REQUIRE(doc.NextPosition( 2, -1) == 1);
+		REQUIRE(doc.NextPosition( 3, -1) == 2);
+		REQUIRE(doc.NextPosition( 4, -1) == 3);
+		REQUIRE(doc.NextPosition( 5, -1) == 4);
+		REQUIRE(doc.NextPosition( 6, -1) == 5);	// Double byte
+		REQUIRE(doc.NextPosition( 7, -1) == 5);
+		REQUIRE(doc.NextPosition( 8, -1) == 7);	// Double byte
+		REQUIRE(doc.NextPosition( 9, -1) == 7);
+		REQUIRE(doc.NextPosition(10, -1) == 9);
+		REQUIRE(doc.NextPosition(11, -1) == 10);
+		REQUIRE(doc.NextPosition(12, -1) == 11);
+		REQUIRE(doc.NextPosition(13, -1) == 12);	// Double byte
+		REQUIRE(doc.NextPosition(14, -1) == 12);
+		REQUIRE(doc.NextPosition(15, -1) == 14);
+	}
+
+	SECTION("RegexSearchAndSubstitution") {
+		DocPlus doc("\n\r\r\n 1a\xCE\x93z \n\r\r\n 2b\xCE\x93y \n\r\r\n", CpUtf8);// 1a gamma z 2b gamma y
+		const Sci::Position docLength = doc.document.Length();
+		Match match;
+
+		constexpr std::string_view finding = R"(\d+(\w+))";
+		constexpr std::string_view substituteText = R"(\t\1\n)";
+		constexpr std::string_view longest = "\\w+";
+		std::string substituted;
+
+		match = doc.FindString(0, docLength, finding, rePosix);
+		REQUIRE(match == Match(5, 5));
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\ta\xCE\x93z\n");
+
+		match = doc.FindString(docLength, 0, finding, rePosix);
+		REQUIRE(match == Match(16, 5));
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\tb\xCE\x93y\n");
+
+		match = doc.FindString(docLength, 0, longest, rePosix);
+		REQUIRE(match == Match(16, 5));
+
+		#ifndef NO_CXX11_REGEX
+		match = doc.FindString(0, docLength, finding, reCxx11);
+		REQUIRE(match == Match(5, 5));
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\ta\xCE\x93z\n");
+
+		match = doc.FindString(docLength, 0, finding, reCxx11);
+		REQUIRE(match == Match(16, 5));
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\tb\xCE\x93y\n");
+
+		match = doc.FindString(docLength, 0, longest, reCxx11);
+		REQUIRE(match == Match(16, 5));
+		#endif
+	}
+
+	SECTION("RegexAssertion") {
+		DocPlus doc("ab cd ef\r\ngh ij kl", CpUtf8);
+		const Sci::Position docLength = doc.document.Length();
+		Match match;
+
+		constexpr std::string_view findingBOL = "^";
+		match = doc.FindString(0, docLength, findingBOL, rePosix);
+		REQUIRE(match == Match(0));
+		match = doc.FindString(1, docLength, findingBOL, rePosix);
+		REQUIRE(match == Match(10));
+		match = doc.FindString(docLength, 0, findingBOL, rePosix);
+		REQUIRE(match == Match(10));
+		match = doc.FindString(docLength - 1, 0, findingBOL, rePosix);
+		REQUIRE(match == Match(10));
+
+		#ifndef NO_CXX11_REGEX
+		match = doc.FindString(0, docLength, findingBOL, reCxx11);
+		REQUIRE(match == Match(0));
+		match = doc.FindString(1, docLength, findingBOL, reCxx11);
+		REQUIRE(match == Match(10));
+		match = doc.FindString(docLength, 0, findingBOL, reCxx11);
+		REQUIRE(match == Match(10));
+		match = doc.FindString(docLength - 1, 0, findingBOL, reCxx11);
+		REQUIRE(match == Match(10));
+		#endif
+
+		constexpr std::string_view findingEOL = "$";
+		match = doc.FindString(0, docLength, findingEOL, rePosix);
+		REQUIRE(match == Match(8));
+		match = doc.FindString(1, docLength, findingEOL, rePosix);
+		REQUIRE(match == Match(8));
+		match = doc.FindString(docLength, 0, findingEOL, rePosix);
+		REQUIRE(match == Match(18));
+		match = doc.FindString(docLength - 1, 0, findingEOL, rePosix);
+		REQUIRE(match == Match(8));
+
+		#if !defined(NO_CXX11_REGEX) && !defined(_LIBCPP_VERSION)
+		match = doc.FindString(0, docLength, findingEOL, reCxx11);
+		REQUIRE(match == Match(8));
+		match = doc.FindString(1, docLength, findingEOL, reCxx11);
+		REQUIRE(match == Match(8));
+		match = doc.FindString(docLength, 0, findingEOL, reCxx11);
+		REQUIRE(match == Match(18));
+		match = doc.FindString(docLength - 1, 0, findingEOL, reCxx11);
+		REQUIRE(match == Match(8));
+		#endif
+
+		constexpr std::string_view findingBOW = "\\<";
+		match = doc.FindString(0, docLength, findingBOW, rePosix);
+		REQUIRE(match == Match(0));
+		match = doc.FindString(1, docLength, findingBOW, rePosix);
+		REQUIRE(match == Match(3));
+		match = doc.FindString(docLength, 0, findingBOW, rePosix);
+		REQUIRE(match == Match(16));
+		match = doc.FindString(docLength - 1, 0, findingBOW, rePosix);
+		REQUIRE(match == Match(16));
+
+		constexpr std::string_view findingEOW = "\\>";
+		match = doc.FindString(0, docLength, findingEOW, rePosix);
+		REQUIRE(match == Match(2));
+		match = doc.FindString(1, docLength, findingEOW, rePosix);
+		REQUIRE(match == Match(2));
+		match = doc.FindString(docLength, 0, findingEOW, rePosix);
+		REQUIRE(match == Match(18));
+		match = doc.FindString(docLength - 1, 0, findingEOW, rePosix);
+		REQUIRE(match == Match(15));
+
+		constexpr std::string_view findingEOWEOL = "\\>$";
+		match = doc.FindString(0, docLength, findingEOWEOL, rePosix);
+		REQUIRE(match == Match(8));
+		match = doc.FindString(10, docLength, findingEOWEOL, rePosix);
+		REQUIRE(match == Match(18));
+
+		#ifndef NO_CXX11_REGEX
+		constexpr std::string_view findingWB = "\\b";
+		match = doc.FindString(0, docLength, findingWB, reCxx11);
+		REQUIRE(match == Match(0));
+		match = doc.FindString(1, docLength, findingWB, reCxx11);
+		REQUIRE(match == Match(2));
+		match = doc.FindString(docLength, 0, findingWB, reCxx11);
+		#ifdef _LIBCPP_VERSION
+		REQUIRE(match == Match(16));
+		#else
+		REQUIRE(match == Match(18));
+		#endif
+		match = doc.FindString(docLength - 1, 0, findingWB, reCxx11);
+		REQUIRE(match == Match(16));
+
+		constexpr std::string_view findingNWB = "\\B";
+		match = doc.FindString(0, docLength, findingNWB, reCxx11);
+		REQUIRE(match == Match(1));
+		match = doc.FindString(1, docLength, findingNWB, reCxx11);
+		REQUIRE(match == Match(1));
+		#ifdef _LIBCPP_VERSION
+		match = doc.FindString(docLength, 0, findingNWB, reCxx11);
+		REQUIRE(match == Match(18));
+		match = doc.FindString(docLength - 1, 0, findingNWB, reCxx11);
+		REQUIRE(match == Match(14));
+		#else
+		match = doc.FindString(docLength, 0, findingNWB, reCxx11);
+		REQUIRE(match == Match(17));
+		match = doc.FindString(docLength - 1, 0, findingNWB, reCxx11);
+		REQUIRE(match == Match(17));
+		#endif
+		#endif
+	}
+
+	SECTION("RegexContextualAssertion") {
+		// For std::regex, check the use of assertions next to text in forward direction
+		// These are more common than empty assertions
+		DocPlus doc("ab cd ef\r\ngh ij kl", CpUtf8);
+		const Sci::Position docLength = doc.document.Length();
+		Match match;
+
+		#ifndef NO_CXX11_REGEX
+
+		match = doc.FindString(0, docLength, "^[a-z]", reCxx11);
+		REQUIRE(match == Match(0, 1));
+		match = doc.FindString(1, docLength, "^[a-z]", reCxx11);
+		REQUIRE(match == Match(10, 1));
+
+		match = doc.FindString(0, docLength, "[a-z]$", reCxx11);
+		REQUIRE(match == Match(7, 1));
+		match = doc.FindString(10, docLength, "[a-z]$", reCxx11);
+		REQUIRE(match == Match(17, 1));
+
+		match = doc.FindString(0, docLength, "\\b[a-z]", reCxx11);
+		REQUIRE(match == Match(0, 1));
+		match = doc.FindString(1, docLength, "\\b[a-z]", reCxx11);
+		REQUIRE(match == Match(3, 1));
+		match = doc.FindString(0, docLength, "[a-z]\\b", reCxx11);
+		REQUIRE(match == Match(1, 1));
+		match = doc.FindString(2, docLength, "[a-z]\\b", reCxx11);
+		REQUIRE(match == Match(4, 1));
+
+		match = doc.FindString(0, docLength, "\\B[a-z]", reCxx11);
+		REQUIRE(match == Match(1, 1));
+		match = doc.FindString(1, docLength, "\\B[a-z]", reCxx11);
+		REQUIRE(match == Match(1, 1));
+		match = doc.FindString(0, docLength, "[a-z]\\B", reCxx11);
+		REQUIRE(match == Match(0, 1));
+		match = doc.FindString(2, docLength, "[a-z]\\B", reCxx11);
+		REQUIRE(match == Match(3, 1));
+
+		#endif
+	}
+
+	SECTION("RESearchMovePositionOutsideCharUTF8") {
+		DocPlus doc(" a\xCE\x93\xCE\x93z ", CpUtf8);// a gamma gamma z
+		const Sci::Position docLength = doc.document.Length();
+		constexpr std::string_view finding = R"([a-z](\w)\1)";
+
+		Match match = doc.FindString(0, docLength, finding, rePosix);
+		REQUIRE(match == Match(1, 5));
+
+		constexpr std::string_view substituteText = R"(\t\1\n)";
+		std::string substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\t\xCE\x93\n");
+
+		#ifndef NO_CXX11_REGEX
+		match = doc.FindString(0, docLength, finding, reCxx11);
+		REQUIRE(match == Match(1, 5));
+
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\t\xCE\x93\n");
+		#endif
+	}
+
+	SECTION("RESearchMovePositionOutsideCharDBCS") {
+		DocPlus doc(" \x98\x61xx 1aa\x83\xA1\x83\xA1z ", 932);// U+548C xx 1aa gamma gamma z
+		const Sci::Position docLength = doc.document.Length();
+
+		Match match = doc.FindString(0, docLength, R"([a-z](\w)\1)", rePosix);
+		REQUIRE(match == Match(8, 5));
+
+		constexpr std::string_view substituteText = R"(\t\1\n)";
+		std::string substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\t\x83\xA1\n");
+
+		match = doc.FindString(0, docLength, R"(\w([a-z])\1)", rePosix);
+		REQUIRE(match == Match(6, 3));
+
+		substituted = doc.Substitute(substituteText);
+		REQUIRE(substituted == "\ta\n");
+	}
+
+	SECTION("BraceMatch") {
+		DocPlus doc("{}(()())[]", CpUtf8);
+		constexpr Sci::Position maxReStyle = 0; // unused parameter
+		Sci::Position pos = doc.document.BraceMatch(0, maxReStyle, 0, false);
+		REQUIRE(pos == 1);
+		pos = doc.document.BraceMatch(1, maxReStyle, 0, false);
+		REQUIRE(pos == 0);
+		pos = doc.document.BraceMatch(8, maxReStyle, 0, false);
+		REQUIRE(pos == 9);
+		pos = doc.document.BraceMatch(9, maxReStyle, 0, false);
+		REQUIRE(pos == 8);
+		pos = doc.document.BraceMatch(2, maxReStyle, 0, false);
+		REQUIRE(pos == 7);
+		pos = doc.document.BraceMatch(7, maxReStyle, 0, false);
+		REQUIRE(pos == 2);
+
+		// BraceMatchNext()
+		pos = doc.document.BraceMatch(2, maxReStyle, 3, true);
+		REQUIRE(pos == 7);
+		pos = doc.document.BraceMatch(2, maxReStyle, 4, true);
+		REQUIRE(pos == 4);
+		pos = doc.document.BraceMatch(2, maxReStyle, 5, true);
+		REQUIRE(pos == 7);
+		pos = doc.document.BraceMatch(2, maxReStyle, 6, true);
+		REQUIRE(pos == 6);
+		pos = doc.document.BraceMatch(2, maxReStyle, 7, true);
+		REQUIRE(pos == 7);
+
+		pos = doc.document.BraceMatch(7, maxReStyle, 6, true);
+		REQUIRE(pos == 2);
+		pos = doc.document.BraceMatch(7, maxReStyle, 5, true);
+		REQUIRE(pos == 5);
+		pos = doc.document.BraceMatch(7, maxReStyle, 4, true);
+		REQUIRE(pos == 2);
+		pos = doc.document.BraceMatch(7, maxReStyle, 3, true);
+		REQUIRE(pos == 3);
+		pos = doc.document.BraceMatch(7, maxReStyle, 2, true);
+		REQUIRE(pos == 2);
+	}
+
+	SECTION("BraceMatch DBCS") {
+		DocPlus doc("{\x81}\x81{}", 932); // { U+00B1 U+FF0B }
+		constexpr Sci::Position maxReStyle = 0; // unused parameter
+		Sci::Position pos = doc.document.BraceMatch(0, maxReStyle, 0, false);
+		REQUIRE(pos == 5);
+		pos = doc.document.BraceMatch(5, maxReStyle, 0, false);
+		REQUIRE(pos == 0);
+	}
+
+}
+
+TEST_CASE("DocumentUndo") {
+
+	// These tests check that Undo reports the end of coalesced deletes
+
+	constexpr std::string_view sText = "Scintilla";
+	DocPlus doc(sText, 0);
+
+	SECTION("CheckDeleteForwards") {
+		// Delete forwards like the Del key
+		doc.document.DeleteUndoHistory();
+		doc.document.DeleteChars(1, 1);
+		doc.document.DeleteChars(1, 1);
+		doc.document.DeleteChars(1, 1);
+		const Sci::Position position = doc.document.Undo();
+		REQUIRE(position == 4);	// End of reinsertion
+		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
+		REQUIRE(doc.document.CanRedo());
+	}
+
+	SECTION("CheckDeleteBackwards") {
+		// Delete backwards like the backspace key
+		doc.document.DeleteUndoHistory();
+		doc.document.DeleteChars(5, 1);
+		doc.document.DeleteChars(4, 1);
+		doc.document.DeleteChars(3, 1);
+		const Sci::Position position = doc.document.Undo();
+		REQUIRE(position == 6);	// End of reinsertion
+		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
+	}
+
+	SECTION("CheckBothWays") {
+		// Delete backwards like the backspace key
+		doc.document.DeleteUndoHistory();
+		// Like having the caret at position 5 then
+		doc.document.DeleteChars(5, 1);	// Del
+		doc.document.DeleteChars(4, 1); // Backspace
+		doc.document.DeleteChars(4, 1); // Del
+		doc.document.DeleteChars(3, 1); // Backspace
+		const Sci::Position position = doc.document.Undo();
+		REQUIRE(position == 7);	// End of reinsertion, Start at 5, 2*Del
+		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
+	}
+
+	SECTION("CheckInsert") {
+		// Insertions are only coalesced when following previous
+		doc.document.DeleteUndoHistory();
+		doc.document.InsertString(1, "1");
+		doc.document.InsertString(2, "2");
+		doc.document.InsertString(3, "3");
+		REQUIRE(doc.Contents() == "S123cintilla");
+		const Sci::Position position = doc.document.Undo();
+		REQUIRE(position == 1);	// Start of insertions
+		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
+	}
+
+	SECTION("CheckGrouped") {
+		// Check that position returned for group is that at end of first deletion set
+		// Also include a container undo action.
+		doc.document.DeleteUndoHistory();
+		doc.document.BeginUndoAction();
+		// At 1, 2*Del so end of initial deletion sequence is 3
+		doc.document.DeleteChars(1, 1); // 'c'
+		doc.document.DeleteChars(1, 1); // 'i'
+		doc.document.AddUndoAction(99, true);
+		doc.document.InsertString(1, "1");
+		doc.document.DeleteChars(4, 2); // 'il'
+		doc.document.BeginUndoAction();
+		REQUIRE(doc.Contents() == "S1ntla");
+		const Sci::Position position = doc.document.Undo();
+		REQUIRE(position == 3);	// Start of insertions
+		REQUIRE(!doc.document.CanUndo());	// Exhausted undo stack
+	}
+}
+
+TEST_CASE("DocumentEditRanges") {
+
+	constexpr std::string_view sText = "a1\nb2\nc3\n";
+	DocPlus doc(sText, 0);
+	doc.document.DeleteUndoHistory();
+
+	SECTION("InsertAndDelete") {
+		// Like typing at the start of each line, replacing the digit and doing nothing on the last line
+		std::vector<RangeEdit> edits(4);
+		edits[0].text = "x";
+		edits[1].position = 4;
+		edits[1].lengthDelete = 1;
+		edits[1].text = "yy";
+		edits[2].position = 6;
+		edits[3].position = 7;
+		edits[3].lengthDelete = 1;
+		doc.document.EditRanges(edits);
+		REQUIRE(doc.Contents() == "xa1\nbyy\nc\n");
+		REQUIRE(edits[0].position == 0);
+		REQUIRE(edits[0].lengthInserted == 1);
+		REQUIRE(edits[1].position == 5);
+		REQUIRE(edits[1].lengthDelete == 1);
+		REQUIRE(edits[1].lengthInserted == 2);
+		REQUIRE(edits[2].position == 8);
+		REQUIRE(edits[2].lengthInserted == 0);
+		REQUIRE(edits[3].position == 9);
+		REQUIRE(edits[3].lengthInserted == 0);
+
+		// All edits are undone as one action
+		doc.document.Undo();
+		REQUIRE(doc.Contents() == sText);
+		REQUIRE(!doc.document.CanUndo());
+		doc.document.Redo();
+		REQUIRE(doc.Contents() == "xa1\nbyy\nc\n");
+	}
+
+	SECTION("ReadOnly") {
+		doc.document.SetReadOnly(true);
+		std::vector<RangeEdit> edits(2);
+		edits[0].lengthDelete = 1;
+		edits[0].text = "x";
+		edits[1].position = 3;
+		edits[1].text = "y";
+		doc.document.EditRanges(edits);
+		REQUIRE(doc.Contents() == sText);
+		REQUIRE(edits[0].lengthDelete == 0);
+		REQUIRE(edits[0].lengthInserted == 0);
+		REQUIRE(edits[1].position == 3);
+	}
+}
+
+// Records the modifications a document reports to its watchers.
+class ModificationRecorder : public DocWatcher {
+public:
+	std::vector<DocModification> modifications;
+	bool wantsText = false;
+	std::string bulkText;
+
+	void NotifyModifyAttempt(Document *, void *) override {}
+	void NotifySavePoint(Document *, void *, bool) override {}
+	void NotifyModified(Document *, DocModification mh, void *) override {
+		if (FlagSet(mh.modificationType, ModificationFlags::BulkChange) && mh.text) {
+			bulkText = mh.text;
+		}
+		modifications.push_back(mh);
+	}
+	void NotifyDeleted(Document *, void *) noexcept override {}
+	void NotifyStyleNeeded(Document *, void *, Sci::Position) override {}
+	void NotifyErrorOccurred(Document *, void *, Status) override {}
+	void NotifyGroupCompleted(Document *, void *) noexcept override {}
+	bool WantsBulkChangeText(Document *, void *) const noexcept override {
+		return wantsText;
+	}
+
+	size_t Count(ModificationFlags flags) const noexcept {
+		return std::count_if(modifications.begin(), modifications.end(),
+			[flags](const DocModification &mh) noexcept { return FlagSet(mh.modificationType, flags); });
+	}
+};
+
+TEST_CASE("BulkChange") {
+
+	SECTION("ChangeSummary") {
+		ChangeSummary summary;
+		REQUIRE(summary.Empty());
+		summary.Insert(10, 2, 1);
+		REQUIRE(summary.start == 10);
+		REQUIRE(summary.end == 12);
+		// Insertion before moves the range and extends it back
+		summary.Insert(4, 3, 0);
+		REQUIRE(summary.start == 4);
+		REQUIRE(summary.end == 15);
+		// Deletion after the range extends it to the deletion point
+		summary.Delete(20, 5, -1);
+		REQUIRE(summary.start == 4);
+		REQUIRE(summary.end == 20);
+		// Deletion overlapping the start
+		summary.Delete(2, 4, 0);
+		REQUIRE(summary.start == 2);
+		REQUIRE(summary.end == 16);
+		REQUIRE(summary.linesAdded == 0);
+	}
+
+	SECTION("Notification") {
+		constexpr std::string_view sText = "a\r\nb\r\nc\r\n";
+		ModificationRecorder recorder;
+		DocPlus doc(sText, 0);
+		doc.document.AddWatcher(&recorder, nullptr);
+		doc.document.BeginBulkChange();
+		doc.document.BeginBulkChange();
+		doc.document.InsertString(0, "x\n");
+		doc.document.EndBulkChange();
+		REQUIRE(recorder.Count(ModificationFlags::BulkChange) == 0);
+		doc.document.DeleteChars(6, 2);
+		doc.document.EndBulkChange();
+		REQUIRE(doc.Contents() == "x\na\r\nbc\r\n");
+		// Each modification is still seen, followed by one summary after the outermost end
+		REQUIRE(recorder.Count(ModificationFlags::InsertText) == 1);
+		REQUIRE(recorder.Count(ModificationFlags::DeleteText) == 1);
+		REQUIRE(recorder.Count(ModificationFlags::BulkChange) == 1);
+		const DocModification &mh = recorder.modifications.back();
+		REQUIRE(FlagSet(mh.modificationType, ModificationFlags::BulkChange));
+		REQUIRE(mh.position == 0);
+		REQUIRE(mh.length == 6);
+		REQUIRE(mh.linesAdded == 0);
+		REQUIRE(mh.line == 0);
+
+		recorder.modifications.clear();
+		doc.document.ConvertLineEnds(EndOfLine::Lf);
+		REQUIRE(doc.Contents() == "x\na\nbc\n");
+		REQUIRE(recorder.Count(ModificationFlags::BulkChange) == 1);
+		REQUIRE(recorder.modifications.back().position == 3);
+		REQUIRE(recorder.modifications.back().length == 3);
+		doc.document.RemoveWatcher(&recorder, nullptr);
+	}
+
+	SECTION("Text") {
+		// The text replaced by a bulk change put back in its range gives the document as it was
+		constexpr std::string_view sText = "one two three four five six";
+		ModificationRecorder recorder;
+		recorder.wantsText = true;
+		DocPlus doc(sText, 0);
+		doc.document.AddWatcher(&recorder, nullptr);
+		auto Original = [&doc, &recorder]() {
+			const DocModification &mh = recorder.modifications.back();
+			REQUIRE(FlagSet(mh.modificationType, ModificationFlags::BulkChange));
+			const std::string after = doc.Contents();
+			return after.substr(0, mh.position) + recorder.bulkText + after.substr(mh.position + mh.length);
+		};
+
+		doc.document.BeginBulkChange();
+		doc.document.InsertString(8, "and ");
+		doc.document.DeleteChars(0, 4);
+		doc.document.InsertString(27, "!");
+		doc.document.DeleteChars(14, 5);
+		doc.document.EndBulkChange();
+		REQUIRE(doc.Contents() == "two and three five six!");
+		REQUIRE(recorder.bulkText == sText);
+		REQUIRE(Original() == sText);
+
+		// Unchanged text on both sides of the range
+		doc.document.BeginBulkChange();
+		doc.document.DeleteChars(4, 4);
+		doc.document.InsertString(10, "4 ");
+		doc.document.EndBulkChange();
+		REQUIRE(doc.Contents() == "two three 4 five six!");
+		REQUIRE(recorder.modifications.back().position == 4);
+		REQUIRE(recorder.modifications.back().length == 8);
+		REQUIRE(recorder.bulkText == "and three ");
+		REQUIRE(Original() == "two and three five six!");
+
+		// Not kept when no watcher asks for it
+		recorder.wantsText = false;
+		doc.document.BeginBulkChange();
+		doc.document.DeleteChars(0, 4);
+		doc.document.EndBulkChange();
+		REQUIRE(recorder.modifications.back().text == nullptr);
+		doc.document.RemoveWatcher(&recorder, nullptr);
+	}
+}
+
+TEST_CASE("Snapshot") {
+
+	auto SnapshotText = [](const IDocumentSnapshot *snapshot) {
+		std::string text(snapshot->Length(), '\0');
+		snapshot->GetCharRange(text.data(), 0, snapshot->Length());
+		return text;
+	};
+
+	SECTION("Lines") {
+		DocPlus doc("a\nbc\r\nd", 0);
+		doc.document.SetLevel(1, static_cast<int>(FoldLevel::Base) + 1);
+		IDocumentSnapshot *snapshot = doc.document.CreateSnapshot();
+		REQUIRE(snapshot->Length() == 7);
+		REQUIRE(snapshot->LineFromPosition(0) == 0);
+		REQUIRE(snapshot->LineFromPosition(3) == 1);
+		REQUIRE(snapshot->LineFromPosition(7) == 2);
+		REQUIRE(snapshot->LineStart(2) == 6);
+		REQUIRE(snapshot->LineStart(3) == 7);
+		REQUIRE(snapshot->LineEnd(1) == 4);
+		REQUIRE(snapshot->GetLevel(1) == static_cast<int>(FoldLevel::Base) + 1);
+		REQUIRE(snapshot->Release() == 0);
+	}
+
+	SECTION("SharedUntilChanged") {
+		DocPlus doc("abc\ndef", 0);
+		doc.document.StartStyling(0);
+		doc.document.SetStyleFor(4, 1);
+		IDocumentSnapshot *snapshot = doc.document.CreateSnapshot();
+		IDocumentSnapshot *second = doc.document.CreateSnapshot();
+		doc.document.StartStyling(0);
+		doc.document.SetStyleFor(7, 2);
+		doc.document.InsertString(1, "xyz\n");
+		doc.document.DeleteChars(6, 2);
+		REQUIRE(doc.Contents() == "axyz\nbdef");
+		REQUIRE(SnapshotText(snapshot) == "abc\ndef");
+		REQUIRE(SnapshotText(second) == "abc\ndef");
+		REQUIRE(snapshot->StyleAt(0) == 1);
+		REQUIRE(snapshot->StyleAt(5) == 0);
+		REQUIRE(snapshot->LineStart(1) == 4);
+		// Modifying a snapshot has no effect
+		REQUIRE(!snapshot->SetStyleFor(2, 3));
+		REQUIRE(snapshot->StyleAt(1) == 1);
+		REQUIRE(snapshot->Release() == 0);
+		REQUIRE(second->Release() == 0);
+	}
+
+	SECTION("ManyChanges") {
+		// Enough edits to exceed the pieces a snapshot tracks before copying everything
+		std::string original;
+		for (int i = 0; i < 300; i++) {
+			original += static_cast<char>('a' + i % 26);
+		}
+		DocPlus doc(original, 0);
+		doc.document.StartStyling(0);
+		doc.document.SetStyleFor(100, 1);
+		doc.document.SetStyleFor(200, 2);
+		IDocumentSnapshot *snapshot = doc.document.CreateSnapshot();
+		IDocumentSnapshot *second = nullptr;
+		std::string secondText;
+		unsigned int seed = 1;
+		auto Next = [&seed](unsigned int range) {
+			seed = seed * 1103515245 + 12345;
+			return static_cast<Sci::Position>((seed >> 16) % range);
+		};
+		for (int edit = 0; edit < 1500; edit++) {
+			const Sci::Position length = doc.document.Length();
+			const Sci::Position position = Next(static_cast<unsigned int>(length) + 1);
+			switch (Next(3)) {
+			case 0:
+				doc.document.InsertString(position, "XY");
+				break;
+			case 1:
+				if (position < length) {
+					doc.document.DeleteChars(position, std::min<Sci::Position>(3, length - position));
+				}
+				break;
+			default:
+				if (position < length) {
+					doc.document.StartStyling(position);
+					doc.document.SetStyleFor(std::min<Sci::Position>(5, length - position), static_cast<char>(3 + Next(4)));
+				}
+				break;
+			}
+			if (edit == 300) {
+				second = doc.document.CreateSnapshot();
+				secondText = doc.Contents();
+			}
+			if (edit % 100 == 0) {
+				REQUIRE(SnapshotText(snapshot) == original);
+			}
+		}
+		REQUIRE(SnapshotText(snapshot) == original);
+		for (Sci::Position position = 0; position < snapshot->Length(); position++) {
+			REQUIRE(snapshot->StyleAt(position) == ((position < 100) ? 1 : 2));
+		}
+		REQUIRE(SnapshotText(second) == secondText);
+		REQUIRE(std::string_view(snapshot->BufferPointer()) == original);
+		REQUIRE(snapshot->Release() == 0);
+		REQUIRE(second->Release() == 0);
+	}
+
+	SECTION("OutlivesDocument") {
+		IDocumentSnapshot *snapshot = nullptr;
+		{
+			DocPlus doc("text", 0);
+			snapshot = doc.document.CreateSnapshot();
+		}
+		REQUIRE(SnapshotText(snapshot) == "text");
+		REQUIRE(std::string_view(snapshot->BufferPointer()) == "text");
+		REQUIRE(snapshot->Release() == 0);
+	}
+
+	SECTION("UTF8") {
+		DocPlus doc("a\xc3\xa9\xe2\x82\xac" "b", CpUtf8);
+		IDocumentSnapshot *snapshot = doc.document.CreateSnapshot();
+		Sci_Position width = 0;
+		REQUIRE(snapshot->GetCharacterAndWidth(3, &width) == 0x20AC);
+		REQUIRE(width == 3);
+		REQUIRE(snapshot->GetRelativePosition(0, 3) == 6);
+		REQUIRE(snapshot->GetRelativePosition(6, -2) == 1);
+		REQUIRE(snapshot->GetRelativePosition(6, -4) == -1);
+		REQUIRE(snapshot->Release() == 0);
+	}
+}
+
+TEST_CASE("Hibernate") {
+
+	SECTION("WokenByWatcher") {
+		DocPlus doc("abc\ndef", 0);
+		doc.document.StartStyling(0);
+		doc.document.SetStyleFor(7, 2);
+		doc.document.InsertString(3, "xyz");
+		doc.document.AddMark(1, 2);
+		doc.document.SetLineState(1, 5);
+		IDocumentSnapshot *snapshot = doc.document.CreateSnapshot();
+		REQUIRE(doc.document.Hibernate(false));
+		REQUIRE(doc.document.GetEndStyled() == 0);
+		// Reads as empty while hibernating
+		REQUIRE(doc.document.Length() == 0);
+		REQUIRE(doc.document.LinesTotal() == 1);
+		// Already hibernating
+		REQUIRE(!doc.document.Hibernate(true));
+		// Snapshots are detached so still readable
+		REQUIRE(snapshot->Length() == 10);
+		REQUIRE(snapshot->StyleAt(0) == 2);
+		REQUIRE(snapshot->Release() == 0);
+
+		ModificationRecorder recorder;
+		doc.document.AddWatcher(&recorder, nullptr);
+		REQUIRE(doc.Contents() == "abcxyz\ndef");
+		REQUIRE(doc.document.StyleAt(0) == 0);
+		REQUIRE(doc.document.LinesTotal() == 2);
+		REQUIRE(doc.document.LineStart(1) == 7);
+		// Per-line data is kept
+		REQUIRE(doc.document.GetMark(1, false) == (1 << 2));
+		REQUIRE(doc.document.GetLineState(1) == 5);
+		// Can not hibernate while watched
+		REQUIRE(!doc.document.Hibernate(false));
+		doc.document.Undo();
+		REQUIRE(doc.Contents() == "abc\ndef");
+		doc.document.RemoveWatcher(&recorder, nullptr);
+
+		REQUIRE(doc.document.Hibernate(true));
+		doc.document.Wake();
+		doc.document.Redo();
+		REQUIRE(doc.Contents() == "abcxyz\ndef");
+	}
+
+	SECTION("SavePointAndFolds") {
+		// SciTE restores the selection, folds and bookmarks of a buffer after it wakes
+		// so its text, lines, fold levels, markers and save point must all be as before.
+		const std::string_view text = "int f() {\n\treturn 1;\n}\nint g;\n";
+		DocPlus doc(text, CpUtf8);
+		const int levelHeader = static_cast<int>(FoldLevel::Base) | static_cast<int>(FoldLevel::HeaderFlag);
+		const int levelBody = static_cast<int>(FoldLevel::Base) + 1;
+		const int levelBase = static_cast<int>(FoldLevel::Base);
+		doc.document.SetLevel(0, levelHeader);
+		doc.document.SetLevel(1, levelBody);
+		doc.document.SetLevel(2, levelBody);
+		doc.document.SetLevel(3, levelBase);
+		doc.document.AddMark(2, 1);
+		doc.document.SetSavePoint();
+		REQUIRE(doc.document.IsSavePoint());
+
+		// Woken at the save point
+		REQUIRE(doc.document.Hibernate(false));
+		doc.document.Wake();
+		REQUIRE(doc.Contents() == text);
+		REQUIRE(doc.document.IsSavePoint());
+
+		// Woken with changes after the save point
+		doc.document.InsertString(doc.document.LineStart(3), "// g\n");
+		REQUIRE(!doc.document.IsSavePoint());
+		const std::string changed = doc.Contents();
+		const Sci::Line lines = doc.document.LinesTotal();
+		for (const bool spill : { false, true }) {
+			REQUIRE(doc.document.Hibernate(spill));
+			doc.document.Wake();
+			REQUIRE(doc.Contents() == changed);
+			REQUIRE(!doc.document.IsSavePoint());
+			REQUIRE(doc.document.LinesTotal() == lines);
+			REQUIRE(doc.document.LineStart(3) == static_cast<Sci::Position>(text.find("int g")));
+			REQUIRE(doc.document.GetLevel(0) == levelHeader);
+			REQUIRE(doc.document.GetLevel(1) == levelBody);
+			REQUIRE(doc.document.GetLevel(2) == levelBody);
+			REQUIRE(doc.document.GetMark(2, false) == (1 << 1));
+		}
+		// Undo still reaches the save point
+		doc.document.Undo();
+		REQUIRE(doc.Contents() == text);
+		REQUIRE(doc.document.IsSavePoint());
+	}
+}
+
+TEST_CASE("Words") {
+
+	SECTION("WordsInText") {
+		const DocPlus doc(" abc ", 0);
+		REQUIRE(doc.document.IsWordAt(1, 4));
+		REQUIRE(!doc.document.IsWordAt(0, 1));
+		REQUIRE(!doc.document.IsWordAt(1, 2));
+		const DocPlus docPunct(" [!] ", 0);
+		REQUIRE(docPunct.document.IsWordAt(1, 4));
+		REQUIRE(!docPunct.document.IsWordAt(0, 1));
+		REQUIRE(!docPunct.document.IsWordAt(1, 2));
+		const DocPlus docMixed(" -ab ", 0);	// '-' is punctuation, 'ab' is word
+		REQUIRE(docMixed.document.IsWordAt(2, 4));
+		REQUIRE(docMixed.document.IsWordAt(1, 4));
+		REQUIRE(docMixed.document.IsWordAt(1, 2));
+		REQUIRE(!docMixed.document.IsWordAt(1, 3));	// 3 is between a and b so not word edge
+		// Scintilla's word definition just examines the ends
+		const DocPlus docOverSpace(" a b ", 0);
+		REQUIRE(docOverSpace.document.IsWordAt(1, 4));
+	}
+
+	SECTION("WordsAtEnds") {
+		const DocPlus doc("a c", 0);
+		REQUIRE(doc.document.IsWordAt(0, 1));
+		REQUIRE(doc.document.IsWordAt(2, 3));
+		const DocPlus docEndSpace(" a c ", 0);
+		REQUIRE(!docEndSpace.document.IsWordAt(0, 2));
+		REQUIRE(!docEndSpace.document.IsWordAt(3, 5));
+	}
+}
+
+TEST_CASE("SafeSegment") {
+	SECTION("Short") {
+		const DocPlus doc("", 0);
+		// all encoding: break before or after last space
+		constexpr std::string_view text = "12 ";
+		const size_t length = doc.document.SafeSegment(text);
+		REQUIRE(length <= text.length());
+		REQUIRE(text[length - 1] == '2');
+		REQUIRE(text[length] == ' ');
+	}
+
+	SECTION("ASCII") {
+		const DocPlus doc("", 0);
+		// all encoding: break before or after last space
+		std::string_view text = "12 3 \t45";
+		size_t length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == ' ');
+		REQUIRE(text[length] == '\t');
+
+		// UTF-8 and ASCII: word and punctuation boundary in middle of text
+		text = "(IsBreakSpace(text[j]))";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'j');
+		REQUIRE(text[length] == ']');
+
+		// UTF-8 and ASCII: word and punctuation boundary near start of text
+		text = "(IsBreakSpace";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '(');
+		REQUIRE(text[length] == 'I');
+
+		// UTF-8 and ASCII: word and punctuation boundary near end of text
+		text = "IsBreakSpace)";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'e');
+		REQUIRE(text[length] == ')');
+
+		// break before last character
+		text = "JapaneseJa";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'J');
+		REQUIRE(text[length] == 'a');
+	}
+
+	SECTION("UTF-8") {
+		const DocPlus doc("", CpUtf8);
+		// break before last character: no trail byte
+		std::string_view text = "JapaneseJa";
+		size_t length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'J');
+		REQUIRE(text[length] == 'a');
+
+		// break before last character: 1 trail byte
+		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xc2\xa9";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\x9e');
+		REQUIRE(text[length] == '\xc2');
+
+		// break before last character: 2 trail bytes
+		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\xac');
+		REQUIRE(text[length] == '\xe8');
+
+		// break before last character: 3 trail bytes
+		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xf0\x9f\x98\x8a";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\x9e');
+		REQUIRE(text[length] == '\xf0');
+	}
+
+	SECTION("UTF-8 Character Fragments") {
+		// PositionCache breaks long texts into fixed length sub-strings that are passed to SafeSegment
+		// so the final character in the sub-string may be incomplete without all needed trail bytes.
+		// For UTF-8, SafeSegment first discards any final bytes that do not represent a valid character
+		// then discards the final whole character.
+
+		const DocPlus doc("", CpUtf8);
+
+		// break before last character after discarding incomplete last character: 0 trail byte
+		std::string_view text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xc2";	// Invalid text as ends with start byte
+		size_t length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\xac');
+		REQUIRE(text[length] == '\xe8');
+		REQUIRE(UTF8IsValid(text.substr(0, length)));
+
+		// break before last character after discarding incomplete last character: 1 trail byte and 2 needed
+		text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe6\x97";	// Invalid text as ends with only 1 trail byte
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\xac');
+		REQUIRE(text[length] == '\xe8');
+		REQUIRE(UTF8IsValid(text.substr(0, length)));
+	}
+
+	SECTION("UTF-8 Combining Characters") {
+		const DocPlus doc("", CpUtf8);
+
+		// There may be combining characters like accents and tone marks after the
+		// last letter in a sub-string and these may be included in the sub-string
+		// or follow it.
+		// Correct display requires that the combining characters are measured and
+		// drawn with the letter they follow. Thus the final letter and any
+		// following combining characters are discarded.
+
+		// A Thai text example with 8 characters, each taking 3 bytes:
+		// HO HIP, SARA AA, KHO KHAI, MAI THO, O ANG, MO MA, SARA UU, LO LING
+		// Most are letters (Lo) but 2 characters are modifiers (Mn):
+		// MAI THO is a tone mark and SARA UU is a vowel.
+		const std::string_view text = "\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\x82\xe0\xb9\x89\xe0\xb8\xad\xe0\xb8\xa1\xe0\xb8\xb9\xe0\xb8\xa5";
+		REQUIRE(text.length() == 8 * 3);
+		size_t length = doc.document.SafeSegment(text);
+		REQUIRE(length == (8 - 1) * 3);	// Discard last character
+
+		// Remove last character (letter LO LING) then run again.
+		// Should skip past SARA UU combining vowel mark to discard letter MO MA and SARA UU.
+		const std::string_view textWithoutLoLing = text.substr(0, length);
+		length = doc.document.SafeSegment(textWithoutLoLing);
+		REQUIRE(length == (8 - 3) * 3);	// Discard 2 characters
+
+		// Remove last character SARA UU combining vowel mark then run again
+		// Final letter may have following combining mark so discard producing same text as previous step.
+		const std::string_view textWithoutSaraUu = text.substr(0, (8 - 2) * 3);
+		length = doc.document.SafeSegment(textWithoutSaraUu);
+		REQUIRE(length == (8 - 3) * 3);	// Discard 1 character
+	}
+
+	SECTION("DBCS Shift-JIS") {
+		const DocPlus doc("", 932);
+		// word and punctuation boundary in middle of text: single byte
+		std::string_view text = "(IsBreakSpace(text[j]))";
+		size_t length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'j');
+		REQUIRE(text[length] == ']');
+
+		// word and punctuation boundary in middle of text: double byte
+		text = "(IsBreakSpace(text[\x8c\xea]))";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\xea');
+		REQUIRE(text[length] == ']');
+
+		// word and punctuation boundary near start of text
+		text = "(IsBreakSpace";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '(');
+		REQUIRE(text[length] == 'I');
+
+		// word and punctuation boundary near end of text: single byte
+		text = "IsBreakSpace)";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'e');
+		REQUIRE(text[length] == ')');
+
+		// word and punctuation boundary near end of text: double byte
+		text = "IsBreakSpace\x8c\xea)";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\xea');
+		REQUIRE(text[length] == ')');
+
+		// break before last character: single byte
+		text = "JapaneseJa";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == 'J');
+		REQUIRE(text[length] == 'a');
+
+		// break before last character: double byte
+		text = "Japanese\x93\xfa\x96\x7b\x8c\xea";
+		length = doc.document.SafeSegment(text);
+		REQUIRE(text[length - 1] == '\x7b');
+		REQUIRE(text[length] == '\x8c');
+	}
+}
+
+TEST_CASE("DiscardLastCombinedCharacter") {
+	SECTION("Short") {
+		const std::string_view base = "12345";
+		// Short strings (up to 4 bytes) aren't changed to avoid null and problematic results
+		for (size_t len = 0; len < 5; len++) {
+			std::string_view text = base.substr(0, len);
+			REQUIRE(text.length() == len);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(!changed);
+			REQUIRE(text.length() == len);
+		}
+	}
+
+	SECTION("ASCII") {
+		std::string_view text = "12345";
+		REQUIRE(text.length() == 5);
+		const bool changed = DiscardLastCombinedCharacter(text);
+		REQUIRE(changed);
+		REQUIRE(text.length() == 4);
+	}
+
+	SECTION("Control") {
+		{
+			std::string_view text = "12345\007";
+			REQUIRE(text.length() == 6);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			REQUIRE(text.length() == 5);
+		}
+		{
+			std::string_view text = "12345\007Z";
+			REQUIRE(text.length() == 7);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			REQUIRE(text.length() == 6);
+		}
+	}
+
+	SECTION("Japanese") {
+		std::string_view text = "Japanese\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
+		REQUIRE(text.length() == 17);
+		const bool changed = DiscardLastCombinedCharacter(text);
+		REQUIRE(changed);
+		REQUIRE(text.length() == 14);
+	}
+
+	SECTION("Thai Combining") {
+		// Ends with two combined characters
+		// 7 characters, 5 base characters and 2 combining
+		// HO HIP, SARA AA, KHO KHAI, MAI THO, O ANG, MO MA, SARA UU
+		std::string_view text = "\xe0\xb8\xab\xe0\xb8\xb2\xe0\xb8\x82\xe0\xb9\x89\xe0\xb8\xad\xe0\xb8\xa1\xe0\xb8\xb9";
+		REQUIRE(text.length() == 21);
+		const bool changed = DiscardLastCombinedCharacter(text);
+		REQUIRE(changed);
+		// Discarded 2 x 3-byte characters
+		REQUIRE(text.length() == 15);
+	}
+
+	SECTION("Invalid UTF-8") {
+		{
+			// Ends with isolated lead byte
+			std::string_view text = "1234\xe0";
+			REQUIRE(text.length() == 5);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded final invalid byte
+			REQUIRE(text.length() == 4);
+		}
+		{
+			// Ends with isolated trail byte
+			std::string_view text = "1234\xb8";
+			REQUIRE(text.length() == 5);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded final invalid byte
+			REQUIRE(text.length() == 4);
+		}
+		{
+			// Ends with lead byte and only one of two required trail bytes
+			std::string_view text = "1234\xe0\xb8";
+			REQUIRE(text.length() == 6);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded final invalid byte
+			REQUIRE(text.length() == 5);
+		}
+	}
+
+	SECTION("Private Use UTF-8") {
+		{
+			// Ends with private use area U+F8FF - Apple uses for apple symbol.
+			std::string_view text = "1234\xEF\xA3\xBF";
+			REQUIRE(text.length() == 7);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded whole final character
+			REQUIRE(text.length() == 4);
+		}
+		{
+			// At end: PUA + letter: PUA acts as base
+			std::string_view text = "1234\xEF\xA3\xBFZ";
+			REQUIRE(text.length() == 8);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded just final character
+			REQUIRE(text.length() == 7);
+		}
+	}
+
+	SECTION("Surrogates") {
+		{
+			// Ends with surrogate U+D800.
+			std::string_view text = "1234\xED\xA0\x80";
+			REQUIRE(text.length() == 7);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded final invalid byte
+			REQUIRE(text.length() == 6);
+		}
+		{
+			// Ends with surrogate U+DC00.
+			std::string_view text = "1234\xED\xB0\x80";
+			REQUIRE(text.length() == 7);
+			const bool changed = DiscardLastCombinedCharacter(text);
+			REQUIRE(changed);
+			// Discarded final invalid byte
+			REQUIRE(text.length() == 6);
+		}
+	}
+}
+
+TEST_CASE("PerLine") {
+	SECTION("LineMarkers") {
+		DocPlus doc("1\n2\n", CpUtf8);
+		REQUIRE(doc.document.LinesTotal() == 3);
+		const int mh1 = doc.document.AddMark(0, 0);
+		const int mh2 = doc.document.AddMark(1, 1);
+		const int mh3 = doc.document.AddMark(2, 2);
+		REQUIRE(mh1 != -1);
+		REQUIRE(mh2 != -1);
+		REQUIRE(mh3 != -1);
+		REQUIRE(doc.document.AddMark(3, 3) == -1);
+
+		// delete first character, no change
+		REQUIRE(doc.document.CharAt(0) == '1');
+		doc.document.DeleteChars(0, 1);
+		REQUIRE(doc.document.LinesTotal() == 3);
+		REQUIRE(doc.document.MarkerHandleFromLine(0, 0) == mh1);
+		REQUIRE(doc.document.MarkerHandleFromLine(0, 1) == -1);
+		REQUIRE(doc.document.MarkerHandleFromLine(1, 0) == mh2);
+		REQUIRE(doc.document.MarkerHandleFromLine(1, 1) == -1);
+
+		// delete first line, so merged
+		REQUIRE(doc.document.CharAt(0) == '\n');
+		doc.document.DeleteChars(0, 1);
+		REQUIRE(doc.document.CharAt(0) == '2');
+		const std::set handleSet {mh1, mh2};
+		const int handle1 = doc.document.MarkerHandleFromLine(0, 0);
+		const int handle2 = doc.document.MarkerHandleFromLine(0, 1);
+		REQUIRE(handle1 != handle2);
+		REQUIRE(handleSet.count(handle1) == 1);
+		REQUIRE(handleSet.count(handle2) == 1);
+		REQUIRE(doc.document.MarkerHandleFromLine(0, 2) == -1);
+		REQUIRE(doc.document.MarkerHandleFromLine(1, 0) == mh3);
+		REQUIRE(doc.document.MarkerHandleFromLine(1, 1) == -1);
+	}
+
+	SECTION("LineAnnotation") {
+		DocPlus doc("1\n2\n", CpUtf8);
+		REQUIRE(doc.document.LinesTotal() == 3);
+		Sci::Position length = doc.document.Length();
+		doc.document.AnnotationSetText(0, "1");
+		doc.document.AnnotationSetText(1, "1\n2");
+		doc.document.AnnotationSetText(2, "1\n2\n3");
+		REQUIRE(doc.document.AnnotationLines(0) == 1);
+		REQUIRE(doc.document.AnnotationLines(1) == 2);
+		REQUIRE(doc.document.AnnotationLines(2) == 3);
+		REQUIRE(doc.document.AnnotationLines(3) == 0);
+
+		// delete last line
+		length -= 1;
+		doc.document.DeleteChars(length, 1);
+		// Deleting the last line moves its 3-line annotation to previous line,
+		// deleting the 2-line annotation of the previous line.
+		REQUIRE(doc.document.LinesTotal() == 2);
+		REQUIRE(doc.document.AnnotationLines(0) == 1);
+		REQUIRE(doc.document.AnnotationLines(1) == 3);
+		REQUIRE(doc.document.AnnotationLines(2) == 0);
+
+		// delete last character, no change
+		length -= 1;
+		REQUIRE(doc.document.CharAt(length) == '2');
+		doc.document.DeleteChars(length, 1);
+		REQUIRE(doc.document.LinesTotal() == 2);
+		REQUIRE(doc.document.AnnotationLines(0) == 1);
+		REQUIRE(doc.document.AnnotationLines(1) == 3);
+		REQUIRE(doc.document.AnnotationLines(2) == 0);
+	}
+}
@@ -0,0 +1,118 @@
+/** @file testPaintBands.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+#include <algorithm>
+
+#include "Position.h"
+#include "PaintBands.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla::Internal;
+
+// Test PaintBands.
+
+namespace {
+
+struct ScreenLine {
+	Sci::Line lineDoc;
+};
+
+// Screen lines for document lines each wrapped into the given number of sub-lines
+std::vector<ScreenLine> ScreenLines(const std::vector<int> &subLines) {
+	std::vector<ScreenLine> lines;
+	Sci::Line lineDoc = 0;
+	for (const int count : subLines) {
+		for (int subLine = 0; subLine < count; subLine++) {
+			lines.push_back({ lineDoc });
+		}
+		lineDoc++;
+	}
+	return lines;
+}
+
+// Bands must tile all the screen lines in order and not split a document line.
+void CheckTiled(const std::vector<BandRange> &bands, const std::vector<ScreenLine> &lines) {
+	size_t position = 0;
+	for (const BandRange &band : bands) {
+		REQUIRE(band.start == position);
+		REQUIRE(band.end > band.start);
+		if (band.start > 0) {
+			REQUIRE(lines[band.start].lineDoc != lines[band.start - 1].lineDoc);
+		}
+		position = band.end;
+	}
+	REQUIRE(position == lines.size());
+}
+
+}
+
+TEST_CASE("PaintBands") {
+
+	SECTION("Empty") {
+		const std::vector<ScreenLine> lines;
+		REQUIRE(PartitionBands(lines, 4).empty());
+	}
+
+	SECTION("OneThread") {
+		const std::vector<ScreenLine> lines = ScreenLines({ 1, 1, 1, 1, 1 });
+		const std::vector<BandRange> bands = PartitionBands(lines, 1);
+		REQUIRE(bands.size() == 1);
+		CheckTiled(bands, lines);
+	}
+
+	SECTION("NoThreads") {
+		const std::vector<ScreenLine> lines = ScreenLines({ 1, 1, 1 });
+		const std::vector<BandRange> bands = PartitionBands(lines, 0);
+		REQUIRE(bands.size() == 1);
+		CheckTiled(bands, lines);
+	}
+
+	SECTION("Even") {
+		const std::vector<ScreenLine> lines = ScreenLines(std::vector<int>(40, 1));
+		const std::vector<BandRange> bands = PartitionBands(lines, 4);
+		REQUIRE(bands.size() == 4);
+		CheckTiled(bands, lines);
+		for (const BandRange &band : bands) {
+			REQUIRE(band.end - band.start == 10);
+		}
+	}
+
+	SECTION("Uneven") {
+		const std::vector<ScreenLine> lines = ScreenLines(std::vector<int>(10, 1));
+		const std::vector<BandRange> bands = PartitionBands(lines, 4);
+		REQUIRE(bands.size() == 4);
+		CheckTiled(bands, lines);
+		REQUIRE(bands.back().end - bands.back().start == 1);
+	}
+
+	SECTION("MoreThreadsThanLines") {
+		const std::vector<ScreenLine> lines = ScreenLines({ 1, 1, 1 });
+		const std::vector<BandRange> bands = PartitionBands(lines, 16);
+		REQUIRE(bands.size() == 3);
+		CheckTiled(bands, lines);
+	}
+
+	SECTION("WrappedLinesKeptTogether") {
+		const std::vector<ScreenLine> lines = ScreenLines({ 1, 3, 2, 4, 1, 1, 5 });
+		for (size_t threads = 1; threads <= lines.size() + 1; threads++) {
+			const std::vector<BandRange> bands = PartitionBands(lines, threads);
+			REQUIRE(bands.size() <= threads);
+			CheckTiled(bands, lines);
+		}
+	}
+
+	SECTION("OneWrappedLine") {
+		// A single document line filling the screen can not be divided
+		const std::vector<ScreenLine> lines = ScreenLines({ 20 });
+		const std::vector<BandRange> bands = PartitionBands(lines, 4);
+		REQUIRE(bands.size() == 1);
+		CheckTiled(bands, lines);
+	}
+
+}
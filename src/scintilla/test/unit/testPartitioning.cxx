@@ -1,224 +1,370 @@
-/** @file testPartitioning.cxx
- ** Unit Tests for Scintilla internal data structures
- **/
-
-#include <cstddef>
-#include <cstring>
-
-#include <stdexcept>
-#include <string_view>
-#include <vector>
-#include <optional>
-#include <algorithm>
-#include <memory>
-
-#include "Debugging.h"
-
-#include "Position.h"
-#include "SplitVector.h"
-#include "Partitioning.h"
-
-#include "catch.hpp"
-
-using namespace Scintilla::Internal;
-
-// Test Partitioning.
-
-TEST_CASE("CompileCopying Partitioning") {
-
-	// These are compile-time tests to check that basic copy and move
-	// operations are defined correctly.
-
-	SECTION("CopyingMoving") {
-		Partitioning<int> s;
-		Partitioning<int> s2;
-
-		// Copy constructor
-		const Partitioning<int> sa(s);
-		// Copy assignment
-		Partitioning<int> sb;
-		sb = s;
-
-		// Move constructor
-		const Partitioning<int> sc(std::move(s));
-		// Move assignment
-		Partitioning<int> sd;
-		sd = (std::move(s2));
-	}
-
-}
-
-TEST_CASE("Partitioning") {
-
-	Partitioning<Sci::Position> part;
-
-	SECTION("IsEmptyInitially") {
-		REQUIRE(1 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
-		REQUIRE(0 == part.PartitionFromPosition(0));
-	}
-
-	SECTION("SimpleInsert") {
-		part.InsertText(0, 1);
-		REQUIRE(1 == part.Partitions());
-		REQUIRE(1 == part.PositionFromPartition(part.Partitions()));
-	}
-
-	SECTION("TwoPartitions") {
-		part.InsertText(0, 2);
-		part.InsertPartition(1, 1);
-		REQUIRE(2 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(1 == part.PositionFromPartition(1));
-		REQUIRE(2 == part.PositionFromPartition(2));
-	}
-
-	SECTION("MoveStart") {
-		part.InsertText(0, 3);
-		part.InsertPartition(1, 2);
-		part.SetPartitionStartPosition(1,1);
-		REQUIRE(2 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(1 == part.PositionFromPartition(1));
-		REQUIRE(3 == part.PositionFromPartition(2));
-		part.Check();
-	}
-
-	SECTION("InsertAgain") {
-		part.InsertText(0, 3);
-		part.InsertPartition(1, 2);
-		part.InsertText(0,3);
-		part.InsertText(1,2);
-		REQUIRE(2 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(5 == part.PositionFromPartition(1));
-		REQUIRE(8 == part.PositionFromPartition(2));
-		part.Check();
-	}
-
-	SECTION("InsertMultiple") {
-		part.InsertText(0, 10);
-		const Sci::Position positions[] { 2, 5, 7 };
-		part.InsertPartitions(1, positions, std::size(positions));
-		REQUIRE(4 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(2 == part.PositionFromPartition(1));
-		REQUIRE(5 == part.PositionFromPartition(2));
-		REQUIRE(7 == part.PositionFromPartition(3));
-		REQUIRE(10 == part.PositionFromPartition(4));
-		part.Check();
-	}
-
-	SECTION("InsertMultipleWithCast") {
-		part.InsertText(0, 9);
-		REQUIRE(1 == part.Partitions());
-		const ptrdiff_t positionsp[]{ 2, 4, 6, 8 };
-		part.InsertPartitionsWithCast(1, positionsp, std::size(positionsp));
-		REQUIRE(5 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(2 == part.PositionFromPartition(1));
-		REQUIRE(4 == part.PositionFromPartition(2));
-		REQUIRE(6 == part.PositionFromPartition(3));
-		REQUIRE(8 == part.PositionFromPartition(4));
-		REQUIRE(9 == part.PositionFromPartition(5));
-		part.Check();
-	}
-
-	SECTION("InsertReversed") {
-		part.InsertText(0, 3);
-		part.InsertPartition(1, 2);
-		part.InsertText(1,2);
-		part.InsertText(0,3);
-		REQUIRE(2 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(5 == part.PositionFromPartition(1));
-		REQUIRE(8 == part.PositionFromPartition(2));
-		part.Check();
-	}
-
-	SECTION("InverseSearch") {
-		part.InsertText(0, 3);
-		part.InsertPartition(1, 2);
-		part.SetPartitionStartPosition(1,1);
-
-		REQUIRE(2 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(1 == part.PositionFromPartition(1));
-		REQUIRE(3 == part.PositionFromPartition(2));
-
-		REQUIRE(0 == part.PartitionFromPosition(0));
-		REQUIRE(1 == part.PartitionFromPosition(1));
-		REQUIRE(1 == part.PartitionFromPosition(2));
-
-		REQUIRE(1 == part.PartitionFromPosition(3));
-		part.Check();
-	}
-
-	SECTION("DeletePartition") {
-		part.InsertText(0, 2);
-		part.InsertPartition(1, 1);
-		part.RemovePartition(1);
-		REQUIRE(1 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(2 == part.PositionFromPartition(1));
-		part.Check();
-	}
-
-	SECTION("DeleteAll") {
-		part.InsertText(0, 3);
-		part.InsertPartition(1, 2);
-		part.SetPartitionStartPosition(1,1);
-		part.DeleteAll();
-		// Back to initial state
-		REQUIRE(1 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
-	}
-
-	SECTION("TestBackwards") {
-		part.InsertText(0, 10);
-		part.InsertPartition(1, 3);
-		part.InsertPartition(2, 6);
-		part.InsertPartition(3, 9);
-		part.InsertText(2,4);
-		part.InsertText(1,2);
-		part.InsertText(0,3);
-		REQUIRE(4 == part.Partitions());
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(6 == part.PositionFromPartition(1));
-		REQUIRE(11 == part.PositionFromPartition(2));
-		REQUIRE(18 == part.PositionFromPartition(3));
-		REQUIRE(19 == part.PositionFromPartition(4));
-		part.Check();
-	}
-
-	SECTION("TestMany") {
-		// Provoke backstep call
-		part.InsertText(0, 42);
-		for (int i=0; i<20; i++) {
-			part.InsertPartition(i+1, (i+1) * 2);
-		}
-		for (int i=20; i>0; i--) {
-			part.InsertText(i,2);
-		}
-		REQUIRE(21 == part.Partitions());
-		for (int i=1; i<20; i++) {
-			REQUIRE((i*4 - 2) == part.PositionFromPartition(i));
-			REQUIRE(i == part.PartitionFromPosition(i*4 - 2));
-		}
-		part.InsertText(19,2);
-		REQUIRE(3 == part.PartitionFromPosition(10));
-		part.InsertText(0,2);
-		part.InsertText(0,-2);
-		part.RemovePartition(1);
-		REQUIRE(0 == part.PositionFromPartition(0));
-		REQUIRE(6 == part.PositionFromPartition(1));
-		REQUIRE(10 == part.PositionFromPartition(2));
-		part.RemovePartition(10);
-		REQUIRE(46 == part.PositionFromPartition(10));
-		REQUIRE(10 == part.PartitionFromPosition(46));
-		REQUIRE(50 == part.PositionFromPartition(11));
-		REQUIRE(11 == part.PartitionFromPosition(50));
-		part.Check();
-	}
-
-}
+/** @file testPartitioning.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstring>
+
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "Debugging.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla::Internal;
+
+// Test Partitioning.
+
+TEST_CASE("CompileCopying Partitioning") {
+
+	// These are compile-time tests to check that basic copy and move
+	// operations are defined correctly.
+
+	SECTION("CopyingMoving") {
+		Partitioning<int> s;
+		Partitioning<int> s2;
+
+		// Copy constructor
+		const Partitioning<int> sa(s);
+		// Copy assignment
+		Partitioning<int> sb;
+		sb = s;
+
+		// Move constructor
+		const Partitioning<int> sc(std::move(s));
+		// Move assignment
+		Partitioning<int> sd;
+		sd = (std::move(s2));
+	}
+
+	SECTION("CopyingMovingTree") {
+		TreePartitioning<int> s;
+		TreePartitioning<int> s2;
+
+		// Copy constructor
+		const TreePartitioning<int> sa(s);
+		// Copy assignment
+		TreePartitioning<int> sb;
+		sb = s;
+
+		// Move constructor
+		const TreePartitioning<int> sc(std::move(s));
+		// Move assignment
+		TreePartitioning<int> sd;
+		sd = (std::move(s2));
+	}
+
+}
+
+TEMPLATE_TEST_CASE("Partitioning", "", Partitioning<Sci::Position>, TreePartitioning<Sci::Position>) {
+
+	TestType part;
+
+	SECTION("IsEmptyInitially") {
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
+		REQUIRE(0 == part.PartitionFromPosition(0));
+	}
+
+	SECTION("SimpleInsert") {
+		part.InsertText(0, 1);
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(1 == part.PositionFromPartition(part.Partitions()));
+	}
+
+	SECTION("TwoPartitions") {
+		part.InsertText(0, 2);
+		part.InsertPartition(1, 1);
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(1 == part.PositionFromPartition(1));
+		REQUIRE(2 == part.PositionFromPartition(2));
+	}
+
+	SECTION("MoveStart") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.SetPartitionStartPosition(1,1);
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(1 == part.PositionFromPartition(1));
+		REQUIRE(3 == part.PositionFromPartition(2));
+		part.Check();
+	}
+
+	SECTION("InsertAgain") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.InsertText(0,3);
+		part.InsertText(1,2);
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(5 == part.PositionFromPartition(1));
+		REQUIRE(8 == part.PositionFromPartition(2));
+		part.Check();
+	}
+
+	SECTION("InsertMultiple") {
+		part.InsertText(0, 10);
+		const Sci::Position positions[] { 2, 5, 7 };
+		part.InsertPartitions(1, positions, std::size(positions));
+		REQUIRE(4 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(2 == part.PositionFromPartition(1));
+		REQUIRE(5 == part.PositionFromPartition(2));
+		REQUIRE(7 == part.PositionFromPartition(3));
+		REQUIRE(10 == part.PositionFromPartition(4));
+		part.Check();
+	}
+
+	SECTION("InsertMultipleWithCast") {
+		part.InsertText(0, 9);
+		REQUIRE(1 == part.Partitions());
+		const ptrdiff_t positionsp[]{ 2, 4, 6, 8 };
+		part.InsertPartitionsWithCast(1, positionsp, std::size(positionsp));
+		REQUIRE(5 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(2 == part.PositionFromPartition(1));
+		REQUIRE(4 == part.PositionFromPartition(2));
+		REQUIRE(6 == part.PositionFromPartition(3));
+		REQUIRE(8 == part.PositionFromPartition(4));
+		REQUIRE(9 == part.PositionFromPartition(5));
+		part.Check();
+	}
+
+	SECTION("InsertReversed") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.InsertText(1,2);
+		part.InsertText(0,3);
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(5 == part.PositionFromPartition(1));
+		REQUIRE(8 == part.PositionFromPartition(2));
+		part.Check();
+	}
+
+	SECTION("InverseSearch") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.SetPartitionStartPosition(1,1);
+
+		REQUIRE(2 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(1 == part.PositionFromPartition(1));
+		REQUIRE(3 == part.PositionFromPartition(2));
+
+		REQUIRE(0 == part.PartitionFromPosition(0));
+		REQUIRE(1 == part.PartitionFromPosition(1));
+		REQUIRE(1 == part.PartitionFromPosition(2));
+
+		REQUIRE(1 == part.PartitionFromPosition(3));
+		part.Check();
+	}
+
+	SECTION("DeletePartition") {
+		part.InsertText(0, 2);
+		part.InsertPartition(1, 1);
+		part.RemovePartition(1);
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(2 == part.PositionFromPartition(1));
+		part.Check();
+	}
+
+	SECTION("DeleteAll") {
+		part.InsertText(0, 3);
+		part.InsertPartition(1, 2);
+		part.SetPartitionStartPosition(1,1);
+		part.DeleteAll();
+		// Back to initial state
+		REQUIRE(1 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(part.Partitions()));
+	}
+
+	SECTION("TestBackwards") {
+		part.InsertText(0, 10);
+		part.InsertPartition(1, 3);
+		part.InsertPartition(2, 6);
+		part.InsertPartition(3, 9);
+		part.InsertText(2,4);
+		part.InsertText(1,2);
+		part.InsertText(0,3);
+		REQUIRE(4 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(6 == part.PositionFromPartition(1));
+		REQUIRE(11 == part.PositionFromPartition(2));
+		REQUIRE(18 == part.PositionFromPartition(3));
+		REQUIRE(19 == part.PositionFromPartition(4));
+		part.Check();
+	}
+
+	SECTION("TestMany") {
+		// Provoke backstep call
+		part.InsertText(0, 42);
+		for (int i=0; i<20; i++) {
+			part.InsertPartition(i+1, (i+1) * 2);
+		}
+		for (int i=20; i>0; i--) {
+			part.InsertText(i,2);
+		}
+		REQUIRE(21 == part.Partitions());
+		for (int i=1; i<20; i++) {
+			REQUIRE((i*4 - 2) == part.PositionFromPartition(i));
+			REQUIRE(i == part.PartitionFromPosition(i*4 - 2));
+		}
+		part.InsertText(19,2);
+		REQUIRE(3 == part.PartitionFromPosition(10));
+		part.InsertText(0,2);
+		part.InsertText(0,-2);
+		part.RemovePartition(1);
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(6 == part.PositionFromPartition(1));
+		REQUIRE(10 == part.PositionFromPartition(2));
+		part.RemovePartition(10);
+		REQUIRE(46 == part.PositionFromPartition(10));
+		REQUIRE(10 == part.PartitionFromPosition(46));
+		REQUIRE(50 == part.PositionFromPartition(11));
+		REQUIRE(11 == part.PartitionFromPosition(50));
+		part.Check();
+	}
+
+}
+
+namespace {
+
+// Reproducible pseudo-random numbers from a linear congruential generator.
+
+class RandomSequence {
+	static constexpr int mult = 25173;
+	static constexpr int incr = 13849;
+	static constexpr int modulus = 65536;
+	int randomValue = 127;
+public:
+	int Next(int range) noexcept {
+		randomValue = (mult * randomValue + incr) % modulus;
+		return randomValue % range;
+	}
+};
+
+template <typename T>
+void CheckSame(const Partitioning<T> &part, const TreePartitioning<T> &tree) {
+	REQUIRE(part.Partitions() == tree.Partitions());
+	for (T partition = 0; partition <= part.Partitions(); partition++) {
+		REQUIRE(part.PositionFromPartition(partition) == tree.PositionFromPartition(partition));
+	}
+	for (T pos = -1; pos <= part.Length() + 1; pos++) {
+		REQUIRE(part.PartitionFromPosition(pos) == tree.PartitionFromPosition(pos));
+	}
+	tree.Check();
+}
+
+}
+
+TEST_CASE("TreePartitioning") {
+
+	// Perform the same scattered modifications on a Partitioning and a TreePartitioning
+	// with enough partitions to split and merge blocks.
+
+	Partitioning<int> part;
+	TreePartitioning<int> tree;
+	RandomSequence rs;
+
+	auto width = [&part](int partition) {
+		return part.PositionFromPartition(partition + 1) - part.PositionFromPartition(partition);
+	};
+
+	SECTION("Build") {
+		for (int i = 0; i < 3000; i++) {
+			const int length = 1 + rs.Next(10);
+			part.InsertText(part.Partitions() - 1, length);
+			tree.InsertText(tree.Partitions() - 1, length);
+			const int end = part.Length();
+			part.InsertPartition(part.Partitions(), end);
+			tree.InsertPartition(tree.Partitions(), end);
+			part.InsertText(part.Partitions() - 1, 1);
+			tree.InsertText(tree.Partitions() - 1, 1);
+		}
+		CheckSame(part, tree);
+
+		// Many partitions inserted at once into the middle
+		const int middle = part.Partitions() / 2;
+		part.InsertText(middle, 10000);
+		tree.InsertText(middle, 10000);
+		std::vector<int> positions;
+		const int start = part.PositionFromPartition(middle);
+		for (int i = 1; i <= 4000; i++) {
+			positions.push_back(start + i * 2);
+		}
+		part.InsertPartitions(middle + 1, positions.data(), positions.size());
+		tree.InsertPartitions(middle + 1, positions.data(), positions.size());
+		CheckSame(part, tree);
+
+		for (int step = 0; step < 20000; step++) {
+			const int partition = rs.Next(part.Partitions());
+			switch (rs.Next(4)) {
+			case 0: {
+					const int delta = 1 + rs.Next(5);
+					part.InsertText(partition, delta);
+					tree.InsertText(partition, delta);
+				}
+				break;
+			case 1:
+				if (width(partition) > 1) {
+					const int delta = -1 - rs.Next(width(partition) - 1);
+					part.InsertText(partition, delta);
+					tree.InsertText(partition, delta);
+				}
+				break;
+			case 2:
+				if (width(partition) > 1) {
+					const int pos = part.PositionFromPartition(partition) + 1 + rs.Next(width(partition) - 1);
+					part.InsertPartition(partition + 1, pos);
+					tree.InsertPartition(partition + 1, pos);
+				}
+				break;
+			default:
+				if (partition > 0) {
+					part.RemovePartition(partition);
+					tree.RemovePartition(partition);
+				}
+				break;
+			}
+			if (step % 2000 == 0) {
+				const int moved = 1 + rs.Next(part.Partitions() - 1);
+				const int before = part.PositionFromPartition(moved - 1);
+				const int after = part.PositionFromPartition(moved + 1);
+				if (after - before > 1) {
+					const int pos = before + 1 + rs.Next(after - before - 1);
+					part.SetPartitionStartPosition(moved, pos);
+					tree.SetPartitionStartPosition(moved, pos);
+				}
+				CheckSame(part, tree);
+			}
+		}
+		CheckSame(part, tree);
+
+		// Remove from both ends to merge blocks down to one
+		while (part.Partitions() > 1) {
+			const int partition = (part.Partitions() % 2) ? 1 : part.Partitions() - 1;
+			part.RemovePartition(partition);
+			tree.RemovePartition(partition);
+			REQUIRE(part.PositionFromPartition(part.Partitions()) == tree.PositionFromPartition(tree.Partitions()));
+		}
+		CheckSame(part, tree);
+
+		tree.DeleteAll();
+		REQUIRE(1 == tree.Partitions());
+		REQUIRE(0 == tree.Length());
+	}
+
+}
@@ -0,0 +1,116 @@
+/** @file testWrapPending.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+
+#include "Position.h"
+#include "WrapPending.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla::Internal;
+
+// Test WrapPending.
+
+TEST_CASE("WrapPending") {
+
+	WrapPending wp;
+
+	SECTION("IsEmptyInitially") {
+		REQUIRE(!wp.NeedsWrap());
+	}
+
+	SECTION("AddRange") {
+		REQUIRE(wp.AddRange(10, 20));
+		REQUIRE(wp.NeedsWrap());
+		REQUIRE(10 == wp.start);
+		REQUIRE(20 == wp.end);
+		// Inside current range
+		REQUIRE(!wp.AddRange(12, 15));
+		// Extends both ends
+		REQUIRE(wp.AddRange(5, 25));
+		REQUIRE(5 == wp.start);
+		REQUIRE(25 == wp.end);
+		wp.Reset();
+		REQUIRE(!wp.NeedsWrap());
+	}
+
+	SECTION("Wrapped") {
+		wp.AddRange(10, 12);
+		wp.Wrapped(11);
+		REQUIRE(10 == wp.start);
+		wp.Wrapped(10);
+		wp.Wrapped(11);
+		REQUIRE(!wp.NeedsWrap());
+	}
+
+	SECTION("WrappedBlockAtStart") {
+		wp.AddRange(10, 100);
+		wp.WrappedBlock(5, 30);
+		REQUIRE(30 == wp.start);
+		REQUIRE(100 == wp.end);
+	}
+
+	SECTION("WrappedBlockAtEnd") {
+		// Wrapping around a target near the end of the document
+		wp.AddRange(10, 100);
+		wp.WrappedBlock(80, 100);
+		REQUIRE(10 == wp.start);
+		REQUIRE(80 == wp.end);
+		REQUIRE(wp.NeedsWrap());
+	}
+
+	SECTION("WrappedBlockInside") {
+		// The pending range can not have a hole so stays the same
+		wp.AddRange(10, 100);
+		wp.WrappedBlock(40, 60);
+		REQUIRE(10 == wp.start);
+		REQUIRE(100 == wp.end);
+	}
+
+	SECTION("WrappedBlockAll") {
+		wp.AddRange(10, 100);
+		wp.WrappedBlock(0, 120);
+		REQUIRE(!wp.NeedsWrap());
+	}
+
+	SECTION("WrappedBlockOutside") {
+		wp.AddRange(10, 100);
+		wp.WrappedBlock(0, 5);
+		wp.WrappedBlock(110, 120);
+		REQUIRE(10 == wp.start);
+		REQUIRE(100 == wp.end);
+	}
+
+}
+
+TEST_CASE("EstimateWrapLines") {
+
+	SECTION("Empty") {
+		REQUIRE(1 == EstimateWrapLines(0, 80.0));
+	}
+
+	SECTION("Fits") {
+		REQUIRE(1 == EstimateWrapLines(1, 80.0));
+		REQUIRE(1 == EstimateWrapLines(80, 80.0));
+	}
+
+	SECTION("Wraps") {
+		REQUIRE(2 == EstimateWrapLines(81, 80.0));
+		REQUIRE(2 == EstimateWrapLines(160, 80.0));
+		REQUIRE(3 == EstimateWrapLines(161, 80.0));
+		REQUIRE(1250 == EstimateWrapLines(100000, 80.0));
+	}
+
+	SECTION("NarrowArea") {
+		// Less than one character fits so no estimate is possible
+		REQUIRE(1 == EstimateWrapLines(1000, 0.0));
+		REQUIRE(1 == EstimateWrapLines(1000, 0.5));
+		REQUIRE(1000 == EstimateWrapLines(1000, 1.0));
+	}
+
+}
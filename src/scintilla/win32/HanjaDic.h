@@ -1,22 +1,22 @@
-// Scintilla source code edit control
-/** @file HanjaDic.h
- ** Korean Hanja Dictionary
- ** Convert between Korean Hanja and Hangul by COM interface.
- **/
-// Copyright 2015 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef HANJADIC_H
-#define HANJADIC_H
-
-namespace Scintilla::Internal {
-
-namespace HanjaDict {
-
-bool GetHangulOfHanja(std::wstring &inout) noexcept;
-
-}
-
-}
-
-#endif
+// Scintilla source code edit control
+/** @file HanjaDic.h
+ ** Korean Hanja Dictionary
+ ** Convert between Korean Hanja and Hangul by COM interface.
+ **/
+// Copyright 2015 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef HANJADIC_H
+#define HANJADIC_H
+
+namespace Scintilla::Internal {
+
+namespace HanjaDict {
+
+bool GetHangulOfHanja(std::wstring &inout) noexcept;
+
+}
+
+}
+
+#endif
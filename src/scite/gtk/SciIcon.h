@@ -1,37 +1,37 @@
-// @file SciIcon.h
-/* XPM */
-static const char * SciIcon_xpm[] = {
-"16 16 17 1",
-" 	c None",
-".	c #666666",
-"+	c #424242",
-"@	c #4D4D4D",
-"#	c #777777",
-"$	c #555555",
-"%	c #868686",
-"&	c #333333",
-"*	c #292929",
-"=	c #A0A0A4",
-"-	c #808080",
-";	c #C0C0C0",
-">	c #999999",
-",	c #E3E3E3",
-"'	c #161616",
-")	c #B2B2B2",
-"!	c #D7D7D7",
-"     .+@@+#     ",
-"   $+$$@+@+@$   ",
-"  $@+%&.@@@++@  ",
-" $@*=@-@-&.+&&@ ",
-" #+@;*>#&>&@+*+ ",
-".$*;*,*=='..'++&",
-"+&.%#.,*$;&*.&*&",
-"*@)*,$+,@&=.'&.'",
-"*$&;*,$*!=*+%$''",
-"**@$)*;%*.;$***'",
-"*&&&&$*#-&*@+&''",
-" **&@*$**@+*''' ",
-" &*&+.'++*'*&** ",
-"  **&*+&*&&*''  ",
-"   ********''   ",
-"     *'''''     "};
+// @file SciIcon.h
+/* XPM */
+static const char * SciIcon_xpm[] = {
+"16 16 17 1",
+" 	c None",
+".	c #666666",
+"+	c #424242",
+"@	c #4D4D4D",
+"#	c #777777",
+"$	c #555555",
+"%	c #868686",
+"&	c #333333",
+"*	c #292929",
+"=	c #A0A0A4",
+"-	c #808080",
+";	c #C0C0C0",
+">	c #999999",
+",	c #E3E3E3",
+"'	c #161616",
+")	c #B2B2B2",
+"!	c #D7D7D7",
+"     .+@@+#     ",
+"   $+$$@+@+@$   ",
+"  $@+%&.@@@++@  ",
+" $@*=@-@-&.+&&@ ",
+" #+@;*>#&>&@+*+ ",
+".$*;*,*=='..'++&",
+"+&.%#.,*$;&*.&*&",
+"*@)*,$+,@&=.'&.'",
+"*$&;*,$*!=*+%$''",
+"**@$)*;%*.;$***'",
+"*&&&&$*#-&*@+&''",
+" **&@*$**@+*''' ",
+" &*&+.'++*'*&** ",
+"  **&*+&*&&*''  ",
+"   ********''   ",
+"     *'''''     "};
@@ -1,1593 +1,1593 @@
-// @file pixmapsGNOME.h
-// Set of images for tool bar buttons
-// Icons  Copyright(C) 1998  by  Dean S. Jones
-// http://jfa.javalobby.org/projects/icons/
-// Modified to have same names as tigert.h
-// Not really anything to do with Gnome - just calling this
-// file pixmapsGNOME to fit in with previous code.
-
-/* XPM */
-static const char * editcopy_xpm[] = {
-"20 20 13 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #6E6E6E",
-"@	c #000000",
-"#	c #8EFFFF",
-"$	c #FFB1B1",
-"%	c #B1FFFF",
-"&	c #3E3E3E",
-"*	c #DADADA",
-"=	c #F2F2F2",
-"-	c #FFFFFF",
-";	c #CECECE",
-">	c #E6E6E6",
-".+++++++++.         ",
-"+@@@@@@@@@+.        ",
-"+@#$%%%&*+&+.       ",
-"+@.$*=-&-*+@+.      ",
-"+@#$%%.+++++++++.   ",
-"+@.$*=+@@@@@@@@@+.  ",
-"+@#$%%+@#$%%%&*+&+. ",
-"+@.$*=+@.$;>=&-*+@+.",
-"+@#$%%+@#$%%%&--*@+.",
-"+@.$*=+@.$;>=++++@+.",
-"+@#$%%+@#$%%%%%%%@+.",
-"+@.$*=+@.$;>=---=@+.",
-"+@#$%%+@#$%%%%%%%@+.",
-"+@@@@@+@.$;>=---=@+.",
-".++++++@#$%%%%%%%@+.",
-" .....+@.$;>=---=@+.",
-"      +@#$%%%%%%%@+.",
-"      +@@@@@@@@@@@+.",
-"      .+++++++++++..",
-"       ............ "};
-/* XPM */
-static const char * editcut_xpm[] = {
-"20 20 14 1",
-" 	c None",
-".	c #7A7A7A",
-"+	c #AAAAAA",
-"@	c #C0C0C0",
-"#	c #4A4A4A",
-"$	c #000000",
-"%	c #CECECE",
-"&	c #FFFFFF",
-"*	c #B6B6B6",
-"=	c #9E9E9E",
-"-	c #E6E6E6",
-";	c #F2F2F2",
-">	c #6E6E6E",
-",	c #DADADA",
-"  ...          ...+@",
-" .#$$.        .$$$.+",
-" .$%$$.      .$$&$.+",
-" .$*&$$.    .$$&%$.+",
-" .$=-&$$.  .$$&%*$.+",
-" .$$@-&$$..$$&%*$$.+",
-"  .$$@-&$$$$&%*$$.+ ",
-"   .$$@-&.$&%*$$.+  ",
-"    .$$@-;..*$$.+   ",
-"     .$$@$&$$$.+    ",
-"      .$$+-%$>+++   ",
-"   ...$..$$%%$...+  ",
-"  .$$$$$$.$$$$$$$.+ ",
-" .$$++=$.+.$$=++$$.+",
-"+$$+,@,$. +.$,@,+$$+",
-"+$$&@&;$.  .$+,@&$$+",
-"+$$+&;$$+  +$$+&;$$+",
-" .$$$$$+    +$$$$$. ",
-"  .$$$+      +$$$.  ",
-"   +++        +++   "};
-/* XPM */
-static const char * close_xpm[] = {
-"20 20 242 2",
-"  	c None",
-". 	c #000000",
-"+ 	c #800000",
-"@ 	c #008000",
-"# 	c #808000",
-"$ 	c #000080",
-"% 	c #800080",
-"& 	c #008080",
-"* 	c #C0C0C0",
-"= 	c #C0DCC0",
-"- 	c #A6CAF0",
-"; 	c #FFF0D4",
-"> 	c #FFE2B1",
-", 	c #FFD48E",
-"' 	c #FFC66B",
-") 	c #FFB848",
-"! 	c #FFAA25",
-"~ 	c #FFAA00",
-"{ 	c #DC9200",
-"] 	c #B97A00",
-"^ 	c #966200",
-"/ 	c #734A00",
-"( 	c #503200",
-"_ 	c #FFE3D4",
-": 	c #FFC7B1",
-"< 	c #FFAB8E",
-"[ 	c #FF8F6B",
-"} 	c #FF7348",
-"| 	c #FF5725",
-"1 	c #FF5500",
-"2 	c #DC4900",
-"3 	c #B93D00",
-"4 	c #963100",
-"5 	c #732500",
-"6 	c #501900",
-"7 	c #FFD4D4",
-"8 	c #FFB1B1",
-"9 	c #FF8E8E",
-"0 	c #FF6B6B",
-"a 	c #FF4848",
-"b 	c #FF2525",
-"c 	c #FE0000",
-"d 	c #DC0000",
-"e 	c #B90000",
-"f 	c #960000",
-"g 	c #730000",
-"h 	c #500000",
-"i 	c #FFD4E3",
-"j 	c #FFB1C7",
-"k 	c #FF8EAB",
-"l 	c #FF6B8F",
-"m 	c #FF4873",
-"n 	c #FF2557",
-"o 	c #FF0055",
-"p 	c #DC0049",
-"q 	c #B9003D",
-"r 	c #960031",
-"s 	c #730025",
-"t 	c #500019",
-"u 	c #FFD4F0",
-"v 	c #FFB1E2",
-"w 	c #FF8ED4",
-"x 	c #FF6BC6",
-"y 	c #FF48B8",
-"z 	c #FF25AA",
-"A 	c #FF00AA",
-"B 	c #DC0092",
-"C 	c #B9007A",
-"D 	c #960062",
-"E 	c #73004A",
-"F 	c #500032",
-"G 	c #FFD4FF",
-"H 	c #FFB1FF",
-"I 	c #FF8EFF",
-"J 	c #FF6BFF",
-"K 	c #FF48FF",
-"L 	c #FF25FF",
-"M 	c #FE00FE",
-"N 	c #DC00DC",
-"O 	c #B900B9",
-"P 	c #960096",
-"Q 	c #730073",
-"R 	c #500050",
-"S 	c #F0D4FF",
-"T 	c #E2B1FF",
-"U 	c #D48EFF",
-"V 	c #C66BFF",
-"W 	c #B848FF",
-"X 	c #AA25FF",
-"Y 	c #AA00FF",
-"Z 	c #9200DC",
-"` 	c #7A00B9",
-" .	c #620096",
-"..	c #4A0073",
-"+.	c #320050",
-"@.	c #E3D4FF",
-"#.	c #C7B1FF",
-"$.	c #AB8EFF",
-"%.	c #8F6BFF",
-"&.	c #7348FF",
-"*.	c #5725FF",
-"=.	c #5500FF",
-"-.	c #4900DC",
-";.	c #3D00B9",
-">.	c #310096",
-",.	c #250073",
-"'.	c #190050",
-").	c #D4D4FF",
-"!.	c #B1B1FF",
-"~.	c #8E8EFF",
-"{.	c #6B6BFF",
-"].	c #4848FF",
-"^.	c #2525FF",
-"/.	c #0000FE",
-"(.	c #0000DC",
-"_.	c #0000B9",
-":.	c #000096",
-"<.	c #000073",
-"[.	c #000050",
-"}.	c #D4E3FF",
-"|.	c #B1C7FF",
-"1.	c #8EABFF",
-"2.	c #6B8FFF",
-"3.	c #4873FF",
-"4.	c #2557FF",
-"5.	c #0055FF",
-"6.	c #0049DC",
-"7.	c #003DB9",
-"8.	c #003196",
-"9.	c #002573",
-"0.	c #001950",
-"a.	c #D4F0FF",
-"b.	c #B1E2FF",
-"c.	c #8ED4FF",
-"d.	c #6BC6FF",
-"e.	c #48B8FF",
-"f.	c #25AAFF",
-"g.	c #00AAFF",
-"h.	c #0092DC",
-"i.	c #007AB9",
-"j.	c #006296",
-"k.	c #004A73",
-"l.	c #003250",
-"m.	c #D4FFFF",
-"n.	c #B1FFFF",
-"o.	c #8EFFFF",
-"p.	c #6BFFFF",
-"q.	c #48FFFF",
-"r.	c #25FFFF",
-"s.	c #00FEFE",
-"t.	c #00DCDC",
-"u.	c #00B9B9",
-"v.	c #009696",
-"w.	c #007373",
-"x.	c #005050",
-"y.	c #D4FFF0",
-"z.	c #B1FFE2",
-"A.	c #8EFFD4",
-"B.	c #6BFFC6",
-"C.	c #48FFB8",
-"D.	c #25FFAA",
-"E.	c #00FFAA",
-"F.	c #00DC92",
-"G.	c #00B97A",
-"H.	c #009662",
-"I.	c #00734A",
-"J.	c #005032",
-"K.	c #D4FFE3",
-"L.	c #B1FFC7",
-"M.	c #8EFFAB",
-"N.	c #6BFF8F",
-"O.	c #48FF73",
-"P.	c #25FF57",
-"Q.	c #00FF55",
-"R.	c #00DC49",
-"S.	c #00B93D",
-"T.	c #009631",
-"U.	c #007325",
-"V.	c #005019",
-"W.	c #D4FFD4",
-"X.	c #B1FFB1",
-"Y.	c #8EFF8E",
-"Z.	c #6BFF6B",
-"`.	c #48FF48",
-" +	c #25FF25",
-".+	c #00FE00",
-"++	c #00DC00",
-"@+	c #00B900",
-"#+	c #009600",
-"$+	c #007300",
-"%+	c #005000",
-"&+	c #E3FFD4",
-"*+	c #C7FFB1",
-"=+	c #ABFF8E",
-"-+	c #8FFF6B",
-";+	c #73FF48",
-">+	c #57FF25",
-",+	c #55FF00",
-"'+	c #49DC00",
-")+	c #3DB900",
-"!+	c #319600",
-"~+	c #257300",
-"{+	c #195000",
-"]+	c #F0FFD4",
-"^+	c #E2FFB1",
-"/+	c #D4FF8E",
-"(+	c #C6FF6B",
-"_+	c #B8FF48",
-":+	c #AAFF25",
-"<+	c #AAFF00",
-"[+	c #92DC00",
-"}+	c #7AB900",
-"|+	c #629600",
-"1+	c #4A7300",
-"2+	c #325000",
-"3+	c #FFFFD4",
-"4+	c #FFFFB1",
-"5+	c #FFFF8E",
-"6+	c #FFFF6B",
-"7+	c #FFFF48",
-"8+	c #FFFF25",
-"9+	c #FEFE00",
-"0+	c #DCDC00",
-"a+	c #B9B900",
-"b+	c #969600",
-"c+	c #737300",
-"d+	c #505000",
-"e+	c #F2F2F2",
-"f+	c #E6E6E6",
-"g+	c #DADADA",
-"h+	c #CECECE",
-"i+	c #C2C2C2",
-"j+	c #B6B6B6",
-"k+	c #AAAAAA",
-"l+	c #9E9E9E",
-"m+	c #929292",
-"n+	c #868686",
-"o+	c #7A7A7A",
-"p+	c #6E6E6E",
-"q+	c #626262",
-"r+	c #565656",
-"s+	c #4A4A4A",
-"                                        ",
-"      . . .                 s+. .       ",
-"    . . l . .             s+. l . .     ",
-"  . . l p l . .         s+. l p l . .   ",
-"  . l p p p l . .     s+. l p p p r .   ",
-"  . . r p p p l . q+q+. l p p p r . .   ",
-"    . . r p p p l . . l p p p r . .     ",
-"      . . r p p p l l p p p r . .       ",
-"        . . r p p p p p p r . .         ",
-"          q+. r p p p p r . q+          ",
-"          q+. l p p p p l . q+          ",
-"        . . l p p p p p p l . .         ",
-"      . . l p p p r r p p p l . .       ",
-"    . . l p p p r . . r p p p l . .     ",
-"  . . l p p p r . q+q+. r p p p l . .   ",
-"  . p p p p r . .     s+. r p p p p .   ",
-"  . . r p r . .         s+. r p r . .   ",
-"    . . r . .             s+. r . .     ",
-"      . . .                 s+. .       ",
-"                                        "};
-#if 0
-/* XPM */
-static const char * DocumentIn_xpm[] = {
-"20 20 17 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #B1FFFF",
-"$	c #FFB1B1",
-"%	c #CECECE",
-"&	c #7A7A7A",
-"*	c #E6E6E6",
-"=	c #FFFFFF",
-"-	c #868686",
-";	c #007373",
-">	c #6E6E6E",
-",	c #48B8FF",
-"'	c #8ED4FF",
-")	c #0092DC",
-"!	c #DADADA",
-"  .+++++++++++.     ",
-"  +@@@@@@@@@@@+.    ",
-"  +@#$####%@%&@+.   ",
-"  +@.$%***%@=%&@+.  ",
-"  +@#$####%@==%&@+. ",
-"  +@.$%**=%@===%@+. ",
-"  +@#$####%@@@@@@+. ",
-"  +@.$%**==%%%%%@+. ",
-"  +@#-;#########@+. ",
-"  +@.@@>*====***@+. ",
-"---@-@,@;#######@+. ",
-"@@@@@@,,@>====**@+. ",
-"@',,,,,,,@;#####@+. ",
-"@))))),,)@>====*@+. ",
-"@@@@@@,)@;######@+. ",
-"---@+@)@>****===@+. ",
-"  +@#@@;########@+. ",
-"  +@.--%!!!!****@+. ",
-"  +@@@@@@@@@@@@@@+. ",
-"  .++++++++++++++.  "};
-#endif
-#if 0
-/* XPM */
-static const char * Forward_xpm[] = {
-"20 20 22 1",
-" 	c None",
-".	c #AAAAAA",
-"+	c #626262",
-"@	c #3E3E3E",
-"#	c #000000",
-"$	c #626200",
-"%	c #937A00",
-"&	c #B6B6B6",
-"*	c #AF9200",
-"=	c #FFF0D4",
-"-	c #DFD48E",
-";	c #FFFFFF",
-">	c #C3B848",
-",	c #BDAA25",
-"'	c #9E9E9E",
-")	c #F2F2F2",
-"!	c #DADADA",
-"~	c #48B8FF",
-"{	c #565656",
-"]	c #323200",
-"^	c #8ED4FF",
-"/	c #0092DC",
-"          .+@#@+.   ",
-"         .@#$%$#@.  ",
-"        &+#*=--%#+& ",
-"        &@$=;->,$@& ",
-"        &#%--->,%#& ",
-"        &@$->>,*$@& ",
-"         +#%,,*%#+  ",
-"         '+#$%$#+'  ",
-"       +####@#@####+",
-"     @@+#)))))!!!!#+",
-"     ##@#!.))!!!.!#+",
-"+++++#~##.{)!!!!{!#+",
-"######~~#@]]]]]]]!#+",
-"#^~~~~~~~#]*%%%%]!#+",
-"#/////~~/##*%]*%###+",
-"######~/#@#*%]*%#++&",
-"+++++#/#@+#*%#*%#+  ",
-"     ##@ +#*%#*%#+  ",
-"     @@  +#$$#$$#+  ",
-"         +#######+  "};
-#endif
-#if 0
-/* XPM */
-static const char * Help_xpm[] = {
-"20 20 20 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #505000",
-"$	c #FFAA25",
-"%	c #FFC66B",
-"&	c #FFE2B1",
-"*	c #FFFFFF",
-"=	c #FFFF6B",
-"-	c #B9B900",
-";	c #969600",
-">	c #3E3E3E",
-",	c #808000",
-"'	c #FEFE00",
-")	c #1A1A1A",
-"!	c #DCDC00",
-"~	c #323232",
-"{	c #262626",
-"]	c #6E6E6E",
-" .++++++++++++++++. ",
-".+@@@@@@@@@@@@@@@@+.",
-"+@#$%%%%%%%%%%%%$#@+",
-"+@$%&&&&&&&&&&&&&$@+",
-"+@%&**=-;+>,-===&%@+",
-"+@%&*='>,=+@)!==&%@+",
-"+@%&*=!@~=!@@-==&%@+",
-"+@%&*==~+=!@@-==&%@+",
-"+@%&*=====,@>!==&%@+",
-"+@%&*====={+!===&%@+",
-"+@%&=====]-=====&%@+",
-"+@%&====!>;=====&%@+",
-"+@%&====+@@=====&%@+",
-"+@%&====;@>=====&%@+",
-"+@$%==========&&%$@+",
-"+@#$&=&&%%%%%%%%$#@+",
-" +@@&&&%$@@@@@@@@@+.",
-"  +@%%$@@>++++++++. ",
-"  +@$@@>+           ",
-"  +@@@+.            "};
-#endif
-#if 0
-/* XPM */
-static const char * Left_xpm[] = {
-"20 20 11 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #8ED4FF",
-"$	c #B1E2FF",
-"%	c #48B8FF",
-"&	c #FFFFFF",
-"*	c #25AAFF",
-"=	c #0092DC",
-"-	c #007AB9",
-"                    ",
-"                    ",
-"      ..            ",
-"     .++.           ",
-"    .+@@+.          ",
-"   .+@#@+.......... ",
-"  .+@#$@+++++++++++.",
-" .+@#$%@@@@@@@@@@@@+",
-".+@#&%%%#########*@+",
-"+@#&%%%%%%%%%%%%%=@+",
-"+@-*%%%%%%%%%%%%%=@+",
-".+@-*%*===========@+",
-" .+@-**@@@@@@@@@@@@+",
-"  .+@-*@+++++++++++.",
-"   .+@-@+.......... ",
-"    .+@@+.          ",
-"     .++.           ",
-"      ..            ",
-"                    ",
-"                    "};
-#endif
-/* XPM */
-static const char * search_xpm[] = {
-"20 20 21 1",
-" 	c None",
-".	c #AAAAAA",
-"+	c #7A7A7A",
-"@	c #626262",
-"#	c #929292",
-"$	c #4A4A4A",
-"%	c #000000",
-"&	c #6E6E6E",
-"*	c #B6B6B6",
-"=	c #DADADA",
-"-	c #D4D4FF",
-";	c #FFFFFF",
-">	c #B1B1FF",
-",	c #C7B1FF",
-"'	c #3E3E3E",
-")	c #4A4A00",
-"!	c #626200",
-"~	c #AF9200",
-"{	c #937A00",
-"]	c #F8E2B1",
-"^	c #323200",
-"   .+@@@@+.         ",
-"  #@$%%%%$@#        ",
-" #$%&*==*&%$#       ",
-".@%*=----=*%@.      ",
-"+$&=-;>>--=&$+      ",
-"@%*-;;,,>--*%@      ",
-"@%=->,,,,>-=%@      ",
-"@%=->,,,,>-=%@      ",
-"@%*-->,,>--*%@      ",
-"+$&=-->>--=&'+      ",
-".@%*=----=*%%'      ",
-" #$%&*==*&%$)%'     ",
-"  #@$%%%%'%!~{%'    ",
-"   .+@@@@+'%~]{%'   ",
-"           '%~]{%'  ",
-"            '%~]{%' ",
-"             '%~]{%'",
-"              '%~]!%",
-"               '%!^'",
-"                '%'#"};
-/* XPM */
-static const char * filenew_xpm[] = {
-"20 20 16 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #DC9200",
-"#	c #000000",
-"$	c #FFC66B",
-"%	c #FFFF00",
-"&	c #B1FFFF",
-"*	c #CECECE",
-"=	c #7A7A7A",
-"-	c #FFAA00",
-";	c #DCDC00",
-">	c #E6E6E6",
-",	c #FFFFFF",
-"'	c #DADADA",
-")	c #FFB1B1",
-"  .++@++++++++.     ",
-"  +#@$@#######+.    ",
-"  +@$%$@&&*#*=#+.   ",
-"  @-;%;-@>*#,*=#+.  ",
-" @-;;,;;-@*#,,*=#+. ",
-"$%%%,,%%%%$#,,,*#+. ",
-" @-;;%;;-@*######+. ",
-"  @-;%;-@,,*****#+. ",
-"  +@$%$@&&&&&&&&#+. ",
-"  +#-%->>,,,,>>>#+. ",
-"  +#-%-&&&&&&&&&#+. ",
-"  +#-%-'>,,,,,>>#+. ",
-"  +#@$@&&&&&&&&&#+. ",
-"  +#.@*'>>,,,,,>#+. ",
-"  +#&)&&&&&&&&&&#+. ",
-"  +#.)**'>>>>,,,#+. ",
-"  +#&)&&&&&&&&&&#+. ",
-"  +#.)**''''>>>>#+. ",
-"  +##############+. ",
-"  .++++++++++++++.  "};
-/* XPM */
-static const char * fileopen_xpm[] = {
-"20 20 15 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #868686",
-"@	c #6E6E6E",
-"#	c #000000",
-"$	c #626262",
-"%	c #D1C96B",
-"&	c #FFF0D4",
-"*	c #AF9200",
-"=	c #C3B848",
-"-	c #DFD48E",
-";	c #929292",
-">	c #937A00",
-",	c #BDAA25",
-"'	c #626200",
-"                    ",
-"                    ",
-" .+@@@@@+.          ",
-".+@#####$+..        ",
-".@#%&&&&#$@@@@@@@@@.",
-".@#&%%%%*##########@",
-".@#&==%%%--------*#@",
-".@#&===%%%%%%%%%%*#@",
-";@#&===>>>>>>>>>=*#@",
-"@##>>>>&&&&&&&&>=*#@",
-"#&&&&&=========>*>#@",
-"#,=============*>>#@",
-"#>==============>>#@",
-"@#,=============>>#@",
-";#>=============*>#@",
-".@#**************'#@",
-".;#################@",
-" .@@@@@@@@@@@@@@@@@.",
-"  ................. ",
-"                    "};
-/* XPM */
-static const char * editpaste_xpm[] = {
-"20 20 18 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #000000",
-"@	c #626262",
-"#	c #FFFFFF",
-"$	c #DADADA",
-"%	c #E6E6E6",
-"&	c #B97A00",
-"*	c #7A7A7A",
-"=	c #966200",
-"-	c #734A00",
-";	c #6E6E6E",
-">	c #8EFFFF",
-",	c #FFB1B1",
-"'	c #B1FFFF",
-")	c #3E3E3E",
-"!	c #CECECE",
-"~	c #F2F2F2",
-"   ....++++++....   ",
-"  .@@@+##@@$$+@@@.  ",
-" .@+++%.......+++@. ",
-" .@+&+#.******+&+@. ",
-" .@+&=++++++++-=+@. ",
-" .@+&==--------=+@. ",
-" .@+&==-+++++++++;. ",
-" .@+&==-+>,''')$;);.",
-" .@+&==-+.,!%~)#$;+@",
-" .@+&==-+>,''')##$+@",
-" .@+&==-+.,!%~;;;;+@",
-" .@+&==-+>,'''''''+@",
-" .@+&==-+.,!%~###~+@",
-" .@+&==-+>,'''''''+@",
-" .@+&==-+.,!%~###~+@",
-" .@+&==-+>,'''''''+@",
-" .@+&===+.,!%~###~+@",
-" .@++++++>,'''''''+@",
-"  .@@@@@+++++++++++@",
-"   .....@@@@@@@@@@@."};
-#if 0
-/* XPM */
-static const char * Print_xpm[] = {
-"20 20 25 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #323232",
-"$	c #AAAAAA",
-"%	c #FFC7B1",
-"&	c #CECECE",
-"*	c #E6E6E6",
-"=	c #FFFFFF",
-"-	c #8EFFFF",
-";	c #6E6E6E",
-">	c #00DCDC",
-",	c #C2C2C2",
-"'	c #4A4A00",
-")	c #00B9B9",
-"!	c #FFAB8E",
-"~	c #937A00",
-"{	c #F8E2B1",
-"]	c #C3B848",
-"^	c #C5AA00",
-"/	c #AF9200",
-"(	c #DFD48E",
-"_	c #D1C96B",
-":	c #626200",
-"      .+@@@@@@@@@#. ",
-"      .@$%&**====@+.",
-"     .+@-%-------@;.",
-"    ..@$%&***===@#. ",
-"   .++@>%>>>>>--@#..",
-"  .+@@$%,,,&***@'@@;",
-" .+@+@)!)))>>>>@'~~@",
-".+@+{''''''''''']=^@",
-"+@+{]]]]]]]]]]]]=^/@",
-"+@==============^{/@",
-"+@{{{{{{{{{{{((^{(/@",
-"+@{{_____(((::(^((/@",
-"+@{_____(((((~(^(//@",
-"+@________(((((^/]~@",
-"+@~~~~~~~~~~~~~~]]@#",
-"+@+]]]]]]]]]]]^~]@#.",
-".+@+^^^^^^^^^^~]@#. ",
-" .+@@@@@@@@@@@@@#.  ",
-"  .+++++++++++++.   ",
-"   .............    "};
-#endif
-/* XPM */
-static const char * redo_xpm[] = {
-"20 20 12 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #4A4A4A",
-"#	c #000000",
-"$	c #00B900",
-"%	c #9E9E9E",
-"&	c #7A7A7A",
-"*	c #00AB3D",
-"=	c #005000",
-"-	c #009631",
-";	c #007325",
-"                    ",
-"                    ",
-"                    ",
-"           .+@.     ",
-"          .+##@.    ",
-"    .......+#$#@.   ",
-"   %%&++++++#*$#@.  ",
-"  %&#########**$#@. ",
-" %&#=-*$$$$$$*-*$#@.",
-".&#=------------*$#@",
-"%#=--------------=#+",
-"&#;----======---=#+.",
-"#=----=######--=#+. ",
-"#=---;#%%%%+#-=#+.  ",
-"#=---;#%   +#=#+.   ",
-"#=---;#%   +##+.    ",
-"+######%   .++.     ",
-"%++++++%            ",
-"                    ",
-"                    "};
-/* XPM */
-static const char * filesave_xpm[] = {
-"20 20 16 1",
-" 	c None",
-".	c #6E6E6E",
-"+	c #4A4A4A",
-"@	c #000000",
-"#	c #7A7A7A",
-"$	c #929292",
-"%	c #9E9E9E",
-"&	c #B6B6B6",
-"*	c #C2C2C2",
-"=	c #AAAAAA",
-"-	c #565656",
-";	c #626262",
-">	c #FFFFFF",
-",	c #DADADA",
-"'	c #3E3E3E",
-")	c #CECECE",
-".++..............++.",
-"+++@@@@@@@@@@@@@@+++",
-"++#$............%#++",
-"+@#$............%#@+",
-"+@#$............%#@+",
-"+@#$............&#@+",
-"+@#$............*#@+",
-"+@#$............*#@+",
-"+@#$............&#@+",
-"+@##$$$$$==&&&*&##@+",
-"+@################@+",
-"+@##--------;;;;##@+",
-"+@#->>,,,,,,*'-;%#@+",
-"+@#->;-'>)*),'-;%#@+",
-"+@#-,;-'>*)*,'-;%#@+",
-"+@#-,;-'>)*),'-;%#@+",
-"+@#-,;-'>*)*,'-;%#@+",
-"+@+-,===****,'-;%#@+",
-"=+@@@@@@@@@@@@@@@@@+",
-" =+++++++++++++++++."};
-#if 0
-/* XPM */
-static const char * filesave_all_xpm[] = {
-"20 20 13 1",
-" 	c None",
-".	c #6E6E6E",
-"+	c #4A4A4A",
-"@	c #000000",
-"#	c #B6B6B6",
-"$	c #CECECE",
-"%	c #929292",
-"&	c #7A7A7A",
-"*	c #FFFFFF",
-"=	c #F2F2F2",
-"-	c #565656",
-";	c #DADADA",
-">	c #C2C2C2",
-"    .++.........++. ",
-"    +++@@@@@@@@@+++#",
-"    ++$.........$++#",
-"    +@%.........#@+#",
-".++.........++..#@+#",
-"+++@@@@@@@@@+++.$@+#",
-"++$.........$++$&@+#",
-"+@%.........#@+&&@+#",
-"+@%.........#@+%&@+#",
-"+@%.........$@+.&@+#",
-"+@&%%%%%###$&@+.&@+#",
-"+@&&&&&&&&&&&@+.&@+#",
-"+@&&......%%&@+.&@+#",
-"+@&.***===-.&@+@@@+#",
-"+@&.;.->>;-.&@++++.#",
-"+@&.;-@>>;-.&@+#### ",
-"+@+.;&&>>;-.&@+#    ",
-"#+@@@@@@@@@@@@+#    ",
-" #++++++++++++.#    ",
-"  #############     "};
-#endif
-/* XPM */
-static const char * undo_xpm[] = {
-"20 20 16 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #4A4A4A",
-"@	c #626262",
-"#	c #000000",
-"$	c #FF6B8F",
-"%	c #FFB1C7",
-"&	c #7A7A7A",
-"*	c #9E9E9E",
-"=	c #DC0049",
-"-	c #FFFFFF",
-";	c #FF0055",
-">	c #B9003D",
-",	c #960031",
-"'	c #B90000",
-")	c #501900",
-"                    ",
-"                    ",
-"                    ",
-"     .+@.           ",
-"    .+##@.          ",
-"   .+#$#@.......    ",
-"  .+#$%#@@@@@@&**   ",
-" .+#$%=#########&*  ",
-".+#$-==;;;;;;=>,#&* ",
-"+#$-============,#&.",
-"@#,$=============,#*",
-".@#,'=',,,,,,====>#&",
-" .@#,''######,====)#",
-"  .@#,'#@****#>===)#",
-"   .@#,#@   *#>===)#",
-"    .@##@   *#>===)#",
-"     .@@.   *######@",
-"            *@@@@@@*",
-"                    ",
-"                    "};
-/* XPM */
-static const char * replace_xpm[] = {
-"20 20 257 2",
-"  	c None",
-". 	c #000000",
-"+ 	c #800000",
-"@ 	c #008000",
-"# 	c #808000",
-"$ 	c #000080",
-"% 	c #800080",
-"& 	c #008080",
-"* 	c #C0C0C0",
-"= 	c #C0DCC0",
-"- 	c #A6CAF0",
-"; 	c #FFF0D4",
-"> 	c #F8E2B1",
-", 	c #DFD48E",
-"' 	c #D1C96B",
-") 	c #C3B848",
-"! 	c #BDAA25",
-"~ 	c #C5AA00",
-"{ 	c #AF9200",
-"] 	c #937A00",
-"^ 	c #626200",
-"/ 	c #4A4A00",
-"( 	c #323200",
-"_ 	c #FFE3D4",
-": 	c #FFC7B1",
-"< 	c #FFAB8E",
-"[ 	c #FF8F6B",
-"} 	c #FF7348",
-"| 	c #FF5725",
-"1 	c #FF5500",
-"2 	c #DC4900",
-"3 	c #B93D00",
-"4 	c #963100",
-"5 	c #732500",
-"6 	c #501900",
-"7 	c #FFD4D4",
-"8 	c #FFB1B1",
-"9 	c #FF8E8E",
-"0 	c #FF6B6B",
-"a 	c #FF4848",
-"b 	c #FF2525",
-"c 	c #FE0000",
-"d 	c #DC0000",
-"e 	c #B90000",
-"f 	c #960000",
-"g 	c #730000",
-"h 	c #500000",
-"i 	c #FFD4E3",
-"j 	c #FFB1C7",
-"k 	c #FF8EAB",
-"l 	c #FF6B8F",
-"m 	c #FF4873",
-"n 	c #FF2557",
-"o 	c #FF0055",
-"p 	c #DC0049",
-"q 	c #B9003D",
-"r 	c #960031",
-"s 	c #730025",
-"t 	c #500019",
-"u 	c #FFD4F0",
-"v 	c #FFB1E2",
-"w 	c #FF8ED4",
-"x 	c #FF6BC6",
-"y 	c #FF48B8",
-"z 	c #FF25AA",
-"A 	c #FF00AA",
-"B 	c #DC0092",
-"C 	c #B9007A",
-"D 	c #960062",
-"E 	c #73004A",
-"F 	c #500032",
-"G 	c #FFD4FF",
-"H 	c #FFB1FF",
-"I 	c #FF8EFF",
-"J 	c #FF6BFF",
-"K 	c #FF48FF",
-"L 	c #FF25FF",
-"M 	c #FE00FE",
-"N 	c #DC00DC",
-"O 	c #B900B9",
-"P 	c #960096",
-"Q 	c #730073",
-"R 	c #500050",
-"S 	c #F0D4FF",
-"T 	c #E2B1FF",
-"U 	c #D48EFF",
-"V 	c #C66BFF",
-"W 	c #B848FF",
-"X 	c #AA25FF",
-"Y 	c #AA00FF",
-"Z 	c #9200DC",
-"` 	c #7A00B9",
-" .	c #620096",
-"..	c #4A0073",
-"+.	c #320050",
-"@.	c #E3D4FF",
-"#.	c #C7B1FF",
-"$.	c #AB8EFF",
-"%.	c #8F6BFF",
-"&.	c #7348FF",
-"*.	c #5725FF",
-"=.	c #5500FF",
-"-.	c #4900DC",
-";.	c #3D00B9",
-">.	c #310096",
-",.	c #250073",
-"'.	c #190050",
-").	c #D4D4FF",
-"!.	c #B1B1FF",
-"~.	c #8E8EFF",
-"{.	c #6B6BFF",
-"].	c #4848FF",
-"^.	c #2525FF",
-"/.	c #0000FE",
-"(.	c #0000DC",
-"_.	c #0000B9",
-":.	c #000096",
-"<.	c #000073",
-"[.	c #000050",
-"}.	c #D4E3FF",
-"|.	c #B1C7FF",
-"1.	c #8EABFF",
-"2.	c #6B8FFF",
-"3.	c #4873FF",
-"4.	c #2557FF",
-"5.	c #0055FF",
-"6.	c #0049DC",
-"7.	c #003DB9",
-"8.	c #003196",
-"9.	c #002573",
-"0.	c #001950",
-"a.	c #D4F0FF",
-"b.	c #B1E2FF",
-"c.	c #8ED4FF",
-"d.	c #6BC6FF",
-"e.	c #48B8FF",
-"f.	c #25AAFF",
-"g.	c #00AAFF",
-"h.	c #0092DC",
-"i.	c #007AB9",
-"j.	c #006296",
-"k.	c #004A73",
-"l.	c #003250",
-"m.	c #D4FFFF",
-"n.	c #B1FFFF",
-"o.	c #8EFFFF",
-"p.	c #6BFFFF",
-"q.	c #48FFFF",
-"r.	c #25FFFF",
-"s.	c #00FEFE",
-"t.	c #00DCDC",
-"u.	c #00B9B9",
-"v.	c #009696",
-"w.	c #007373",
-"x.	c #005050",
-"y.	c #D4FFF0",
-"z.	c #B1FFE2",
-"A.	c #8EFFD4",
-"B.	c #6BFFC6",
-"C.	c #48FFB8",
-"D.	c #25FFAA",
-"E.	c #00FFAA",
-"F.	c #00DC92",
-"G.	c #00B97A",
-"H.	c #009662",
-"I.	c #00734A",
-"J.	c #005032",
-"K.	c #D4FFE3",
-"L.	c #B1FFC7",
-"M.	c #8EFFAB",
-"N.	c #6BFF8F",
-"O.	c #48FF73",
-"P.	c #25FF57",
-"Q.	c #00FF55",
-"R.	c #00DC49",
-"S.	c #00B93D",
-"T.	c #009631",
-"U.	c #007325",
-"V.	c #005019",
-"W.	c #D4FFD4",
-"X.	c #B1FFB1",
-"Y.	c #8EFF8E",
-"Z.	c #6BFF6B",
-"`.	c #48FF48",
-" +	c #25FF25",
-".+	c #00FE00",
-"++	c #00DC00",
-"@+	c #00B900",
-"#+	c #009600",
-"$+	c #007300",
-"%+	c #005000",
-"&+	c #E3FFD4",
-"*+	c #C7FFB1",
-"=+	c #ABFF8E",
-"-+	c #8FFF6B",
-";+	c #73FF48",
-">+	c #57FF25",
-",+	c #55FF00",
-"'+	c #49DC00",
-")+	c #3DB900",
-"!+	c #319600",
-"~+	c #257300",
-"{+	c #195000",
-"]+	c #F0FFD4",
-"^+	c #E2FFB1",
-"/+	c #D4FF8E",
-"(+	c #C6FF6B",
-"_+	c #B8FF48",
-":+	c #AAFF25",
-"<+	c #AAFF00",
-"[+	c #92DC00",
-"}+	c #7AB900",
-"|+	c #629600",
-"1+	c #4A7300",
-"2+	c #325000",
-"3+	c #FFFFD4",
-"4+	c #FFFFB1",
-"5+	c #FFFF8E",
-"6+	c #FFFF6B",
-"7+	c #FFFF48",
-"8+	c #FFFF25",
-"9+	c #FEFE00",
-"0+	c #DCDC00",
-"a+	c #B9B900",
-"b+	c #969600",
-"c+	c #737300",
-"d+	c #505000",
-"e+	c #F2F2F2",
-"f+	c #E6E6E6",
-"g+	c #DADADA",
-"h+	c #CECECE",
-"i+	c #C2C2C2",
-"j+	c #B6B6B6",
-"k+	c #AAAAAA",
-"l+	c #9E9E9E",
-"m+	c #929292",
-"n+	c #868686",
-"o+	c #7A7A7A",
-"p+	c #6E6E6E",
-"q+	c #626262",
-"r+	c #565656",
-"s+	c #4A4A4A",
-"t+	c #3E3E3E",
-"u+	c #323232",
-"v+	c #262626",
-"w+	c #1A1A1A",
-"x+	c #0E0E0E",
-"y+	c #FFFBF0",
-"z+	c #A0A0A4",
-"A+	c #808080",
-"B+	c #FF0000",
-"C+	c #00FF00",
-"D+	c #FFFF00",
-"E+	c #0000FF",
-"F+	c #FF00FF",
-"G+	c #00FFFF",
-"H+	c #FFFFFF",
-"      k+o+q+q+q+q+o+k+                  ",
-"    m+q+s+. . . . s+q+m+      j+m+m+    ",
-"  m+s+. p+j+g+g+j+p+. s+m+    t+. t+m+  ",
-"k+q+. j+g+).).).).g+j+. q+k+t+. 9 . t+m+",
-"o+s+p+g+).H+!.!.).).g+p+s+t+. 7 8 9 . t+",
-"q+. j+).H+H+#.#.!.).).j+t+. . 8 8 9 0 . ",
-"q+. g+).!.#.#.#.#.!.).t+. ~ t+. 9 0 . t+",
-"q+. g+).!.#.#.#.#.!.t+. ~ 3+9+t+. . t+  ",
-"q+. j+).).!.#.#.!.t+. ~ 3+9+[ } . t+    ",
-"o+s+p+g+).).!.!.t+. ~ 3+9+[ } . t+      ",
-"k+q+. j+g+).).t+. ~ 3+9+[ } . t+        ",
-"  m+s+. p+j+t+. ~ 3+9+[ } . t+          ",
-"    m+q+s+t+. ~ 3+9+[ } . t+. t+        ",
-"      k+t+. ~ 3+9+[ } . t+> ] . t+      ",
-"      t+. ~ 3+9+[ } . t+. { > ] . t+    ",
-"  j+t+. . t+9+[ } . t+  t+. { > ] . t+  ",
-"  k+/ > ; . t+} . t+      t+. { > ] . t+",
-"  m+^ ; > > . . t+          t+. { > ^ . ",
-"  p+^ > > > . t+              t+. ^ ( t+",
-"  p+. ^ ^ / t+                  t+. t+m+"};
-
-/* XPM */
-/*
-static const char * replace_xpm[] = {
-"20 20 9 1",
-" 	c None",
-".	c #4A4A4A",
-"+	c #6E6E6E",
-"@	c #000000",
-"#	c #006296",
-"$	c #0092DC",
-"%	c #007AB9",
-"&	c #868686",
-"*	c #003250",
-"                    ",
-" .....+.....+       ",
-".@@@@@@@@@@@@.      ",
-".@####@@####@@.     ",
-".@@#$$#@@#$$#@@.    ",
-" .@@#$%#@@#$%#@@.   ",
-"  .@@#$%#@@#$%#@@.  ",
-"   .@@#$%#@@$%%#@@. ",
-"    .@@#$%#@@$%%#@@&",
-"     .@*#$%#@*$$%#@@",
-"     .@*#$%#@*#$%#@@",
-"    .@@#$%#@@#$%#@@&",
-"   .@@#$%#@@#$%#@@. ",
-"  .@@#$%#@@#$%#@@.  ",
-" .@@#%%#@@#%%#@@.   ",
-".@@#%%#@@#%%#@@.    ",
-".@####@@####@@.     ",
-".@@@@@@@@@@@@.      ",
-" .....+.....+       ",
-"                    "};
-*/
-#if 0
-/* XPM */
-static const char * World_xpm[] = {
-"20 20 32 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #AAAAAA",
-"@	c #868686",
-"#	c #6E6E6E",
-"$	c #4A4A4A",
-"%	c #323232",
-"&	c #000000",
-"*	c #565656",
-"=	c #006296",
-"-	c #CECECE",
-";	c #FFFFFF",
-">	c #007AB9",
-",	c #0092DC",
-"'	c #48B8FF",
-")	c #007373",
-"!	c #00734A",
-"~	c #00AAFF",
-"{	c #8ED4FF",
-"]	c #25AAFF",
-"^	c #00B9B9",
-"/	c #005050",
-"(	c #DADADA",
-"_	c #C5AA00",
-":	c #626200",
-"<	c #4A4A00",
-"[	c #323200",
-"}	c #3E3E3E",
-"|	c #B1FFFF",
-"1	c #48FFFF",
-"2	c #004A73",
-"3	c #003250",
-"     ..+@##@+..     ",
-"    .@$%&**&%$@.    ",
-"   .*&=-;;-;>=&*.   ",
-"  .*&,,';-;-'))&*.  ",
-" .*&!~{{']']^///&*. ",
-".@&!^;;'](((!_::<&@.",
-".$!^.;']';;((_::<[$.",
-"+%:'{']']]]^!_::<[%+",
-"@&:...((((^!:_:<<[&@",
-"#}<[.(;|||11_::<[>2#",
-"#}<..((((],!:::<>>2#",
-"@&@.((],],]/::<,>>&@",
-"+%@.,],],],,/:<>>=%+",
-".$[,,,,,,,,,,/<>=3$.",
-".@&,>,@,>,>,@>/23&@.",
-" .*&3@.@>>>.;@23&*. ",
-"  .*&3%..;..@23&*.  ",
-"   .*&3%;;;.@3&*.   ",
-"    .@$%&%%&%$@.    ",
-"     ..+@##@+..     "};
-#endif
-/* XPM */
-static const char * findinfiles_xpm[] = {
-"20 20 28 1",
-" 	c None",
-".	c #AAAAAA",
-"+	c #7A7A7A",
-"@	c #626262",
-"#	c #B6B6B6",
-"$	c #929292",
-"%	c #4A4A4A",
-"&	c #000000",
-"*	c #6E6E6E",
-"=	c #FF8E8E",
-"-	c #DADADA",
-";	c #FFB1B1",
-">	c #FFFFFF",
-",	c #005050",
-"'	c #D4FFFF",
-")	c #CECECE",
-"!	c #007373",
-"~	c #00DCDC",
-"{	c #00B9B9",
-"]	c #B1FFFF",
-"^	c #3E3E3E",
-"/	c #E6E6E6",
-"(	c #505000",
-"_	c #626200",
-":	c #AF9200",
-"<	c #937A00",
-"[	c #9E9E9E",
-"}	c #F8E2B1",
-"   .+@@@@@@@@@#     ",
-"  $@%&&&&%@&&&@#    ",
-" $%&*=--#*&%$+&@#   ",
-".@&#;;>>>>#&@.+&@#  ",
-"+%,';;''''',%+)+&@# ",
-"@&!~;;~~~~~!&@>)&@# ",
-"@&->;;>>>>>-&@&&&@# ",
-"@&->;;>>>>>-&@))&@# ",
-"@&{';;'''''{&@]]&@# ",
-"+%!~;;~~~~~!^+//&@# ",
-".@&#;;>>>-#&&^]]&@# ",
-" $%&*=--#*&%(&^/&@# ",
-"  @&%&&&&%&_:<&^&@# ",
-"  @&[=###/^&:}<&^@# ",
-"  @&];]]]]]^&:}<&^# ",
-"  @&#;))-///^&:}<&^ ",
-"  @&];]]]]]]]^&:}<&^",
-"  @&#;))----//^&:}_&",
-"  @&&&&&&&&&&&&^&_&^",
-"  #@@@@@@@@@@@@@^&^ "};
-/* XPM */
-static const char * findnext_xpm[] = {
-"20 20 30 1",
-" 	c None",
-".	c #AAAAAA",
-"+	c #7A7A7A",
-"@	c #626262",
-"#	c #929292",
-"$	c #4A4A4A",
-"%	c #000000",
-"&	c #6E6E6E",
-"*	c #B6B6B6",
-"=	c #DADADA",
-"-	c #D4D4FF",
-";	c #FFFFFF",
-">	c #B1B1FF",
-",	c #C7B1FF",
-"'	c #3E3E3E",
-")	c #4A4A00",
-"!	c #E6E6E6",
-"~	c #303030",
-"{	c #676709",
-"]	c #AF9200",
-"^	c #937A00",
-"/	c #48B8FF",
-"(	c #007373",
-"_	c #B1FFFF",
-":	c #F8E2B1",
-"<	c #686868",
-"[	c #8ED4FF",
-"}	c #0092DC",
-"|	c #626200",
-"1	c #323200",
-"   .+@@@@+.         ",
-"  #@$%%%%$@#        ",
-" #$%&*==*&%$#       ",
-".@%*=----=*%@.      ",
-"+$&=-;>>--=&$+      ",
-"@%*-;;,,>--*%@      ",
-"@%=->,,,,>-=%@      ",
-"@%=->,,,,>-=%@      ",
-"@%*-->,,>--*%@      ",
-"+$&=-->>--=&'+      ",
-".@%*=----=*%%'      ",
-" #$%&*==*&%$)%'     ",
-"  #@$%%%&!~{]^%'    ",
-"   .+@%/%(_%]:^%'   ",
-"%%%%%%%//%&<%]:^%'  ",
-"%[////////%('%]:^%' ",
-"%}}}}}}//}%& '%]:^%'",
-"%%%%%%%/}%(   '%]:|%",
-"      %}%&     '%|1'",
-"      %%(       '%'#"};
-/* XPM */
-static const char * next_xpm[] = {
-"20 20 17 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #B1FFFF",
-"$	c #FFB1B1",
-"%	c #CECECE",
-"&	c #7A7A7A",
-"*	c #E6E6E6",
-"=	c #FFFFFF",
-"-	c #868686",
-";	c #007373",
-">	c #6E6E6E",
-",	c #48B8FF",
-"'	c #8ED4FF",
-")	c #0092DC",
-"!	c #DADADA",
-"  .+++++++++++.     ",
-"  +@@@@@@@@@@@+.    ",
-"  +@#$####%@%&@+.   ",
-"  +@.$%***%@=%&@+.  ",
-"  +@#$####%@==%&@+. ",
-"  +@.$%**=%@===%@+. ",
-"  +@#$####%@@@@@@+. ",
-"  +@.$%**==%%%%%@+. ",
-"  +@#-;#########@+. ",
-"  +@.@@>*====***@+. ",
-"---@-@,@;#######@+. ",
-"@@@@@@,,@>====**@+. ",
-"@',,,,,,,@;#####@+. ",
-"@))))),,)@>====*@+. ",
-"@@@@@@,)@;######@+. ",
-"---@+@)@>****===@+. ",
-"  +@#@@;########@+. ",
-"  +@.--%!!!!****@+. ",
-"  +@@@@@@@@@@@@@@+. ",
-"  .++++++++++++++.  "};
-/* XPM */
-static const char * prev_xpm[] = {
-"20 20 17 1",
-" 	c None",
-".	c #B6B6B6",
-"+	c #626262",
-"@	c #000000",
-"#	c #7A7A7A",
-"$	c #CECECE",
-"%	c #B1FFFF",
-"&	c #FFB1B1",
-"*	c #FFFFFF",
-"=	c #E6E6E6",
-"-	c #007373",
-";	c #868686",
-">	c #6E6E6E",
-",	c #48B8FF",
-"'	c #8ED4FF",
-")	c #0092DC",
-"!	c #DADADA",
-"     .+++++++++++.  ",
-"    .+@@@@@@@@@@@+  ",
-"   .+@#$@$%%%%&%@+  ",
-"  .+@#$*@$===$&.@+  ",
-" .+@#$**@$%%%%&%@+  ",
-" .+@$***@$*==$&.@+  ",
-" .+@@@@@@$%%%%&%@+  ",
-" .+@$$$$$**==$&.@+  ",
-" .+@%%%%%%%%%-;%@+  ",
-" .+@===****=>@@.@+  ",
-" .+@%%%%%%%-@,@;@;;;",
-" .+@==****>@,,@@@@@@",
-" .+@%%%%%-@,,,,,,,'@",
-" .+@=****>@),,)))))@",
-" .+@%%%%%%-@),@@@@@@",
-" .+@***====>@)@+@;;;",
-" .+@%%%%%%%%-@@%@+  ",
-" .+@====!!!!$;;.@+  ",
-" .+@@@@@@@@@@@@@@+  ",
-"  .++++++++++++++.  "};
-/* XPM */
-static const char * build_xpm[] = {
-"20 20 17 1",
-" 	c None",
-".	c #626262",
-"+	c #000000",
-"@	c #4A4A4A",
-"#	c #AAAAAA",
-"$	c #FFFFFF",
-"%	c #DADADA",
-"&	c #868686",
-"*	c #CECECE",
-"=	c #B6B6B6",
-"-	c #9E9E9E",
-";	c #6E6E6E",
-">	c #929292",
-",	c #C2C2C2",
-"'	c #7A7A7A",
-")	c #323232",
-"!	c #3E3E3E",
-".+++@@+++++..#      ",
-"+$$%&&$$%%%++@.#    ",
-"+$%*.+++@@+++++..#  ",
-"+%==+$$%&&$$%%%++@.#",
-"+=&&+$%*=*$%****-;+.",
-".++++%==&;=====***-+",
-">...+=&&@@;>>>;++>*+",
-"    .+++..+&&;+..+++",
-"    >...,.+''+.  ...",
-"     .+%,.+$%+.     ",
-"    #++++.+%,+.     ",
-"    '+.++.+%,+.     ",
-"    '+'.#++++++#    ",
-"    .+.)'+.++.+'    ",
-"    .+'.'+'.))+'    ",
-"    .+;).+.)).+.    ",
-"    .+'..+'.))+.    ",
-"    '+;).+;)).+.    ",
-"    #!!+++'.))+.    ",
-"        '+;))!!'    "};
-/* XPM */
-/*
-static const char * xbuild_xpm[] = {
-"20 20 17 1",
-" 	c None",
-".	c #929292",
-"+	c #626262",
-"@	c #AAAAAA",
-"#	c #000000",
-"$	c #4A4A4A",
-"%	c #FFFFFF",
-"&	c #DADADA",
-"*	c #868686",
-"=	c #CECECE",
-"-	c #B6B6B6",
-";	c #9E9E9E",
-">	c #6E6E6E",
-",	c #7A7A7A",
-"'	c #C2C2C2",
-")	c #323232",
-"!	c #3E3E3E",
-"  .+++@@+++++@      ",
-" .+###$$#####++@    ",
-" +#%%&**%%&&&##$+@  ",
-" +#%&=-=%&====;>#+@ ",
-" +#&--*>-----===;#+ ",
-" +#-**$$>...>##.=#+ ",
-" .+###++#**>#++###+ ",
-"  .+++ +#,,#+  +++  ",
-"       +#%&#+       ",
-"       +#&'#+       ",
-"       +#&'#+       ",
-"      @######@      ",
-"      ,#+##+#,      ",
-"      ,#,+))#,      ",
-"      +#+))+#+      ",
-"      +#,+))#+      ",
-"      +#>))+#+      ",
-"      +#,+))#+      ",
-"      ,#>))+#,      ",
-"      @!!##!!@      "};
-*/
-/* XPM */
-static const char * compile_xpm[] = {
-"20 20 16 1",
-" 	c None",
-".	c #929292",
-"+	c #626262",
-"@	c #1A1A1A",
-"#	c #000000",
-"$	c #3E3E3E",
-"%	c #7A7A7A",
-"&	c #E6E6E6",
-"*	c #565656",
-"=	c #6E6E6E",
-"-	c #4A4A4A",
-";	c #323232",
-">	c #B6B6B6",
-",	c #CECECE",
-"'	c #9E9E9E",
-")	c #868686",
-"                    ",
-"   .++++.  .++++.   ",
-"  .@####$  $####@.  ",
-"  .@%&.#$  $#&.+@.  ",
-"  .#*.=#++++#.=*#.  ",
-"  .#*=*#----#+-*#.  ",
-"  +#=*#;+  +;#+-#+  ",
-" +;=*##;+##+;##+-;  ",
-" +#;;;;;;;;;;;;;;#+ ",
-" +#>&,-# ## #>&,-#+ ",
-" +#','-# ## #','-#+ ",
-" -#)>%-######)>%-#- ",
-".#=)'%-#++++#)'%)=#.",
-"+#.=.+-#+  +#=.+=.#+",
-"+#)=)+-#+  +#=)+=)#+",
-"+#--+*-#+  +#-+*--#+",
-"+#+=.+*#+  +#+.+*-#+",
-"+#######+  +#######+",
-" +++++++    +++++++ ",
-"                    "};
-
-/* XPM */
-static const char * stop_xpm[] = {
-"20 20 13 1",
-" 	c None",
-".	c #FFD4E3",
-"+	c #FFB1C7",
-"@	c #FF8EAB",
-"#	c #FF6B8F",
-"$	c #FF4873",
-"%	c #FF2557",
-"&	c #DC0049",
-"*	c #960031",
-"=	c #800000",
-"-	c #626262",
-";	c #4A4A4A",
-">	c #000000",
-"     ->>>>>>>>-     ",
-"    ;>########>;    ",
-"   ;>#$&&&&&&&#>;   ",
-"  ;>#$&&&&&&&&&#>;  ",
-" ;>#$&&&&&&&&&&&#>; ",
-"->#$&&&&&&&&&&&&&#>-",
-">#$&&&&&&&&&&&&&&&&>",
-">#$+.+...@...#...#*>",
-">#+@&&&.$+@$@+.%#.*>",
-">#$..@$.$.$&$....#*>",
-">#%&&+@.$+@$@+.$&&*>",
-">#@..@$.$&...#.%&&*>",
-">#&$%&&%&&%%%&$&&&*>",
-">&&&&&&&&&&&&&&&&&*>",
-"->*&&&&&&&&&&&&&&*>;",
-" ;>*&&&&&&&&&&&&*>> ",
-"  ;>*&&&&&&&&&&*>>  ",
-"   ;>*&&&&&&&&*>>   ",
-"    ;>********>>    ",
-"     ->>>>>>>>;     "};
+// @file pixmapsGNOME.h
+// Set of images for tool bar buttons
+// Icons  Copyright(C) 1998  by  Dean S. Jones
+// http://jfa.javalobby.org/projects/icons/
+// Modified to have same names as tigert.h
+// Not really anything to do with Gnome - just calling this
+// file pixmapsGNOME to fit in with previous code.
+
+/* XPM */
+static const char * editcopy_xpm[] = {
+"20 20 13 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #6E6E6E",
+"@	c #000000",
+"#	c #8EFFFF",
+"$	c #FFB1B1",
+"%	c #B1FFFF",
+"&	c #3E3E3E",
+"*	c #DADADA",
+"=	c #F2F2F2",
+"-	c #FFFFFF",
+";	c #CECECE",
+">	c #E6E6E6",
+".+++++++++.         ",
+"+@@@@@@@@@+.        ",
+"+@#$%%%&*+&+.       ",
+"+@.$*=-&-*+@+.      ",
+"+@#$%%.+++++++++.   ",
+"+@.$*=+@@@@@@@@@+.  ",
+"+@#$%%+@#$%%%&*+&+. ",
+"+@.$*=+@.$;>=&-*+@+.",
+"+@#$%%+@#$%%%&--*@+.",
+"+@.$*=+@.$;>=++++@+.",
+"+@#$%%+@#$%%%%%%%@+.",
+"+@.$*=+@.$;>=---=@+.",
+"+@#$%%+@#$%%%%%%%@+.",
+"+@@@@@+@.$;>=---=@+.",
+".++++++@#$%%%%%%%@+.",
+" .....+@.$;>=---=@+.",
+"      +@#$%%%%%%%@+.",
+"      +@@@@@@@@@@@+.",
+"      .+++++++++++..",
+"       ............ "};
+/* XPM */
+static const char * editcut_xpm[] = {
+"20 20 14 1",
+" 	c None",
+".	c #7A7A7A",
+"+	c #AAAAAA",
+"@	c #C0C0C0",
+"#	c #4A4A4A",
+"$	c #000000",
+"%	c #CECECE",
+"&	c #FFFFFF",
+"*	c #B6B6B6",
+"=	c #9E9E9E",
+"-	c #E6E6E6",
+";	c #F2F2F2",
+">	c #6E6E6E",
+",	c #DADADA",
+"  ...          ...+@",
+" .#$$.        .$$$.+",
+" .$%$$.      .$$&$.+",
+" .$*&$$.    .$$&%$.+",
+" .$=-&$$.  .$$&%*$.+",
+" .$$@-&$$..$$&%*$$.+",
+"  .$$@-&$$$$&%*$$.+ ",
+"   .$$@-&.$&%*$$.+  ",
+"    .$$@-;..*$$.+   ",
+"     .$$@$&$$$.+    ",
+"      .$$+-%$>+++   ",
+"   ...$..$$%%$...+  ",
+"  .$$$$$$.$$$$$$$.+ ",
+" .$$++=$.+.$$=++$$.+",
+"+$$+,@,$. +.$,@,+$$+",
+"+$$&@&;$.  .$+,@&$$+",
+"+$$+&;$$+  +$$+&;$$+",
+" .$$$$$+    +$$$$$. ",
+"  .$$$+      +$$$.  ",
+"   +++        +++   "};
+/* XPM */
+static const char * close_xpm[] = {
+"20 20 242 2",
+"  	c None",
+". 	c #000000",
+"+ 	c #800000",
+"@ 	c #008000",
+"# 	c #808000",
+"$ 	c #000080",
+"% 	c #800080",
+"& 	c #008080",
+"* 	c #C0C0C0",
+"= 	c #C0DCC0",
+"- 	c #A6CAF0",
+"; 	c #FFF0D4",
+"> 	c #FFE2B1",
+", 	c #FFD48E",
+"' 	c #FFC66B",
+") 	c #FFB848",
+"! 	c #FFAA25",
+"~ 	c #FFAA00",
+"{ 	c #DC9200",
+"] 	c #B97A00",
+"^ 	c #966200",
+"/ 	c #734A00",
+"( 	c #503200",
+"_ 	c #FFE3D4",
+": 	c #FFC7B1",
+"< 	c #FFAB8E",
+"[ 	c #FF8F6B",
+"} 	c #FF7348",
+"| 	c #FF5725",
+"1 	c #FF5500",
+"2 	c #DC4900",
+"3 	c #B93D00",
+"4 	c #963100",
+"5 	c #732500",
+"6 	c #501900",
+"7 	c #FFD4D4",
+"8 	c #FFB1B1",
+"9 	c #FF8E8E",
+"0 	c #FF6B6B",
+"a 	c #FF4848",
+"b 	c #FF2525",
+"c 	c #FE0000",
+"d 	c #DC0000",
+"e 	c #B90000",
+"f 	c #960000",
+"g 	c #730000",
+"h 	c #500000",
+"i 	c #FFD4E3",
+"j 	c #FFB1C7",
+"k 	c #FF8EAB",
+"l 	c #FF6B8F",
+"m 	c #FF4873",
+"n 	c #FF2557",
+"o 	c #FF0055",
+"p 	c #DC0049",
+"q 	c #B9003D",
+"r 	c #960031",
+"s 	c #730025",
+"t 	c #500019",
+"u 	c #FFD4F0",
+"v 	c #FFB1E2",
+"w 	c #FF8ED4",
+"x 	c #FF6BC6",
+"y 	c #FF48B8",
+"z 	c #FF25AA",
+"A 	c #FF00AA",
+"B 	c #DC0092",
+"C 	c #B9007A",
+"D 	c #960062",
+"E 	c #73004A",
+"F 	c #500032",
+"G 	c #FFD4FF",
+"H 	c #FFB1FF",
+"I 	c #FF8EFF",
+"J 	c #FF6BFF",
+"K 	c #FF48FF",
+"L 	c #FF25FF",
+"M 	c #FE00FE",
+"N 	c #DC00DC",
+"O 	c #B900B9",
+"P 	c #960096",
+"Q 	c #730073",
+"R 	c #500050",
+"S 	c #F0D4FF",
+"T 	c #E2B1FF",
+"U 	c #D48EFF",
+"V 	c #C66BFF",
+"W 	c #B848FF",
+"X 	c #AA25FF",
+"Y 	c #AA00FF",
+"Z 	c #9200DC",
+"` 	c #7A00B9",
+" .	c #620096",
+"..	c #4A0073",
+"+.	c #320050",
+"@.	c #E3D4FF",
+"#.	c #C7B1FF",
+"$.	c #AB8EFF",
+"%.	c #8F6BFF",
+"&.	c #7348FF",
+"*.	c #5725FF",
+"=.	c #5500FF",
+"-.	c #4900DC",
+";.	c #3D00B9",
+">.	c #310096",
+",.	c #250073",
+"'.	c #190050",
+").	c #D4D4FF",
+"!.	c #B1B1FF",
+"~.	c #8E8EFF",
+"{.	c #6B6BFF",
+"].	c #4848FF",
+"^.	c #2525FF",
+"/.	c #0000FE",
+"(.	c #0000DC",
+"_.	c #0000B9",
+":.	c #000096",
+"<.	c #000073",
+"[.	c #000050",
+"}.	c #D4E3FF",
+"|.	c #B1C7FF",
+"1.	c #8EABFF",
+"2.	c #6B8FFF",
+"3.	c #4873FF",
+"4.	c #2557FF",
+"5.	c #0055FF",
+"6.	c #0049DC",
+"7.	c #003DB9",
+"8.	c #003196",
+"9.	c #002573",
+"0.	c #001950",
+"a.	c #D4F0FF",
+"b.	c #B1E2FF",
+"c.	c #8ED4FF",
+"d.	c #6BC6FF",
+"e.	c #48B8FF",
+"f.	c #25AAFF",
+"g.	c #00AAFF",
+"h.	c #0092DC",
+"i.	c #007AB9",
+"j.	c #006296",
+"k.	c #004A73",
+"l.	c #003250",
+"m.	c #D4FFFF",
+"n.	c #B1FFFF",
+"o.	c #8EFFFF",
+"p.	c #6BFFFF",
+"q.	c #48FFFF",
+"r.	c #25FFFF",
+"s.	c #00FEFE",
+"t.	c #00DCDC",
+"u.	c #00B9B9",
+"v.	c #009696",
+"w.	c #007373",
+"x.	c #005050",
+"y.	c #D4FFF0",
+"z.	c #B1FFE2",
+"A.	c #8EFFD4",
+"B.	c #6BFFC6",
+"C.	c #48FFB8",
+"D.	c #25FFAA",
+"E.	c #00FFAA",
+"F.	c #00DC92",
+"G.	c #00B97A",
+"H.	c #009662",
+"I.	c #00734A",
+"J.	c #005032",
+"K.	c #D4FFE3",
+"L.	c #B1FFC7",
+"M.	c #8EFFAB",
+"N.	c #6BFF8F",
+"O.	c #48FF73",
+"P.	c #25FF57",
+"Q.	c #00FF55",
+"R.	c #00DC49",
+"S.	c #00B93D",
+"T.	c #009631",
+"U.	c #007325",
+"V.	c #005019",
+"W.	c #D4FFD4",
+"X.	c #B1FFB1",
+"Y.	c #8EFF8E",
+"Z.	c #6BFF6B",
+"`.	c #48FF48",
+" +	c #25FF25",
+".+	c #00FE00",
+"++	c #00DC00",
+"@+	c #00B900",
+"#+	c #009600",
+"$+	c #007300",
+"%+	c #005000",
+"&+	c #E3FFD4",
+"*+	c #C7FFB1",
+"=+	c #ABFF8E",
+"-+	c #8FFF6B",
+";+	c #73FF48",
+">+	c #57FF25",
+",+	c #55FF00",
+"'+	c #49DC00",
+")+	c #3DB900",
+"!+	c #319600",
+"~+	c #257300",
+"{+	c #195000",
+"]+	c #F0FFD4",
+"^+	c #E2FFB1",
+"/+	c #D4FF8E",
+"(+	c #C6FF6B",
+"_+	c #B8FF48",
+":+	c #AAFF25",
+"<+	c #AAFF00",
+"[+	c #92DC00",
+"}+	c #7AB900",
+"|+	c #629600",
+"1+	c #4A7300",
+"2+	c #325000",
+"3+	c #FFFFD4",
+"4+	c #FFFFB1",
+"5+	c #FFFF8E",
+"6+	c #FFFF6B",
+"7+	c #FFFF48",
+"8+	c #FFFF25",
+"9+	c #FEFE00",
+"0+	c #DCDC00",
+"a+	c #B9B900",
+"b+	c #969600",
+"c+	c #737300",
+"d+	c #505000",
+"e+	c #F2F2F2",
+"f+	c #E6E6E6",
+"g+	c #DADADA",
+"h+	c #CECECE",
+"i+	c #C2C2C2",
+"j+	c #B6B6B6",
+"k+	c #AAAAAA",
+"l+	c #9E9E9E",
+"m+	c #929292",
+"n+	c #868686",
+"o+	c #7A7A7A",
+"p+	c #6E6E6E",
+"q+	c #626262",
+"r+	c #565656",
+"s+	c #4A4A4A",
+"                                        ",
+"      . . .                 s+. .       ",
+"    . . l . .             s+. l . .     ",
+"  . . l p l . .         s+. l p l . .   ",
+"  . l p p p l . .     s+. l p p p r .   ",
+"  . . r p p p l . q+q+. l p p p r . .   ",
+"    . . r p p p l . . l p p p r . .     ",
+"      . . r p p p l l p p p r . .       ",
+"        . . r p p p p p p r . .         ",
+"          q+. r p p p p r . q+          ",
+"          q+. l p p p p l . q+          ",
+"        . . l p p p p p p l . .         ",
+"      . . l p p p r r p p p l . .       ",
+"    . . l p p p r . . r p p p l . .     ",
+"  . . l p p p r . q+q+. r p p p l . .   ",
+"  . p p p p r . .     s+. r p p p p .   ",
+"  . . r p r . .         s+. r p r . .   ",
+"    . . r . .             s+. r . .     ",
+"      . . .                 s+. .       ",
+"                                        "};
+#if 0
+/* XPM */
+static const char * DocumentIn_xpm[] = {
+"20 20 17 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #B1FFFF",
+"$	c #FFB1B1",
+"%	c #CECECE",
+"&	c #7A7A7A",
+"*	c #E6E6E6",
+"=	c #FFFFFF",
+"-	c #868686",
+";	c #007373",
+">	c #6E6E6E",
+",	c #48B8FF",
+"'	c #8ED4FF",
+")	c #0092DC",
+"!	c #DADADA",
+"  .+++++++++++.     ",
+"  +@@@@@@@@@@@+.    ",
+"  +@#$####%@%&@+.   ",
+"  +@.$%***%@=%&@+.  ",
+"  +@#$####%@==%&@+. ",
+"  +@.$%**=%@===%@+. ",
+"  +@#$####%@@@@@@+. ",
+"  +@.$%**==%%%%%@+. ",
+"  +@#-;#########@+. ",
+"  +@.@@>*====***@+. ",
+"---@-@,@;#######@+. ",
+"@@@@@@,,@>====**@+. ",
+"@',,,,,,,@;#####@+. ",
+"@))))),,)@>====*@+. ",
+"@@@@@@,)@;######@+. ",
+"---@+@)@>****===@+. ",
+"  +@#@@;########@+. ",
+"  +@.--%!!!!****@+. ",
+"  +@@@@@@@@@@@@@@+. ",
+"  .++++++++++++++.  "};
+#endif
+#if 0
+/* XPM */
+static const char * Forward_xpm[] = {
+"20 20 22 1",
+" 	c None",
+".	c #AAAAAA",
+"+	c #626262",
+"@	c #3E3E3E",
+"#	c #000000",
+"$	c #626200",
+"%	c #937A00",
+"&	c #B6B6B6",
+"*	c #AF9200",
+"=	c #FFF0D4",
+"-	c #DFD48E",
+";	c #FFFFFF",
+">	c #C3B848",
+",	c #BDAA25",
+"'	c #9E9E9E",
+")	c #F2F2F2",
+"!	c #DADADA",
+"~	c #48B8FF",
+"{	c #565656",
+"]	c #323200",
+"^	c #8ED4FF",
+"/	c #0092DC",
+"          .+@#@+.   ",
+"         .@#$%$#@.  ",
+"        &+#*=--%#+& ",
+"        &@$=;->,$@& ",
+"        &#%--->,%#& ",
+"        &@$->>,*$@& ",
+"         +#%,,*%#+  ",
+"         '+#$%$#+'  ",
+"       +####@#@####+",
+"     @@+#)))))!!!!#+",
+"     ##@#!.))!!!.!#+",
+"+++++#~##.{)!!!!{!#+",
+"######~~#@]]]]]]]!#+",
+"#^~~~~~~~#]*%%%%]!#+",
+"#/////~~/##*%]*%###+",
+"######~/#@#*%]*%#++&",
+"+++++#/#@+#*%#*%#+  ",
+"     ##@ +#*%#*%#+  ",
+"     @@  +#$$#$$#+  ",
+"         +#######+  "};
+#endif
+#if 0
+/* XPM */
+static const char * Help_xpm[] = {
+"20 20 20 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #505000",
+"$	c #FFAA25",
+"%	c #FFC66B",
+"&	c #FFE2B1",
+"*	c #FFFFFF",
+"=	c #FFFF6B",
+"-	c #B9B900",
+";	c #969600",
+">	c #3E3E3E",
+",	c #808000",
+"'	c #FEFE00",
+")	c #1A1A1A",
+"!	c #DCDC00",
+"~	c #323232",
+"{	c #262626",
+"]	c #6E6E6E",
+" .++++++++++++++++. ",
+".+@@@@@@@@@@@@@@@@+.",
+"+@#$%%%%%%%%%%%%$#@+",
+"+@$%&&&&&&&&&&&&&$@+",
+"+@%&**=-;+>,-===&%@+",
+"+@%&*='>,=+@)!==&%@+",
+"+@%&*=!@~=!@@-==&%@+",
+"+@%&*==~+=!@@-==&%@+",
+"+@%&*=====,@>!==&%@+",
+"+@%&*====={+!===&%@+",
+"+@%&=====]-=====&%@+",
+"+@%&====!>;=====&%@+",
+"+@%&====+@@=====&%@+",
+"+@%&====;@>=====&%@+",
+"+@$%==========&&%$@+",
+"+@#$&=&&%%%%%%%%$#@+",
+" +@@&&&%$@@@@@@@@@+.",
+"  +@%%$@@>++++++++. ",
+"  +@$@@>+           ",
+"  +@@@+.            "};
+#endif
+#if 0
+/* XPM */
+static const char * Left_xpm[] = {
+"20 20 11 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #8ED4FF",
+"$	c #B1E2FF",
+"%	c #48B8FF",
+"&	c #FFFFFF",
+"*	c #25AAFF",
+"=	c #0092DC",
+"-	c #007AB9",
+"                    ",
+"                    ",
+"      ..            ",
+"     .++.           ",
+"    .+@@+.          ",
+"   .+@#@+.......... ",
+"  .+@#$@+++++++++++.",
+" .+@#$%@@@@@@@@@@@@+",
+".+@#&%%%#########*@+",
+"+@#&%%%%%%%%%%%%%=@+",
+"+@-*%%%%%%%%%%%%%=@+",
+".+@-*%*===========@+",
+" .+@-**@@@@@@@@@@@@+",
+"  .+@-*@+++++++++++.",
+"   .+@-@+.......... ",
+"    .+@@+.          ",
+"     .++.           ",
+"      ..            ",
+"                    ",
+"                    "};
+#endif
+/* XPM */
+static const char * search_xpm[] = {
+"20 20 21 1",
+" 	c None",
+".	c #AAAAAA",
+"+	c #7A7A7A",
+"@	c #626262",
+"#	c #929292",
+"$	c #4A4A4A",
+"%	c #000000",
+"&	c #6E6E6E",
+"*	c #B6B6B6",
+"=	c #DADADA",
+"-	c #D4D4FF",
+";	c #FFFFFF",
+">	c #B1B1FF",
+",	c #C7B1FF",
+"'	c #3E3E3E",
+")	c #4A4A00",
+"!	c #626200",
+"~	c #AF9200",
+"{	c #937A00",
+"]	c #F8E2B1",
+"^	c #323200",
+"   .+@@@@+.         ",
+"  #@$%%%%$@#        ",
+" #$%&*==*&%$#       ",
+".@%*=----=*%@.      ",
+"+$&=-;>>--=&$+      ",
+"@%*-;;,,>--*%@      ",
+"@%=->,,,,>-=%@      ",
+"@%=->,,,,>-=%@      ",
+"@%*-->,,>--*%@      ",
+"+$&=-->>--=&'+      ",
+".@%*=----=*%%'      ",
+" #$%&*==*&%$)%'     ",
+"  #@$%%%%'%!~{%'    ",
+"   .+@@@@+'%~]{%'   ",
+"           '%~]{%'  ",
+"            '%~]{%' ",
+"             '%~]{%'",
+"              '%~]!%",
+"               '%!^'",
+"                '%'#"};
+/* XPM */
+static const char * filenew_xpm[] = {
+"20 20 16 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #DC9200",
+"#	c #000000",
+"$	c #FFC66B",
+"%	c #FFFF00",
+"&	c #B1FFFF",
+"*	c #CECECE",
+"=	c #7A7A7A",
+"-	c #FFAA00",
+";	c #DCDC00",
+">	c #E6E6E6",
+",	c #FFFFFF",
+"'	c #DADADA",
+")	c #FFB1B1",
+"  .++@++++++++.     ",
+"  +#@$@#######+.    ",
+"  +@$%$@&&*#*=#+.   ",
+"  @-;%;-@>*#,*=#+.  ",
+" @-;;,;;-@*#,,*=#+. ",
+"$%%%,,%%%%$#,,,*#+. ",
+" @-;;%;;-@*######+. ",
+"  @-;%;-@,,*****#+. ",
+"  +@$%$@&&&&&&&&#+. ",
+"  +#-%->>,,,,>>>#+. ",
+"  +#-%-&&&&&&&&&#+. ",
+"  +#-%-'>,,,,,>>#+. ",
+"  +#@$@&&&&&&&&&#+. ",
+"  +#.@*'>>,,,,,>#+. ",
+"  +#&)&&&&&&&&&&#+. ",
+"  +#.)**'>>>>,,,#+. ",
+"  +#&)&&&&&&&&&&#+. ",
+"  +#.)**''''>>>>#+. ",
+"  +##############+. ",
+"  .++++++++++++++.  "};
+/* XPM */
+static const char * fileopen_xpm[] = {
+"20 20 15 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #868686",
+"@	c #6E6E6E",
+"#	c #000000",
+"$	c #626262",
+"%	c #D1C96B",
+"&	c #FFF0D4",
+"*	c #AF9200",
+"=	c #C3B848",
+"-	c #DFD48E",
+";	c #929292",
+">	c #937A00",
+",	c #BDAA25",
+"'	c #626200",
+"                    ",
+"                    ",
+" .+@@@@@+.          ",
+".+@#####$+..        ",
+".@#%&&&&#$@@@@@@@@@.",
+".@#&%%%%*##########@",
+".@#&==%%%--------*#@",
+".@#&===%%%%%%%%%%*#@",
+";@#&===>>>>>>>>>=*#@",
+"@##>>>>&&&&&&&&>=*#@",
+"#&&&&&=========>*>#@",
+"#,=============*>>#@",
+"#>==============>>#@",
+"@#,=============>>#@",
+";#>=============*>#@",
+".@#**************'#@",
+".;#################@",
+" .@@@@@@@@@@@@@@@@@.",
+"  ................. ",
+"                    "};
+/* XPM */
+static const char * editpaste_xpm[] = {
+"20 20 18 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #000000",
+"@	c #626262",
+"#	c #FFFFFF",
+"$	c #DADADA",
+"%	c #E6E6E6",
+"&	c #B97A00",
+"*	c #7A7A7A",
+"=	c #966200",
+"-	c #734A00",
+";	c #6E6E6E",
+">	c #8EFFFF",
+",	c #FFB1B1",
+"'	c #B1FFFF",
+")	c #3E3E3E",
+"!	c #CECECE",
+"~	c #F2F2F2",
+"   ....++++++....   ",
+"  .@@@+##@@$$+@@@.  ",
+" .@+++%.......+++@. ",
+" .@+&+#.******+&+@. ",
+" .@+&=++++++++-=+@. ",
+" .@+&==--------=+@. ",
+" .@+&==-+++++++++;. ",
+" .@+&==-+>,''')$;);.",
+" .@+&==-+.,!%~)#$;+@",
+" .@+&==-+>,''')##$+@",
+" .@+&==-+.,!%~;;;;+@",
+" .@+&==-+>,'''''''+@",
+" .@+&==-+.,!%~###~+@",
+" .@+&==-+>,'''''''+@",
+" .@+&==-+.,!%~###~+@",
+" .@+&==-+>,'''''''+@",
+" .@+&===+.,!%~###~+@",
+" .@++++++>,'''''''+@",
+"  .@@@@@+++++++++++@",
+"   .....@@@@@@@@@@@."};
+#if 0
+/* XPM */
+static const char * Print_xpm[] = {
+"20 20 25 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #323232",
+"$	c #AAAAAA",
+"%	c #FFC7B1",
+"&	c #CECECE",
+"*	c #E6E6E6",
+"=	c #FFFFFF",
+"-	c #8EFFFF",
+";	c #6E6E6E",
+">	c #00DCDC",
+",	c #C2C2C2",
+"'	c #4A4A00",
+")	c #00B9B9",
+"!	c #FFAB8E",
+"~	c #937A00",
+"{	c #F8E2B1",
+"]	c #C3B848",
+"^	c #C5AA00",
+"/	c #AF9200",
+"(	c #DFD48E",
+"_	c #D1C96B",
+":	c #626200",
+"      .+@@@@@@@@@#. ",
+"      .@$%&**====@+.",
+"     .+@-%-------@;.",
+"    ..@$%&***===@#. ",
+"   .++@>%>>>>>--@#..",
+"  .+@@$%,,,&***@'@@;",
+" .+@+@)!)))>>>>@'~~@",
+".+@+{''''''''''']=^@",
+"+@+{]]]]]]]]]]]]=^/@",
+"+@==============^{/@",
+"+@{{{{{{{{{{{((^{(/@",
+"+@{{_____(((::(^((/@",
+"+@{_____(((((~(^(//@",
+"+@________(((((^/]~@",
+"+@~~~~~~~~~~~~~~]]@#",
+"+@+]]]]]]]]]]]^~]@#.",
+".+@+^^^^^^^^^^~]@#. ",
+" .+@@@@@@@@@@@@@#.  ",
+"  .+++++++++++++.   ",
+"   .............    "};
+#endif
+/* XPM */
+static const char * redo_xpm[] = {
+"20 20 12 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #4A4A4A",
+"#	c #000000",
+"$	c #00B900",
+"%	c #9E9E9E",
+"&	c #7A7A7A",
+"*	c #00AB3D",
+"=	c #005000",
+"-	c #009631",
+";	c #007325",
+"                    ",
+"                    ",
+"                    ",
+"           .+@.     ",
+"          .+##@.    ",
+"    .......+#$#@.   ",
+"   %%&++++++#*$#@.  ",
+"  %&#########**$#@. ",
+" %&#=-*$$$$$$*-*$#@.",
+".&#=------------*$#@",
+"%#=--------------=#+",
+"&#;----======---=#+.",
+"#=----=######--=#+. ",
+"#=---;#%%%%+#-=#+.  ",
+"#=---;#%   +#=#+.   ",
+"#=---;#%   +##+.    ",
+"+######%   .++.     ",
+"%++++++%            ",
+"                    ",
+"                    "};
+/* XPM */
+static const char * filesave_xpm[] = {
+"20 20 16 1",
+" 	c None",
+".	c #6E6E6E",
+"+	c #4A4A4A",
+"@	c #000000",
+"#	c #7A7A7A",
+"$	c #929292",
+"%	c #9E9E9E",
+"&	c #B6B6B6",
+"*	c #C2C2C2",
+"=	c #AAAAAA",
+"-	c #565656",
+";	c #626262",
+">	c #FFFFFF",
+",	c #DADADA",
+"'	c #3E3E3E",
+")	c #CECECE",
+".++..............++.",
+"+++@@@@@@@@@@@@@@+++",
+"++#$............%#++",
+"+@#$............%#@+",
+"+@#$............%#@+",
+"+@#$............&#@+",
+"+@#$............*#@+",
+"+@#$............*#@+",
+"+@#$............&#@+",
+"+@##$$$$$==&&&*&##@+",
+"+@################@+",
+"+@##--------;;;;##@+",
+"+@#->>,,,,,,*'-;%#@+",
+"+@#->;-'>)*),'-;%#@+",
+"+@#-,;-'>*)*,'-;%#@+",
+"+@#-,;-'>)*),'-;%#@+",
+"+@#-,;-'>*)*,'-;%#@+",
+"+@+-,===****,'-;%#@+",
+"=+@@@@@@@@@@@@@@@@@+",
+" =+++++++++++++++++."};
+#if 0
+/* XPM */
+static const char * filesave_all_xpm[] = {
+"20 20 13 1",
+" 	c None",
+".	c #6E6E6E",
+"+	c #4A4A4A",
+"@	c #000000",
+"#	c #B6B6B6",
+"$	c #CECECE",
+"%	c #929292",
+"&	c #7A7A7A",
+"*	c #FFFFFF",
+"=	c #F2F2F2",
+"-	c #565656",
+";	c #DADADA",
+">	c #C2C2C2",
+"    .++.........++. ",
+"    +++@@@@@@@@@+++#",
+"    ++$.........$++#",
+"    +@%.........#@+#",
+".++.........++..#@+#",
+"+++@@@@@@@@@+++.$@+#",
+"++$.........$++$&@+#",
+"+@%.........#@+&&@+#",
+"+@%.........#@+%&@+#",
+"+@%.........$@+.&@+#",
+"+@&%%%%%###$&@+.&@+#",
+"+@&&&&&&&&&&&@+.&@+#",
+"+@&&......%%&@+.&@+#",
+"+@&.***===-.&@+@@@+#",
+"+@&.;.->>;-.&@++++.#",
+"+@&.;-@>>;-.&@+#### ",
+"+@+.;&&>>;-.&@+#    ",
+"#+@@@@@@@@@@@@+#    ",
+" #++++++++++++.#    ",
+"  #############     "};
+#endif
+/* XPM */
+static const char * undo_xpm[] = {
+"20 20 16 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #4A4A4A",
+"@	c #626262",
+"#	c #000000",
+"$	c #FF6B8F",
+"%	c #FFB1C7",
+"&	c #7A7A7A",
+"*	c #9E9E9E",
+"=	c #DC0049",
+"-	c #FFFFFF",
+";	c #FF0055",
+">	c #B9003D",
+",	c #960031",
+"'	c #B90000",
+")	c #501900",
+"                    ",
+"                    ",
+"                    ",
+"     .+@.           ",
+"    .+##@.          ",
+"   .+#$#@.......    ",
+"  .+#$%#@@@@@@&**   ",
+" .+#$%=#########&*  ",
+".+#$-==;;;;;;=>,#&* ",
+"+#$-============,#&.",
+"@#,$=============,#*",
+".@#,'=',,,,,,====>#&",
+" .@#,''######,====)#",
+"  .@#,'#@****#>===)#",
+"   .@#,#@   *#>===)#",
+"    .@##@   *#>===)#",
+"     .@@.   *######@",
+"            *@@@@@@*",
+"                    ",
+"                    "};
+/* XPM */
+static const char * replace_xpm[] = {
+"20 20 257 2",
+"  	c None",
+". 	c #000000",
+"+ 	c #800000",
+"@ 	c #008000",
+"# 	c #808000",
+"$ 	c #000080",
+"% 	c #800080",
+"& 	c #008080",
+"* 	c #C0C0C0",
+"= 	c #C0DCC0",
+"- 	c #A6CAF0",
+"; 	c #FFF0D4",
+"> 	c #F8E2B1",
+", 	c #DFD48E",
+"' 	c #D1C96B",
+") 	c #C3B848",
+"! 	c #BDAA25",
+"~ 	c #C5AA00",
+"{ 	c #AF9200",
+"] 	c #937A00",
+"^ 	c #626200",
+"/ 	c #4A4A00",
+"( 	c #323200",
+"_ 	c #FFE3D4",
+": 	c #FFC7B1",
+"< 	c #FFAB8E",
+"[ 	c #FF8F6B",
+"} 	c #FF7348",
+"| 	c #FF5725",
+"1 	c #FF5500",
+"2 	c #DC4900",
+"3 	c #B93D00",
+"4 	c #963100",
+"5 	c #732500",
+"6 	c #501900",
+"7 	c #FFD4D4",
+"8 	c #FFB1B1",
+"9 	c #FF8E8E",
+"0 	c #FF6B6B",
+"a 	c #FF4848",
+"b 	c #FF2525",
+"c 	c #FE0000",
+"d 	c #DC0000",
+"e 	c #B90000",
+"f 	c #960000",
+"g 	c #730000",
+"h 	c #500000",
+"i 	c #FFD4E3",
+"j 	c #FFB1C7",
+"k 	c #FF8EAB",
+"l 	c #FF6B8F",
+"m 	c #FF4873",
+"n 	c #FF2557",
+"o 	c #FF0055",
+"p 	c #DC0049",
+"q 	c #B9003D",
+"r 	c #960031",
+"s 	c #730025",
+"t 	c #500019",
+"u 	c #FFD4F0",
+"v 	c #FFB1E2",
+"w 	c #FF8ED4",
+"x 	c #FF6BC6",
+"y 	c #FF48B8",
+"z 	c #FF25AA",
+"A 	c #FF00AA",
+"B 	c #DC0092",
+"C 	c #B9007A",
+"D 	c #960062",
+"E 	c #73004A",
+"F 	c #500032",
+"G 	c #FFD4FF",
+"H 	c #FFB1FF",
+"I 	c #FF8EFF",
+"J 	c #FF6BFF",
+"K 	c #FF48FF",
+"L 	c #FF25FF",
+"M 	c #FE00FE",
+"N 	c #DC00DC",
+"O 	c #B900B9",
+"P 	c #960096",
+"Q 	c #730073",
+"R 	c #500050",
+"S 	c #F0D4FF",
+"T 	c #E2B1FF",
+"U 	c #D48EFF",
+"V 	c #C66BFF",
+"W 	c #B848FF",
+"X 	c #AA25FF",
+"Y 	c #AA00FF",
+"Z 	c #9200DC",
+"` 	c #7A00B9",
+" .	c #620096",
+"..	c #4A0073",
+"+.	c #320050",
+"@.	c #E3D4FF",
+"#.	c #C7B1FF",
+"$.	c #AB8EFF",
+"%.	c #8F6BFF",
+"&.	c #7348FF",
+"*.	c #5725FF",
+"=.	c #5500FF",
+"-.	c #4900DC",
+";.	c #3D00B9",
+">.	c #310096",
+",.	c #250073",
+"'.	c #190050",
+").	c #D4D4FF",
+"!.	c #B1B1FF",
+"~.	c #8E8EFF",
+"{.	c #6B6BFF",
+"].	c #4848FF",
+"^.	c #2525FF",
+"/.	c #0000FE",
+"(.	c #0000DC",
+"_.	c #0000B9",
+":.	c #000096",
+"<.	c #000073",
+"[.	c #000050",
+"}.	c #D4E3FF",
+"|.	c #B1C7FF",
+"1.	c #8EABFF",
+"2.	c #6B8FFF",
+"3.	c #4873FF",
+"4.	c #2557FF",
+"5.	c #0055FF",
+"6.	c #0049DC",
+"7.	c #003DB9",
+"8.	c #003196",
+"9.	c #002573",
+"0.	c #001950",
+"a.	c #D4F0FF",
+"b.	c #B1E2FF",
+"c.	c #8ED4FF",
+"d.	c #6BC6FF",
+"e.	c #48B8FF",
+"f.	c #25AAFF",
+"g.	c #00AAFF",
+"h.	c #0092DC",
+"i.	c #007AB9",
+"j.	c #006296",
+"k.	c #004A73",
+"l.	c #003250",
+"m.	c #D4FFFF",
+"n.	c #B1FFFF",
+"o.	c #8EFFFF",
+"p.	c #6BFFFF",
+"q.	c #48FFFF",
+"r.	c #25FFFF",
+"s.	c #00FEFE",
+"t.	c #00DCDC",
+"u.	c #00B9B9",
+"v.	c #009696",
+"w.	c #007373",
+"x.	c #005050",
+"y.	c #D4FFF0",
+"z.	c #B1FFE2",
+"A.	c #8EFFD4",
+"B.	c #6BFFC6",
+"C.	c #48FFB8",
+"D.	c #25FFAA",
+"E.	c #00FFAA",
+"F.	c #00DC92",
+"G.	c #00B97A",
+"H.	c #009662",
+"I.	c #00734A",
+"J.	c #005032",
+"K.	c #D4FFE3",
+"L.	c #B1FFC7",
+"M.	c #8EFFAB",
+"N.	c #6BFF8F",
+"O.	c #48FF73",
+"P.	c #25FF57",
+"Q.	c #00FF55",
+"R.	c #00DC49",
+"S.	c #00B93D",
+"T.	c #009631",
+"U.	c #007325",
+"V.	c #005019",
+"W.	c #D4FFD4",
+"X.	c #B1FFB1",
+"Y.	c #8EFF8E",
+"Z.	c #6BFF6B",
+"`.	c #48FF48",
+" +	c #25FF25",
+".+	c #00FE00",
+"++	c #00DC00",
+"@+	c #00B900",
+"#+	c #009600",
+"$+	c #007300",
+"%+	c #005000",
+"&+	c #E3FFD4",
+"*+	c #C7FFB1",
+"=+	c #ABFF8E",
+"-+	c #8FFF6B",
+";+	c #73FF48",
+">+	c #57FF25",
+",+	c #55FF00",
+"'+	c #49DC00",
+")+	c #3DB900",
+"!+	c #319600",
+"~+	c #257300",
+"{+	c #195000",
+"]+	c #F0FFD4",
+"^+	c #E2FFB1",
+"/+	c #D4FF8E",
+"(+	c #C6FF6B",
+"_+	c #B8FF48",
+":+	c #AAFF25",
+"<+	c #AAFF00",
+"[+	c #92DC00",
+"}+	c #7AB900",
+"|+	c #629600",
+"1+	c #4A7300",
+"2+	c #325000",
+"3+	c #FFFFD4",
+"4+	c #FFFFB1",
+"5+	c #FFFF8E",
+"6+	c #FFFF6B",
+"7+	c #FFFF48",
+"8+	c #FFFF25",
+"9+	c #FEFE00",
+"0+	c #DCDC00",
+"a+	c #B9B900",
+"b+	c #969600",
+"c+	c #737300",
+"d+	c #505000",
+"e+	c #F2F2F2",
+"f+	c #E6E6E6",
+"g+	c #DADADA",
+"h+	c #CECECE",
+"i+	c #C2C2C2",
+"j+	c #B6B6B6",
+"k+	c #AAAAAA",
+"l+	c #9E9E9E",
+"m+	c #929292",
+"n+	c #868686",
+"o+	c #7A7A7A",
+"p+	c #6E6E6E",
+"q+	c #626262",
+"r+	c #565656",
+"s+	c #4A4A4A",
+"t+	c #3E3E3E",
+"u+	c #323232",
+"v+	c #262626",
+"w+	c #1A1A1A",
+"x+	c #0E0E0E",
+"y+	c #FFFBF0",
+"z+	c #A0A0A4",
+"A+	c #808080",
+"B+	c #FF0000",
+"C+	c #00FF00",
+"D+	c #FFFF00",
+"E+	c #0000FF",
+"F+	c #FF00FF",
+"G+	c #00FFFF",
+"H+	c #FFFFFF",
+"      k+o+q+q+q+q+o+k+                  ",
+"    m+q+s+. . . . s+q+m+      j+m+m+    ",
+"  m+s+. p+j+g+g+j+p+. s+m+    t+. t+m+  ",
+"k+q+. j+g+).).).).g+j+. q+k+t+. 9 . t+m+",
+"o+s+p+g+).H+!.!.).).g+p+s+t+. 7 8 9 . t+",
+"q+. j+).H+H+#.#.!.).).j+t+. . 8 8 9 0 . ",
+"q+. g+).!.#.#.#.#.!.).t+. ~ t+. 9 0 . t+",
+"q+. g+).!.#.#.#.#.!.t+. ~ 3+9+t+. . t+  ",
+"q+. j+).).!.#.#.!.t+. ~ 3+9+[ } . t+    ",
+"o+s+p+g+).).!.!.t+. ~ 3+9+[ } . t+      ",
+"k+q+. j+g+).).t+. ~ 3+9+[ } . t+        ",
+"  m+s+. p+j+t+. ~ 3+9+[ } . t+          ",
+"    m+q+s+t+. ~ 3+9+[ } . t+. t+        ",
+"      k+t+. ~ 3+9+[ } . t+> ] . t+      ",
+"      t+. ~ 3+9+[ } . t+. { > ] . t+    ",
+"  j+t+. . t+9+[ } . t+  t+. { > ] . t+  ",
+"  k+/ > ; . t+} . t+      t+. { > ] . t+",
+"  m+^ ; > > . . t+          t+. { > ^ . ",
+"  p+^ > > > . t+              t+. ^ ( t+",
+"  p+. ^ ^ / t+                  t+. t+m+"};
+
+/* XPM */
+/*
+static const char * replace_xpm[] = {
+"20 20 9 1",
+" 	c None",
+".	c #4A4A4A",
+"+	c #6E6E6E",
+"@	c #000000",
+"#	c #006296",
+"$	c #0092DC",
+"%	c #007AB9",
+"&	c #868686",
+"*	c #003250",
+"                    ",
+" .....+.....+       ",
+".@@@@@@@@@@@@.      ",
+".@####@@####@@.     ",
+".@@#$$#@@#$$#@@.    ",
+" .@@#$%#@@#$%#@@.   ",
+"  .@@#$%#@@#$%#@@.  ",
+"   .@@#$%#@@$%%#@@. ",
+"    .@@#$%#@@$%%#@@&",
+"     .@*#$%#@*$$%#@@",
+"     .@*#$%#@*#$%#@@",
+"    .@@#$%#@@#$%#@@&",
+"   .@@#$%#@@#$%#@@. ",
+"  .@@#$%#@@#$%#@@.  ",
+" .@@#%%#@@#%%#@@.   ",
+".@@#%%#@@#%%#@@.    ",
+".@####@@####@@.     ",
+".@@@@@@@@@@@@.      ",
+" .....+.....+       ",
+"                    "};
+*/
+#if 0
+/* XPM */
+static const char * World_xpm[] = {
+"20 20 32 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #AAAAAA",
+"@	c #868686",
+"#	c #6E6E6E",
+"$	c #4A4A4A",
+"%	c #323232",
+"&	c #000000",
+"*	c #565656",
+"=	c #006296",
+"-	c #CECECE",
+";	c #FFFFFF",
+">	c #007AB9",
+",	c #0092DC",
+"'	c #48B8FF",
+")	c #007373",
+"!	c #00734A",
+"~	c #00AAFF",
+"{	c #8ED4FF",
+"]	c #25AAFF",
+"^	c #00B9B9",
+"/	c #005050",
+"(	c #DADADA",
+"_	c #C5AA00",
+":	c #626200",
+"<	c #4A4A00",
+"[	c #323200",
+"}	c #3E3E3E",
+"|	c #B1FFFF",
+"1	c #48FFFF",
+"2	c #004A73",
+"3	c #003250",
+"     ..+@##@+..     ",
+"    .@$%&**&%$@.    ",
+"   .*&=-;;-;>=&*.   ",
+"  .*&,,';-;-'))&*.  ",
+" .*&!~{{']']^///&*. ",
+".@&!^;;'](((!_::<&@.",
+".$!^.;']';;((_::<[$.",
+"+%:'{']']]]^!_::<[%+",
+"@&:...((((^!:_:<<[&@",
+"#}<[.(;|||11_::<[>2#",
+"#}<..((((],!:::<>>2#",
+"@&@.((],],]/::<,>>&@",
+"+%@.,],],],,/:<>>=%+",
+".$[,,,,,,,,,,/<>=3$.",
+".@&,>,@,>,>,@>/23&@.",
+" .*&3@.@>>>.;@23&*. ",
+"  .*&3%..;..@23&*.  ",
+"   .*&3%;;;.@3&*.   ",
+"    .@$%&%%&%$@.    ",
+"     ..+@##@+..     "};
+#endif
+/* XPM */
+static const char * findinfiles_xpm[] = {
+"20 20 28 1",
+" 	c None",
+".	c #AAAAAA",
+"+	c #7A7A7A",
+"@	c #626262",
+"#	c #B6B6B6",
+"$	c #929292",
+"%	c #4A4A4A",
+"&	c #000000",
+"*	c #6E6E6E",
+"=	c #FF8E8E",
+"-	c #DADADA",
+";	c #FFB1B1",
+">	c #FFFFFF",
+",	c #005050",
+"'	c #D4FFFF",
+")	c #CECECE",
+"!	c #007373",
+"~	c #00DCDC",
+"{	c #00B9B9",
+"]	c #B1FFFF",
+"^	c #3E3E3E",
+"/	c #E6E6E6",
+"(	c #505000",
+"_	c #626200",
+":	c #AF9200",
+"<	c #937A00",
+"[	c #9E9E9E",
+"}	c #F8E2B1",
+"   .+@@@@@@@@@#     ",
+"  $@%&&&&%@&&&@#    ",
+" $%&*=--#*&%$+&@#   ",
+".@&#;;>>>>#&@.+&@#  ",
+"+%,';;''''',%+)+&@# ",
+"@&!~;;~~~~~!&@>)&@# ",
+"@&->;;>>>>>-&@&&&@# ",
+"@&->;;>>>>>-&@))&@# ",
+"@&{';;'''''{&@]]&@# ",
+"+%!~;;~~~~~!^+//&@# ",
+".@&#;;>>>-#&&^]]&@# ",
+" $%&*=--#*&%(&^/&@# ",
+"  @&%&&&&%&_:<&^&@# ",
+"  @&[=###/^&:}<&^@# ",
+"  @&];]]]]]^&:}<&^# ",
+"  @&#;))-///^&:}<&^ ",
+"  @&];]]]]]]]^&:}<&^",
+"  @&#;))----//^&:}_&",
+"  @&&&&&&&&&&&&^&_&^",
+"  #@@@@@@@@@@@@@^&^ "};
+/* XPM */
+static const char * findnext_xpm[] = {
+"20 20 30 1",
+" 	c None",
+".	c #AAAAAA",
+"+	c #7A7A7A",
+"@	c #626262",
+"#	c #929292",
+"$	c #4A4A4A",
+"%	c #000000",
+"&	c #6E6E6E",
+"*	c #B6B6B6",
+"=	c #DADADA",
+"-	c #D4D4FF",
+";	c #FFFFFF",
+">	c #B1B1FF",
+",	c #C7B1FF",
+"'	c #3E3E3E",
+")	c #4A4A00",
+"!	c #E6E6E6",
+"~	c #303030",
+"{	c #676709",
+"]	c #AF9200",
+"^	c #937A00",
+"/	c #48B8FF",
+"(	c #007373",
+"_	c #B1FFFF",
+":	c #F8E2B1",
+"<	c #686868",
+"[	c #8ED4FF",
+"}	c #0092DC",
+"|	c #626200",
+"1	c #323200",
+"   .+@@@@+.         ",
+"  #@$%%%%$@#        ",
+" #$%&*==*&%$#       ",
+".@%*=----=*%@.      ",
+"+$&=-;>>--=&$+      ",
+"@%*-;;,,>--*%@      ",
+"@%=->,,,,>-=%@      ",
+"@%=->,,,,>-=%@      ",
+"@%*-->,,>--*%@      ",
+"+$&=-->>--=&'+      ",
+".@%*=----=*%%'      ",
+" #$%&*==*&%$)%'     ",
+"  #@$%%%&!~{]^%'    ",
+"   .+@%/%(_%]:^%'   ",
+"%%%%%%%//%&<%]:^%'  ",
+"%[////////%('%]:^%' ",
+"%}}}}}}//}%& '%]:^%'",
+"%%%%%%%/}%(   '%]:|%",
+"      %}%&     '%|1'",
+"      %%(       '%'#"};
+/* XPM */
+static const char * next_xpm[] = {
+"20 20 17 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #B1FFFF",
+"$	c #FFB1B1",
+"%	c #CECECE",
+"&	c #7A7A7A",
+"*	c #E6E6E6",
+"=	c #FFFFFF",
+"-	c #868686",
+";	c #007373",
+">	c #6E6E6E",
+",	c #48B8FF",
+"'	c #8ED4FF",
+")	c #0092DC",
+"!	c #DADADA",
+"  .+++++++++++.     ",
+"  +@@@@@@@@@@@+.    ",
+"  +@#$####%@%&@+.   ",
+"  +@.$%***%@=%&@+.  ",
+"  +@#$####%@==%&@+. ",
+"  +@.$%**=%@===%@+. ",
+"  +@#$####%@@@@@@+. ",
+"  +@.$%**==%%%%%@+. ",
+"  +@#-;#########@+. ",
+"  +@.@@>*====***@+. ",
+"---@-@,@;#######@+. ",
+"@@@@@@,,@>====**@+. ",
+"@',,,,,,,@;#####@+. ",
+"@))))),,)@>====*@+. ",
+"@@@@@@,)@;######@+. ",
+"---@+@)@>****===@+. ",
+"  +@#@@;########@+. ",
+"  +@.--%!!!!****@+. ",
+"  +@@@@@@@@@@@@@@+. ",
+"  .++++++++++++++.  "};
+/* XPM */
+static const char * prev_xpm[] = {
+"20 20 17 1",
+" 	c None",
+".	c #B6B6B6",
+"+	c #626262",
+"@	c #000000",
+"#	c #7A7A7A",
+"$	c #CECECE",
+"%	c #B1FFFF",
+"&	c #FFB1B1",
+"*	c #FFFFFF",
+"=	c #E6E6E6",
+"-	c #007373",
+";	c #868686",
+">	c #6E6E6E",
+",	c #48B8FF",
+"'	c #8ED4FF",
+")	c #0092DC",
+"!	c #DADADA",
+"     .+++++++++++.  ",
+"    .+@@@@@@@@@@@+  ",
+"   .+@#$@$%%%%&%@+  ",
+"  .+@#$*@$===$&.@+  ",
+" .+@#$**@$%%%%&%@+  ",
+" .+@$***@$*==$&.@+  ",
+" .+@@@@@@$%%%%&%@+  ",
+" .+@$$$$$**==$&.@+  ",
+" .+@%%%%%%%%%-;%@+  ",
+" .+@===****=>@@.@+  ",
+" .+@%%%%%%%-@,@;@;;;",
+" .+@==****>@,,@@@@@@",
+" .+@%%%%%-@,,,,,,,'@",
+" .+@=****>@),,)))))@",
+" .+@%%%%%%-@),@@@@@@",
+" .+@***====>@)@+@;;;",
+" .+@%%%%%%%%-@@%@+  ",
+" .+@====!!!!$;;.@+  ",
+" .+@@@@@@@@@@@@@@+  ",
+"  .++++++++++++++.  "};
+/* XPM */
+static const char * build_xpm[] = {
+"20 20 17 1",
+" 	c None",
+".	c #626262",
+"+	c #000000",
+"@	c #4A4A4A",
+"#	c #AAAAAA",
+"$	c #FFFFFF",
+"%	c #DADADA",
+"&	c #868686",
+"*	c #CECECE",
+"=	c #B6B6B6",
+"-	c #9E9E9E",
+";	c #6E6E6E",
+">	c #929292",
+",	c #C2C2C2",
+"'	c #7A7A7A",
+")	c #323232",
+"!	c #3E3E3E",
+".+++@@+++++..#      ",
+"+$$%&&$$%%%++@.#    ",
+"+$%*.+++@@+++++..#  ",
+"+%==+$$%&&$$%%%++@.#",
+"+=&&+$%*=*$%****-;+.",
+".++++%==&;=====***-+",
+">...+=&&@@;>>>;++>*+",
+"    .+++..+&&;+..+++",
+"    >...,.+''+.  ...",
+"     .+%,.+$%+.     ",
+"    #++++.+%,+.     ",
+"    '+.++.+%,+.     ",
+"    '+'.#++++++#    ",
+"    .+.)'+.++.+'    ",
+"    .+'.'+'.))+'    ",
+"    .+;).+.)).+.    ",
+"    .+'..+'.))+.    ",
+"    '+;).+;)).+.    ",
+"    #!!+++'.))+.    ",
+"        '+;))!!'    "};
+/* XPM */
+/*
+static const char * xbuild_xpm[] = {
+"20 20 17 1",
+" 	c None",
+".	c #929292",
+"+	c #626262",
+"@	c #AAAAAA",
+"#	c #000000",
+"$	c #4A4A4A",
+"%	c #FFFFFF",
+"&	c #DADADA",
+"*	c #868686",
+"=	c #CECECE",
+"-	c #B6B6B6",
+";	c #9E9E9E",
+">	c #6E6E6E",
+",	c #7A7A7A",
+"'	c #C2C2C2",
+")	c #323232",
+"!	c #3E3E3E",
+"  .+++@@+++++@      ",
+" .+###$$#####++@    ",
+" +#%%&**%%&&&##$+@  ",
+" +#%&=-=%&====;>#+@ ",
+" +#&--*>-----===;#+ ",
+" +#-**$$>...>##.=#+ ",
+" .+###++#**>#++###+ ",
+"  .+++ +#,,#+  +++  ",
+"       +#%&#+       ",
+"       +#&'#+       ",
+"       +#&'#+       ",
+"      @######@      ",
+"      ,#+##+#,      ",
+"      ,#,+))#,      ",
+"      +#+))+#+      ",
+"      +#,+))#+      ",
+"      +#>))+#+      ",
+"      +#,+))#+      ",
+"      ,#>))+#,      ",
+"      @!!##!!@      "};
+*/
+/* XPM */
+static const char * compile_xpm[] = {
+"20 20 16 1",
+" 	c None",
+".	c #929292",
+"+	c #626262",
+"@	c #1A1A1A",
+"#	c #000000",
+"$	c #3E3E3E",
+"%	c #7A7A7A",
+"&	c #E6E6E6",
+"*	c #565656",
+"=	c #6E6E6E",
+"-	c #4A4A4A",
+";	c #323232",
+">	c #B6B6B6",
+",	c #CECECE",
+"'	c #9E9E9E",
+")	c #868686",
+"                    ",
+"   .++++.  .++++.   ",
+"  .@####$  $####@.  ",
+"  .@%&.#$  $#&.+@.  ",
+"  .#*.=#++++#.=*#.  ",
+"  .#*=*#----#+-*#.  ",
+"  +#=*#;+  +;#+-#+  ",
+" +;=*##;+##+;##+-;  ",
+" +#;;;;;;;;;;;;;;#+ ",
+" +#>&,-# ## #>&,-#+ ",
+" +#','-# ## #','-#+ ",
+" -#)>%-######)>%-#- ",
+".#=)'%-#++++#)'%)=#.",
+"+#.=.+-#+  +#=.+=.#+",
+"+#)=)+-#+  +#=)+=)#+",
+"+#--+*-#+  +#-+*--#+",
+"+#+=.+*#+  +#+.+*-#+",
+"+#######+  +#######+",
+" +++++++    +++++++ ",
+"                    "};
+
+/* XPM */
+static const char * stop_xpm[] = {
+"20 20 13 1",
+" 	c None",
+".	c #FFD4E3",
+"+	c #FFB1C7",
+"@	c #FF8EAB",
+"#	c #FF6B8F",
+"$	c #FF4873",
+"%	c #FF2557",
+"&	c #DC0049",
+"*	c #960031",
+"=	c #800000",
+"-	c #626262",
+";	c #4A4A4A",
+">	c #000000",
+"     ->>>>>>>>-     ",
+"    ;>########>;    ",
+"   ;>#$&&&&&&&#>;   ",
+"  ;>#$&&&&&&&&&#>;  ",
+" ;>#$&&&&&&&&&&&#>; ",
+"->#$&&&&&&&&&&&&&#>-",
+">#$&&&&&&&&&&&&&&&&>",
+">#$+.+...@...#...#*>",
+">#+@&&&.$+@$@+.%#.*>",
+">#$..@$.$.$&$....#*>",
+">#%&&+@.$+@$@+.$&&*>",
+">#@..@$.$&...#.%&&*>",
+">#&$%&&%&&%%%&$&&&*>",
+">&&&&&&&&&&&&&&&&&*>",
+"->*&&&&&&&&&&&&&&*>;",
+" ;>*&&&&&&&&&&&&*>> ",
+"  ;>*&&&&&&&&&&*>>  ",
+"   ;>*&&&&&&&&*>>   ",
+"    ;>********>>    ",
+"     ->>>>>>>>;     "};
@@ -0,0 +1,100 @@
+// SciTE - Scintilla based Text Editor
+/** @file Hibernation.cxx
+ ** Decide when idle buffers give up their memory and what waking them needs.
+ ** Buffers restored lazily from a session start unloaded and wake in the same way.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstdint>
+#include <ctime>
+
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <chrono>
+
+#include "GUI.h"
+
+#include "StringHelpers.h"
+#include "Hibernation.h"
+
+IdleAction ChooseIdleAction(const IdleBuffer &buffer, time_t now, time_t delayBeforeHibernate) noexcept {
+	// Only opened documents that are not shown or in use by a background task are hibernated
+	if (buffer.current || !buffer.hasDocument || buffer.busy || (buffer.hibernation != Hibernation::none)) {
+		return IdleAction::none;
+	}
+	if (buffer.activeTime == 0) {
+		return IdleAction::startIdle;
+	}
+	if (now - buffer.activeTime <= delayBeforeHibernate) {
+		return IdleAction::none;
+	}
+	return IdleAction::hibernate;
+}
+
+Hibernation HibernationFor(bool isDirty, bool untitled, bool changedOnDisk) noexcept {
+	if (isDirty || untitled || changedOnDisk) {
+		// Changes are only held by the document so keep it with its undo history
+		return Hibernation::compressed;
+	}
+	return Hibernation::released;
+}
+
+WakeSteps StepsToWake(Hibernation hibernation) noexcept {
+	// Scintilla wakes compressed documents itself when they are shown
+	WakeSteps steps;
+	steps.readFile = (hibernation == Hibernation::released) || (hibernation == Hibernation::unloaded);
+	steps.readOnlyFromProperties = hibernation == Hibernation::unloaded;
+	steps.keepEncoding = hibernation == Hibernation::released;
+	steps.notifyOpen = hibernation == Hibernation::unloaded;
+	return steps;
+}
+
+std::vector<intptr_t> LinesFromString(std::string_view s) {
+	std::vector<intptr_t> result;
+	while (!s.empty()) {
+		const size_t posComma = s.find(',');
+		const std::string number(s.substr(0, posComma));
+		result.push_back(IntegerFromText(number.c_str()) - 1);
+		if (posComma == std::string_view::npos)
+			break;
+		s.remove_prefix(posComma + 1);
+	}
+	return result;
+}
+
+std::string StringFromLines(const std::vector<intptr_t> &lines) {
+	std::string result;
+	for (const intptr_t line : lines) {
+		if (result.length()) {
+			result.append(",");
+		}
+		result.append(std::to_string(line + 1));
+	}
+	return result;
+}
+
+std::string ContractedFoldsText(const std::vector<intptr_t> &folds) {
+	// Apply all the folds together as toggling each fold updates the display each time
+	std::string lines;
+	for (const intptr_t fold : folds) {
+		lines.append(std::to_string(fold));
+		lines.append(" ");
+	}
+	return lines;
+}
+
+std::vector<int> PrefetchCandidates(const std::vector<bool> &waiting, int current, int prefetch) {
+	std::vector<int> candidates;
+	const int end = static_cast<int>(std::min<size_t>(static_cast<size_t>(current) + 1 + std::max(prefetch, 0), waiting.size()));
+	for (int i = current + 1; i < end; i++) {
+		if (waiting[i]) {
+			candidates.push_back(i);
+		}
+	}
+	return candidates;
+}
@@ -0,0 +1,58 @@
+// SciTE - Scintilla based Text Editor
+/** @file Hibernation.h
+ ** Decide when idle buffers give up their memory and what waking them needs.
+ ** Buffers restored lazily from a session start unloaded and wake in the same way.
+ **/
+// Copyright 2026 by agent <agent@local>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef HIBERNATION_H
+#define HIBERNATION_H
+
+/// Released documents are read again from the file when next shown and
+/// unloaded ones, restored from a session, are read for the first time
+enum class Hibernation { none, compressed, released, unloaded };
+
+/// The parts of a buffer that decide whether it may hibernate
+struct IdleBuffer {
+	bool current = false;
+	bool hasDocument = false;
+	bool busy = false;	///< Loading or saving in the background or not yet fully opened
+	Hibernation hibernation = Hibernation::none;
+	time_t activeTime = 0;	///< When last current, 0 if not yet seen idle
+};
+
+enum class IdleAction {
+	none,	///< Stay as it is
+	startIdle,	///< First seen idle so start timing from now
+	hibernate	///< Idle for longer than the delay
+};
+
+IdleAction ChooseIdleAction(const IdleBuffer &buffer, time_t now, time_t delayBeforeHibernate) noexcept;
+
+/// Released when reading the file again gives the same text and save point, otherwise compressed.
+/// changedOnDisk is only needed for saved files so may be left false for others.
+Hibernation HibernationFor(bool isDirty, bool untitled, bool changedOnDisk) noexcept;
+
+/// What WakeReleasedBuffer does for a buffer when it is shown
+struct WakeSteps {
+	bool readFile = false;	///< The document was released or not yet loaded so is read from the file
+	bool readOnlyFromProperties = false;	///< First read so takes read.only from the properties
+	bool keepEncoding = false;	///< Read before so keeps the encoding it had then
+	bool notifyOpen = false;	///< First read so extensions are told the file opened
+};
+
+WakeSteps StepsToWake(Hibernation hibernation) noexcept;
+
+// Line numbers are 0-based inside SciTE but are saved in session files as 1-based.
+std::vector<intptr_t> LinesFromString(std::string_view s);
+std::string StringFromLines(const std::vector<intptr_t> &lines);
+
+/// The argument to SCI_SETCONTRACTEDFOLDS that restores the saved folds together
+std::string ContractedFoldsText(const std::vector<intptr_t> &folds);
+
+/// Buffers after current, within prefetch tabs, that are unloaded and not already being read.
+/// waiting is indexed by buffer and is true for those that are unloaded and not being read.
+std::vector<int> PrefetchCandidates(const std::vector<bool> &waiting, int current, int prefetch);
+
+#endif
@@ -1,88 +1,115 @@
-// SciTE - Scintilla based Text Editor
-/** @file JobQueue.h
- ** Define job queue
- **/
-// SciTE & Scintilla copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
-// Copyright 2007 by Neil Hodgson <neilh@scintilla.org>, from April White <april_white@sympatico.ca>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-// TODO: see http://www.codeproject.com/threads/cppsyncstm.asp
-
-#ifndef JOBQUEUE_H
-#define JOBQUEUE_H
-
-enum class JobSubsystem {
-	cli = 0, gui = 1, shell = 2, extension = 3, help = 4, otherHelp = 5, grep = 6, immediate = 7, commandlist = 8
-};
-
-JobSubsystem SubsystemFromChar(char c) noexcept;
-
-enum JobFlags {
-	jobForceQueue = 1,
-	jobHasInput = 2,
-	jobQuiet = 4,
-	// 8 reserved for jobVeryQuiet
-	jobRepSelMask = 48,
-	jobRepSelYes = 16,
-	jobRepSelAuto = 32,
-	jobGroupUndo = 64,
-	jobLowPriority = 128
-};
-
-struct JobMode {
-	JobSubsystem jobType;
-	int saveBefore;
-	bool isFilter;
-	int flags;
-	std::string input;
-	JobMode(const PropSetFile &props, int item, std::string_view fileNameExt);
-};
-
-class Job {
-public:
-	std::string command;
-	FilePath directory;
-	JobSubsystem jobType;
-	std::string input;
-	int flags;
-
-	Job() noexcept;
-	Job(std::string_view command_, FilePath directory_, JobSubsystem jobType_, std::string_view input_, int flags_);
-	void Clear() noexcept;
-};
-
-class JobQueue {
-	std::atomic_bool cancelFlag;
-public:
-	std::mutex mutex;
-	std::atomic_bool clearBeforeExecute;
-	std::atomic_bool isBuilding;
-	std::atomic_bool isBuilt;
-	std::atomic_bool executing;
-	static constexpr size_t commandMax = 2;
-	std::atomic_size_t commandCurrent;
-	std::vector<Job> jobQueue;
-	std::atomic_bool jobUsesOutputPane;
-	std::atomic_bool timeCommands;
-
-	JobQueue();
-	// Deleted so JobQueue objects can not be copied.
-	JobQueue(const JobQueue &) = delete;
-	JobQueue(JobQueue &&) = delete;
-	JobQueue &operator=(const JobQueue &) = delete;
-	JobQueue &operator=(JobQueue &&) = delete;
-	~JobQueue();
-	bool TimeCommands() const noexcept;
-	bool ClearBeforeExecute() const noexcept;
-	bool ShowOutputPane() const noexcept;
-	bool IsExecuting() const noexcept;
-	void SetExecuting(bool state) noexcept;
-	bool HasCommandToRun() const noexcept;
-	bool SetCancelFlag(bool value);
-	bool Cancelled() noexcept;
-
-	void ClearJobs() noexcept;
-	void AddCommand(std::string_view command, const FilePath &directory, JobSubsystem jobType, std::string_view input, int flags);
-};
-
-#endif
+// SciTE - Scintilla based Text Editor
+/** @file JobQueue.h
+ ** Define job queue
+ **/
+// SciTE & Scintilla copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
+// Copyright 2007 by Neil Hodgson <neilh@scintilla.org>, from April White <april_white@sympatico.ca>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+// TODO: see http://www.codeproject.com/threads/cppsyncstm.asp
+
+#ifndef JOBQUEUE_H
+#define JOBQUEUE_H
+
+enum class JobSubsystem {
+	cli = 0, gui = 1, shell = 2, extension = 3, help = 4, otherHelp = 5, grep = 6, immediate = 7, commandlist = 8
+};
+
+JobSubsystem SubsystemFromChar(char c) noexcept;
+
+enum JobFlags {
+	jobForceQueue = 1,
+	jobHasInput = 2,
+	jobQuiet = 4,
+	// 8 reserved for jobVeryQuiet
+	jobRepSelMask = 48,
+	jobRepSelYes = 16,
+	jobRepSelAuto = 32,
+	jobGroupUndo = 64,
+	jobLowPriority = 128,
+	jobParallel = 256
+};
+
+// Tool output is gathered and appended to the output pane in batches as each append
+// restyles and scrolls the pane. A batch is appended once it reaches this size or age in seconds.
+constexpr size_t outputBatchSize = 256 * 1024;
+constexpr double outputBatchDuration = 0.1;
+
+// Output of a job that runs at the same time as other jobs is shown a whole line at a time
+// with a prefix identifying the job so that lines from different jobs are not mixed together.
+// Without a job number, output passes through unchanged.
+class JobOutput {
+	std::string prefix;
+	std::string partial;
+public:
+	JobOutput() noexcept;
+	explicit JobOutput(size_t job);
+	[[nodiscard]] bool Prefixed() const noexcept;
+	[[nodiscard]] const std::string &Prefix() const noexcept;
+	[[nodiscard]] std::string Message(std::string_view text) const;
+	[[nodiscard]] std::string Lines(std::string_view text);
+	[[nodiscard]] std::string Finish();
+};
+
+// Returns text without a job prefix "[<number>] " if it starts with one.
+std::string_view RemoveJobPrefix(std::string_view text) noexcept;
+
+struct JobMode {
+	JobSubsystem jobType;
+	int saveBefore;
+	bool isFilter;
+	int flags;
+	std::string input;
+	JobMode(const PropSetFile &props, int item, std::string_view fileNameExt);
+};
+
+class Job {
+public:
+	std::string command;
+	FilePath directory;
+	JobSubsystem jobType;
+	std::string input;
+	int flags;
+
+	Job() noexcept;
+	Job(std::string_view command_, FilePath directory_, JobSubsystem jobType_, std::string_view input_, int flags_);
+	void Clear() noexcept;
+};
+
+class JobQueue {
+	std::atomic_bool cancelFlag;
+public:
+	std::mutex mutex;
+	std::atomic_bool clearBeforeExecute;
+	std::atomic_bool isBuilding;
+	std::atomic_bool isBuilt;
+	std::atomic_bool executing;
+	static constexpr size_t commandMax = 16;
+	std::atomic_size_t commandCurrent;
+	std::vector<Job> jobQueue;
+	std::atomic_bool jobUsesOutputPane;
+	std::atomic_bool timeCommands;
+	std::atomic_size_t parallelMax;
+
+	JobQueue();
+	// Deleted so JobQueue objects can not be copied.
+	JobQueue(const JobQueue &) = delete;
+	JobQueue(JobQueue &&) = delete;
+	JobQueue &operator=(const JobQueue &) = delete;
+	JobQueue &operator=(JobQueue &&) = delete;
+	~JobQueue();
+	bool TimeCommands() const noexcept;
+	bool ClearBeforeExecute() const noexcept;
+	bool ShowOutputPane() const noexcept;
+	bool IsExecuting() const noexcept;
+	void SetExecuting(bool state) noexcept;
+	bool HasCommandToRun() const noexcept;
+	size_t GroupEnd(size_t start) const noexcept;
+	bool SetCancelFlag(bool value);
+	bool Cancelled() noexcept;
+
+	void ClearJobs() noexcept;
+	void AddCommand(std::string_view command, const FilePath &directory, JobSubsystem jobType, std::string_view input, int flags);
+};
+
+#endif
@@ -1,641 +1,1431 @@
-// SciTE - Scintilla based Text Editor
-/** @file PropSetFile.cxx
- ** Property set implementation.
- **/
-// Copyright 1998-2007 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#include <cstddef>
-#include <cstdlib>
-#include <cassert>
-#include <cstring>
-#include <cstdio>
-#include <ctime>
-
-#include <stdexcept>
-#include <compare>
-#include <tuple>
-#include <string>
-#include <string_view>
-#include <vector>
-#include <map>
-#include <set>
-#include <optional>
-#include <algorithm>
-#include <memory>
-#include <chrono>
-#include <sstream>
-
-#include <fcntl.h>
-
-#if defined(GTK)
-
-#include <unistd.h>
-
-#endif
-
-#include "GUI.h"
-
-#include "StringHelpers.h"
-#include "FilePath.h"
-#include "PathMatch.h"
-#include "PropSetFile.h"
-#include "EditorConfig.h"
-
-// The comparison and case changing functions here assume ASCII
-// or extended ASCII such as the normal Windows code page.
-
-void ImportFilter::SetFilter(const std::string &sExcludes, const std::string &sIncludes) {
-	excludes = SetFromString(sExcludes, ' ');
-	includes = SetFromString(sIncludes, ' ');
-}
-
-bool ImportFilter::IsValid(const std::string &name) const {
-	if (!includes.empty()) {
-		return includes.contains(name);
-	}
-	return !excludes.contains(name);
-}
-
-bool PropSetFile::caseSensitiveFilenames = false;
-
-PropSetFile::PropSetFile(bool lowerKeys_) : lowerKeys(lowerKeys_), superPS(nullptr) {
-}
-
-void PropSetFile::Set(std::string_view key, std::string_view val) {
-	if (key.empty())	// Empty keys are not supported
-		return;
-	props[std::string(key)] = std::string(val);
-}
-
-void PropSetFile::SetPath(std::string_view key, const FilePath &path) {
-	Set(key, path.AsUTF8());
-}
-
-void PropSetFile::SetLine(const char *keyVal, bool unescape) {
-	while (IsASpace(*keyVal))
-		keyVal++;
-	const char *endVal = keyVal;
-	while (*endVal && (*endVal != '\n'))
-		endVal++;
-	const char *eqAt = strchr(keyVal, '=');
-	if (eqAt) {
-		const char *pKeyEnd = eqAt - 1;
-		while ((pKeyEnd >= keyVal) && IsASpace(*pKeyEnd)) {
-			--pKeyEnd;
-		}
-		const ptrdiff_t lenVal = endVal - eqAt - 1;
-		const ptrdiff_t lenKey = pKeyEnd - keyVal + 1;
-		const std::string_view key(keyVal, lenKey);
-		const std::string_view value(eqAt + 1, lenVal);
-		if (unescape && (key.find("\\") != std::string_view::npos)) {
-			const std::string keyUnescaped = UnicodeUnEscape(key);
-			Set(keyUnescaped, value);
-		} else {
-			Set(key, value);
-		}
-	} else if (*keyVal) {	// No '=' so assume '=1'
-		Set(keyVal, "1");
-	}
-}
-
-void PropSetFile::Unset(std::string_view key) {
-	if (key.empty())	// Empty keys are not supported
-		return;
-	const mapss::iterator keyPos = props.find(key);
-	if (keyPos != props.end())
-		props.erase(keyPos);
-}
-
-void PropSetFile::Clear() noexcept {
-	props.clear();
-}
-
-bool PropSetFile::Exists(std::string_view key) const {
-	const mapss::const_iterator keyPos = props.find(key);
-	if (keyPos != props.end()) {
-		return true;
-	}
-	if (superPS) {
-		// Failed here, so try in base property set
-		return superPS->Exists(key);
-	}
-	return false;
-}
-
-std::string_view PropSetFile::Get(std::string_view key) const {
-	const PropSetFile *psf = this;
-	while (psf) {
-		const mapss::const_iterator keyPos = psf->props.find(key);
-		if (keyPos != psf->props.end()) {
-			return keyPos->second;
-		}
-		// Failed here, so try in base property set
-		psf = psf->superPS;
-	}
-	return "";
-}
-
-std::string PropSetFile::GetString(std::string_view key) const {
-	return std::string(Get(key));
-}
-
-namespace {
-
-void ShellEscape(std::string &str) {
-	for (ptrdiff_t i = str.length() - 1; i >= 0; --i) {
-		switch (str[i]) {
-		case ' ':
-		case '|':
-		case '&':
-		case ',':
-		case '`':
-		case '"':
-		case ';':
-		case ':':
-		case '!':
-		case '^':
-		case '$':
-		case '{':
-		case '}':
-		case '(':
-		case ')':
-		case '[':
-		case ']':
-		case '=':
-		case '<':
-		case '>':
-		case '\\':
-		case '\'':
-			str.insert(i, "\\");
-			break;
-		default:
-			break;
-		}
-	}
-}
-
-using OptArgument = std::optional<std::string_view>;
-
-OptArgument MatchCommand(std::string_view key, std::string_view command) {
-	if (key.starts_with(command)) {
-		return key.substr(command.length());
-	}
-	return {};
-}
-
-}
-
-std::string PropSetFile::Evaluate(std::string_view key) const {
-	if (key.find(' ') != std::string_view::npos) {
-		if (OptArgument argEscape = MatchCommand(key, "escape ")) {
-			std::string val(Get(argEscape.value()));
-			ShellEscape(val);
-			return val;
-		} else if (OptArgument argCompare = MatchCommand(key, "= ")) {
-			const std::string sExpressions(argCompare.value());
-			std::vector<std::string> parts = StringSplit(sExpressions, ';');
-			if (parts.size() > 1) {
-				bool equal = true;
-				for (size_t part = 1; part < parts.size(); part++) {
-					if (parts[part] != parts[0]) {
-						equal = false;
-					}
-				}
-				return equal ? "1" : "0";
-			}
-		} else if (OptArgument argStar = MatchCommand(key, "star ")) {
-			const std::string sKeybase(argStar.value());
-			// Create set of variables with values
-			mapss values;
-			// For this property set and all base sets
-			for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
-				mapss::const_iterator it = psf->props.lower_bound(sKeybase);
-				while ((it != psf->props.end()) && (it->first.starts_with(sKeybase))) {
-					const mapss::iterator itDestination = values.find(it->first);
-					if (itDestination == values.end()) {
-						// Not present so add
-						values[it->first] = it->second;
-					}
-					++it;
-				}
-			}
-			// Concatenate all variables
-			std::string combination;
-			for (mapss::const_iterator itV = values.begin(); itV != values.end(); ++itV) {
-				combination += itV->second;
-			}
-			return combination;
-		} else if (OptArgument argScale = MatchCommand(key, "scale ")) {
-			constexpr int divisor = 100;
-			const int scaleFactor = GetInt("ScaleFactor", divisor);
-			std::string val(argScale.value());
-			if (scaleFactor == divisor) {
-				return val;
-			}
-			const int value = IntegerFromString(val, 1);
-			return StdStringFromInteger(value * scaleFactor / divisor);
-		}
-	} else {
-		return std::string(Get(key));
-	}
-	return "";
-}
-
-namespace {
-
-constexpr int maxIterations = 200;
-
-// There is some inconsistency between GetExpanded("foo") and Expand("$(foo)").
-// A solution is to keep a stack of variables that have been expanded, so that
-// recursive expansions can be skipped.  For now I'll just use the C++ stack
-// for that, through a recursive function and a simple chain of pointers.
-
-struct VarChain {
-	VarChain() = default;
-	explicit VarChain(std::string_view var_, const VarChain *link_ = nullptr) noexcept : var(var_), link(link_) {}
-
-	[[nodiscard]] bool contains(std::string_view testVar) const {
-		return (var == testVar)
-			|| (link && link->contains(testVar));
-	}
-
-	const std::string_view var;
-	const VarChain *link = nullptr;
-};
-
-int ExpandAllInPlace(const PropSetFile &props, std::string &withVars, int maxExpands, const VarChain &blankVars = VarChain()) {
-	size_t varStart = withVars.find("$(");
-	while ((varStart != std::string::npos) && (maxExpands > 0)) {
-		const size_t varEnd = withVars.find(')', varStart + 2);
-		if (varEnd == std::string::npos) {
-			break;
-		}
-
-		// For consistency, when we see '$(ab$(cde))', expand the inner variable first,
-		// regardless whether there is actually a degenerate variable named 'ab$(cde'.
-		size_t innerVarStart = withVars.find("$(", varStart + 2);
-		while ((innerVarStart != std::string::npos) && (innerVarStart < varEnd)) {
-			varStart = innerVarStart;
-			innerVarStart = withVars.find("$(", varStart + 2);
-		}
-
-		std::string var(withVars, varStart + 2, varEnd - (varStart + 2));
-		std::string val;
-		try {
-			val = props.Evaluate(var);
-		} catch (std::bad_optional_access &) {
-			// This can't actually happen but Coverity thinks it can.
-		}
-
-		if (blankVars.contains(var)) {
-			val.clear(); // treat blankVar as an empty string (e.g. to block self-reference)
-		}
-
-		if (--maxExpands >= 0) {
-			maxExpands = ExpandAllInPlace(props, val, maxExpands, VarChain(var, &blankVars));
-		}
-
-		withVars.erase(varStart, varEnd - varStart + 1);
-		withVars.insert(varStart, val);
-
-		varStart = withVars.find("$(");
-	}
-
-	return maxExpands;
-}
-
-}
-
-std::string PropSetFile::GetExpandedString(std::string_view key) const {
-	std::string val(Get(key));
-	ExpandAllInPlace(*this, val, maxIterations, VarChain(key));
-	return val;
-}
-
-std::string PropSetFile::Expand(std::string_view withVars, int maxExpands) const {
-	std::string val(withVars);
-	ExpandAllInPlace(*this, val, maxExpands);
-	return val;
-}
-
-int PropSetFile::GetInt(std::string_view key, int defaultValue) const {
-	return IntegerFromString(GetExpandedString(key), defaultValue);
-}
-
-intptr_t PropSetFile::GetInteger(std::string_view key, intptr_t defaultValue) const {
-	return IntPtrFromString(GetExpandedString(key), defaultValue);
-}
-
-long long PropSetFile::GetLongLong(std::string_view key, long long defaultValue) const {
-	return LongLongFromString(GetExpandedString(key), defaultValue);
-}
-
-namespace {
-
-/**
- * Get a line of input. If end of line escaped with '\\' then continue reading.
- */
-void GetFullLine(std::string_view &data, std::string &lineBuffer) {
-	lineBuffer.clear();
-	while (!data.empty()) {
-		const char ch = data[0];
-		data.remove_prefix(1);
-		if ((ch == '\r') || (ch == '\n')) {
-			if ((ch == '\r') && data.starts_with('\n')) {
-				// munch the second half of a crlf
-				data.remove_prefix(1);
-			}
-			return;
-		} else if ((ch == '\\') && !data.empty() && ((data[0] == '\r') || (data[0] == '\n'))) {
-			const char next = data[0];
-			data.remove_prefix(1);
-			if ((next == '\r') && data.starts_with('\n')) {
-				data.remove_prefix(1);
-			}
-		} else {
-			lineBuffer.push_back(ch);
-		}
-	}
-}
-
-bool IsCommentLine(std::string_view line) noexcept {
-	while (!line.empty() && IsSpaceOrTab(line.front()))
-		line.remove_prefix(1);
-	return line.starts_with('#');
-}
-
-bool GenericPropertiesFile(const FilePath &filename) {
-	std::string name = filename.BaseName().AsUTF8();
-	if (name == "abbrev" || name == "Embedded")
-		return true;
-	return name.find("SciTE") != std::string::npos;
-}
-
-constexpr int maxDepthImport = 20;
-
-}
-
-void PropSetFile::Import(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
-			 FilePathSet *imports, size_t depth) {
-	if (depth > maxDepthImport)	// Possibly recursive import so give up to avoid crash
-		return;
-	if (Read(filename, directoryForImports, filter, imports, depth)) {
-		if (imports && (std::ranges::find(*imports, filename) == imports->end())) {
-			imports->push_back(filename);
-		}
-	}
-}
-
-PropSetFile::ReadLineState PropSetFile::ReadLine(const std::string &lineBuffer, ReadLineState rls, const FilePath &directoryForImports,
-		const ImportFilter &filter, FilePathSet *imports, size_t depth) {
-	if (lineBuffer.empty()) {
-		return rls;
-	}
-	if ((rls == ReadLineState::conditionFalse) && (!IsSpaceOrTab(lineBuffer[0])))    // If clause ends with first non-indented line
-		rls = ReadLineState::active;
-	if (lineBuffer.starts_with("module ")) {
-		std::string moduleName = lineBuffer.substr(strlen("module") + 1);
-		if (moduleName.empty() || filter.IsValid(moduleName)) {
-			rls = ReadLineState::active;
-		} else {
-			rls = ReadLineState::excludedModule;
-		}
-		return rls;
-	}
-	if (rls != ReadLineState::active) {
-		return rls;
-	}
-	if (lineBuffer.starts_with("if ")) {
-		std::string_view expr = lineBuffer;
-		expr.remove_prefix(strlen("if") + 1);
-		std::string value = Expand(expr);
-		if (value == "0" || value.empty()) {
-			rls = ReadLineState::conditionFalse;
-		} else if (value == "1") {
-			rls = ReadLineState::active;
-		} else {
-			rls = (GetInt(value) != 0) ? ReadLineState::active : ReadLineState::conditionFalse;
-		}
-	} else if (superPS && lineBuffer.starts_with("match ")) {
-		// Don't match on stand-alone property sets like localiser
-		const std::string pattern = lineBuffer.substr(strlen("match") + 1);
-		const std::string relPath(Get("RelativePath"));
-		const bool matches = PathMatch(pattern, relPath);
-		rls = matches ? ReadLineState::active : ReadLineState::conditionFalse;
-	} else if (lineBuffer.starts_with("import ")) {
-		if (directoryForImports.IsSet()) {
-			std::string importName = lineBuffer.substr(strlen("import") + 1);
-			if (importName == "*") {
-				// Import all .properties files in this directory except for system properties
-				FilePathSet directories;
-				FilePathSet files;
-				directoryForImports.List(directories, files);
-				for (const FilePath &fpFile : files) {
-					if (IsPropertiesFile(fpFile) &&
-							!GenericPropertiesFile(fpFile) &&
-							filter.IsValid(fpFile.BaseName().AsUTF8())) {
-						FilePath importPath(directoryForImports, fpFile);
-						Import(importPath, directoryForImports, filter, imports, depth + 1);
-					}
-				}
-			} else if (filter.IsValid(importName)) {
-				importName += ".properties";
-				FilePath importPath(directoryForImports, FilePath(GUI::StringFromUTF8(importName)));
-				Import(importPath, directoryForImports, filter, imports, depth + 1);
-			}
-		}
-	} else if (!IsCommentLine(lineBuffer)) {
-		SetLine(lineBuffer.c_str(), true);
-	}
-	return rls;
-}
-
-void PropSetFile::ReadFromMemory(std::string_view data, const FilePath &directoryForImports,
-				 const ImportFilter &filter, FilePathSet *imports, size_t depth) {
-	std::string lineBuffer;
-	ReadLineState rls = ReadLineState::active;
-	while (!data.empty()) {
-		GetFullLine(data, lineBuffer);
-		if (lowerKeys) {
-			for (char &ch : lineBuffer) {
-				if (ch == '=')
-					break;
-				ch = MakeLowerCase(ch);
-			}
-		}
-		rls = ReadLine(lineBuffer, rls, directoryForImports, filter, imports, depth);
-	}
-}
-
-bool PropSetFile::Read(const FilePath &filename, const FilePath &directoryForImports,
-		       const ImportFilter &filter, FilePathSet *imports, size_t depth) {
-	const std::string propsData = filename.Read();
-	if (!propsData.empty()) {
-		std::string_view data(propsData);
-		const std::string_view svUtf8BOM(UTF8BOM);
-		if (data.starts_with(svUtf8BOM)) {
-			data.remove_prefix(svUtf8BOM.length());
-		}
-		ReadFromMemory(data, directoryForImports, filter, imports, depth);
-		return true;
-	}
-	return false;
-}
-
-namespace {
-
-bool StringEqual(std::string_view a, std::string_view b, bool caseSensitive) noexcept {
-	if (caseSensitive) {
-		return a == b;
-	}
-	return EqualCaseInsensitive(a, b);
-}
-
-// Match file names to patterns allowing for '*' and '?'.
-
-bool MatchWild(std::string_view pattern, std::string_view text, bool caseSensitive) {
-	if (StringEqual(pattern, text, caseSensitive)) {
-		return true;
-	} else if (pattern.empty()) {
-		return false;
-	} else if (pattern.front() == '*') {
-		pattern.remove_prefix(1);
-		if (pattern.empty()) {
-			return true;
-		}
-		while (!text.empty()) {
-			if (MatchWild(pattern, text, caseSensitive)) {
-				return true;
-			}
-			text.remove_prefix(1);
-		}
-	} else if (text.empty()) {
-		return false;
-	} else if (pattern.front() == '?') {
-		pattern.remove_prefix(1);
-		text.remove_prefix(1);
-		return MatchWild(pattern, text, caseSensitive);
-	} else if (caseSensitive && pattern.front() == text.front()) {
-		pattern.remove_prefix(1);
-		text.remove_prefix(1);
-		return MatchWild(pattern, text, caseSensitive);
-	} else if (!caseSensitive && MakeUpperCase(pattern.front()) == MakeUpperCase(text.front())) {
-		pattern.remove_prefix(1);
-		text.remove_prefix(1);
-		return MatchWild(pattern, text, caseSensitive);
-	}
-	return false;
-}
-
-bool MatchWildSet(std::string_view patternSet, std::string_view text, bool caseSensitive) {
-	while (!patternSet.empty()) {
-		const size_t sepPos = patternSet.find_first_of(';');
-		const std::string_view pattern = patternSet.substr(0, sepPos);
-		if (MatchWild(pattern, text, caseSensitive)) {
-			return true;
-		}
-		// Move to next
-		patternSet = (sepPos == std::string_view::npos) ? "" : patternSet.substr(sepPos + 1);
-	}
-	return false;
-}
-
-}
-
-std::string_view PropSetFile::GetWildUsingStart(const PropSetFile &psStart, std::string_view keybase, std::string_view filename) const {
-	const PropSetFile *psf = this;
-	while (psf) {
-		mapss::const_iterator it = psf->props.lower_bound(keybase);
-		while ((it != psf->props.end()) && it->first.starts_with(keybase)) {
-			if (it->first == keybase) {
-				return it->second;
-			}
-			const std::string_view first = it->first;
-			const std::string_view orgkeyfile = first.substr(keybase.length());
-			std::string key;	// keyFile may point into key so key lifetime must cover keyFile
-			std::string_view keyFile = orgkeyfile;
-
-			if (orgkeyfile.starts_with("$(")) {
-				// $(X) is a variable so extract X and find its value
-				const size_t endVar = orgkeyfile.find_first_of(')');
-				if (endVar != std::string_view::npos) {
-					const std::string_view var = orgkeyfile.substr(2, endVar-2);
-					key = psStart.GetExpandedString(var);
-					keyFile = key;
-				}
-			}
-
-			if (MatchWildSet(keyFile, filename, caseSensitiveFilenames)) {
-				return it->second;
-			}
-
-			++it;
-		}
-		// Failed here, so try in base property set
-		psf = psf->superPS;
-	}
-	return "";
-}
-
-std::string_view PropSetFile::GetWild(std::string_view keybase, std::string_view filename) const {
-	return GetWildUsingStart(*this, keybase, filename);
-}
-
-// GetNewExpandString does not use Expand as it has to use GetWild with the filename for each
-// variable reference found.
-
-std::string PropSetFile::GetNewExpandString(std::string_view keybase, std::string_view filename) const {
-	std::string withVars(GetWild(keybase, filename));
-	size_t varStart = withVars.find("$(");
-	int maxExpands = maxIterations;	// Avoid infinite expansion of recursive definitions
-	while ((varStart != std::string::npos) && (maxExpands > 0)) {
-		const size_t varEnd = withVars.find(')', varStart+2);
-		if (varEnd == std::string::npos) {
-			break;
-		}
-		const std::string_view var = std::string_view(withVars).substr(
-			varStart + 2, varEnd - varStart - 2);	// Subtract the $(
-		std::string val;
-		if (var != keybase)	// Self-references evaluate to empty string
-			val = GetWild(var, filename);
-		withVars.replace(varStart, varEnd - varStart + 1, val);
-		varStart = withVars.find("$(");
-		maxExpands--;
-	}
-	return withVars;
-}
-
-/**
- * Initiate enumeration.
- */
-bool PropSetFile::GetFirst(const char *&key, const char *&val) const {
-	const mapss::const_iterator it = props.begin();
-	if (it != props.end()) {
-		key = it->first.c_str();
-		val = it->second.c_str();
-		return true;
-	}
-	return false;
-}
-
-/**
- * Continue enumeration.
- */
-bool PropSetFile::GetNext(const char *&key, const char *&val) const {
-	mapss::const_iterator it = props.find(key);
-	if (it != props.end()) {
-		++it;
-		if (it != props.end()) {
-			key = it->first.c_str();
-			val = it->second.c_str();
-			return true;
-		}
-	}
-	return false;
-}
-
-bool IsPropertiesFile(const FilePath &filename) {
-	const FilePath ext = filename.Extension();
-	return EqualCaseInsensitive(ext.AsUTF8(), extensionProperties + 1);
-}
+// SciTE - Scintilla based Text Editor
+/** @file PropSetFile.cxx
+ ** Property set implementation.
+ **/
+// Copyright 1998-2007 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cassert>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+
+#include <stdexcept>
+#include <compare>
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <sstream>
+
+#include <fcntl.h>
+
+#if defined(GTK)
+
+#include <unistd.h>
+
+#endif
+
+#include "GUI.h"
+
+#include "StringHelpers.h"
+#include "FilePath.h"
+#include "PathMatch.h"
+#include "PropSetFile.h"
+#include "EditorConfig.h"
+
+// The comparison and case changing functions here assume ASCII
+// or extended ASCII such as the normal Windows code page.
+
+void ImportFilter::SetFilter(const std::string &sExcludes, const std::string &sIncludes) {
+	excludes = SetFromString(sExcludes, ' ');
+	includes = SetFromString(sIncludes, ' ');
+}
+
+bool ImportFilter::IsValid(const std::string &name) const {
+	if (!includes.empty()) {
+		return includes.contains(name);
+	}
+	return !excludes.contains(name);
+}
+
+bool PropSetFile::caseSensitiveFilenames = false;
+
+namespace {
+
+// Keys that GetWild can find contain '.' like "lexer.*.cxx" or "keywords.$(file.patterns.cpp)".
+// Keys without '.' like FilePath and Language are set whenever the current file changes so
+// changing them does not discard the wildcard cache and results that depend on them are not cached.
+// Any other change may alter or remove a value that a cached result refers to.
+bool WildCacheable(std::string_view key) noexcept {
+	return key.find('.') != std::string_view::npos;
+}
+
+// Results are kept for this many files before being discarded so names looked up once, such as
+// while searching in files, do not accumulate.
+constexpr size_t maxCachedFiles = 100;
+
+struct FilePattern {
+	// The forms '*.ext' and names without wildcards are much more common than other patterns
+	// and can be matched directly.
+	enum class Kind { exact, suffix, all, wild } kind;
+	std::string text;	// For suffix, the text after the '*'
+};
+
+using FilePatterns = std::vector<FilePattern>;
+
+FilePatterns CompilePatternSet(std::string_view patternSet);
+bool MatchPatterns(const FilePatterns &patterns, std::string_view text, bool caseSensitive);
+
+}
+
+struct PropSetFile::WildCache {
+	size_t generation = 0;
+	bool caseSensitive = false;
+	// Patterns compiled from the remainder of keys after the keybase like "*.cxx;*.h" or "$(file.patterns.cpp)"
+	std::map<std::string, FilePatterns, std::less<>> patterns;
+	// File name -> keybase -> value
+	std::map<std::string, std::map<std::string, std::string_view, std::less<>>, std::less<>> results;
+};
+
+namespace {
+
+struct SourceFile {
+	std::string path;
+	long long modified = 0;
+	long long length = 0;
+	unsigned long long hash = 0;
+};
+
+// 64-bit FNV-1a hash of file contents to catch changes that keep the modification time and length
+constexpr unsigned long long ContentHash(std::string_view text) noexcept {
+	unsigned long long hash = 0xcbf29ce484222325ULL;
+	for (const char ch : text) {
+		hash ^= static_cast<unsigned char>(ch);
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// Modification times only have a resolution of a second, or 2 seconds on FAT, so a file modified
+// within this many seconds of being read may change again without its time changing.
+constexpr long long racySeconds = 2;
+
+}
+
+struct PropSetFile::ReadRecord {
+	// Identify the read
+	std::string filename;
+	std::string directory;
+	std::string filter;
+	bool lowerKeys = false;
+	// When the files were read
+	long long recorded = 0;
+	// Files read including those that were missing or empty
+	std::vector<SourceFile> files;
+	// Directories listed by 'import *' and the names of the properties files found
+	std::vector<std::pair<std::string, std::string>> directories;
+	// Variables evaluated by 'if' and 'match' while reading
+	std::vector<std::string> variables;
+	// Values of those variables in the base property sets
+	std::map<std::string, std::string> dependencies;
+	std::vector<std::string> imports;
+};
+
+struct PropSetFile::LazyImport {
+	FilePath path;
+	FilePath directoryForImports;
+	ImportFilter filter;
+	// Values of lexer.* keys in the file and the file patterns in those keys
+	std::set<std::string, std::less<>> lexers;
+	std::vector<std::string> patterns;
+	// The patterns expanded and compiled when indexed so ImportLazy only has to match them
+	FilePatterns filePatterns;
+	// Other lazy imports that define variables used by this file
+	std::vector<size_t> dependencies;
+	bool imported = false;
+};
+
+PropSetFile::PropSetFile(bool lowerKeys_) : lowerKeys(lowerKeys_), generation(0), recording(false), conditionVariables(nullptr), superPS(nullptr) {
+}
+
+PropSetFile::PropSetFile(const PropSetFile &other) :
+	lowerKeys(other.lowerKeys), generation(0), recording(false), lazyImports(other.lazyImports),
+	conditionVariables(nullptr), props(other.props),
+	superPS(other.superPS) {
+}
+
+PropSetFile::PropSetFile(PropSetFile &&) noexcept = default;
+
+PropSetFile &PropSetFile::operator=(const PropSetFile &other) {
+	if (this != &other) {
+		lowerKeys = other.lowerKeys;
+		props = other.props;
+		lazyImports = other.lazyImports;
+		superPS = other.superPS;
+		wildCache.reset();
+		readRecord.reset();
+		recording = false;
+		generation++;
+	}
+	return *this;
+}
+
+PropSetFile &PropSetFile::operator=(PropSetFile &&other) noexcept {
+	if (this != &other) {
+		lowerKeys = other.lowerKeys;
+		props = std::move(other.props);
+		lazyImports = std::move(other.lazyImports);
+		superPS = other.superPS;
+		wildCache.reset();
+		readRecord.reset();
+		recording = false;
+		generation++;
+	}
+	return *this;
+}
+
+PropSetFile::~PropSetFile() = default;
+
+size_t PropSetFile::ChainGeneration() const noexcept {
+	// Generations only increase so the sum changes when any property set in the chain changes
+	size_t sum = 0;
+	for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
+		sum += psf->generation;
+	}
+	return sum;
+}
+
+void PropSetFile::Changed(std::string_view key) noexcept {
+	if (WildCacheable(key)) {
+		generation++;
+	}
+}
+
+void PropSetFile::Set(std::string_view key, std::string_view val) {
+	if (key.empty())	// Empty keys are not supported
+		return;
+	const mapss::iterator keyPos = props.lower_bound(key);
+	if ((keyPos != props.end()) && (keyPos->first == key)) {
+		if (keyPos->second == val) {
+			// Unchanged so cached wildcard results remain valid
+			return;
+		}
+		keyPos->second = val;
+	} else {
+		props.emplace_hint(keyPos, key, val);
+	}
+	Changed(key);
+}
+
+void PropSetFile::SetPath(std::string_view key, const FilePath &path) {
+	Set(key, path.AsUTF8());
+}
+
+void PropSetFile::SetLine(const char *keyVal, bool unescape) {
+	while (IsASpace(*keyVal))
+		keyVal++;
+	const char *endVal = keyVal;
+	while (*endVal && (*endVal != '\n'))
+		endVal++;
+	const char *eqAt = strchr(keyVal, '=');
+	if (eqAt) {
+		const char *pKeyEnd = eqAt - 1;
+		while ((pKeyEnd >= keyVal) && IsASpace(*pKeyEnd)) {
+			--pKeyEnd;
+		}
+		const ptrdiff_t lenVal = endVal - eqAt - 1;
+		const ptrdiff_t lenKey = pKeyEnd - keyVal + 1;
+		const std::string_view key(keyVal, lenKey);
+		const std::string_view value(eqAt + 1, lenVal);
+		if (unescape && (key.find("\\") != std::string_view::npos)) {
+			const std::string keyUnescaped = UnicodeUnEscape(key);
+			Set(keyUnescaped, value);
+		} else {
+			Set(key, value);
+		}
+	} else if (*keyVal) {	// No '=' so assume '=1'
+		Set(keyVal, "1");
+	}
+}
+
+void PropSetFile::Unset(std::string_view key) {
+	if (key.empty())	// Empty keys are not supported
+		return;
+	const mapss::iterator keyPos = props.find(key);
+	if (keyPos != props.end()) {
+		props.erase(keyPos);
+		Changed(key);
+	}
+}
+
+void PropSetFile::Clear() noexcept {
+	if (std::ranges::any_of(props, [](const mapss::value_type &kv) noexcept { return WildCacheable(kv.first); })) {
+		generation++;
+	}
+	props.clear();
+	lazyImports.clear();
+	readRecord.reset();
+}
+
+bool PropSetFile::Exists(std::string_view key) const {
+	const mapss::const_iterator keyPos = props.find(key);
+	if (keyPos != props.end()) {
+		return true;
+	}
+	if (superPS) {
+		// Failed here, so try in base property set
+		return superPS->Exists(key);
+	}
+	return false;
+}
+
+std::string_view PropSetFile::Get(std::string_view key) const {
+	const PropSetFile *psf = this;
+	while (psf) {
+		const mapss::const_iterator keyPos = psf->props.find(key);
+		if (keyPos != psf->props.end()) {
+			return keyPos->second;
+		}
+		// Failed here, so try in base property set
+		psf = psf->superPS;
+	}
+	return "";
+}
+
+std::string PropSetFile::GetString(std::string_view key) const {
+	return std::string(Get(key));
+}
+
+namespace {
+
+void ShellEscape(std::string &str) {
+	for (ptrdiff_t i = str.length() - 1; i >= 0; --i) {
+		switch (str[i]) {
+		case ' ':
+		case '|':
+		case '&':
+		case ',':
+		case '`':
+		case '"':
+		case ';':
+		case ':':
+		case '!':
+		case '^':
+		case '$':
+		case '{':
+		case '}':
+		case '(':
+		case ')':
+		case '[':
+		case ']':
+		case '=':
+		case '<':
+		case '>':
+		case '\\':
+		case '\'':
+			str.insert(i, "\\");
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+using OptArgument = std::optional<std::string_view>;
+
+OptArgument MatchCommand(std::string_view key, std::string_view command) {
+	if (key.starts_with(command)) {
+		return key.substr(command.length());
+	}
+	return {};
+}
+
+}
+
+std::string PropSetFile::Evaluate(std::string_view key) const {
+	if (key.find(' ') != std::string_view::npos) {
+		if (OptArgument argEscape = MatchCommand(key, "escape ")) {
+			std::string val(Get(argEscape.value()));
+			ShellEscape(val);
+			return val;
+		} else if (OptArgument argCompare = MatchCommand(key, "= ")) {
+			const std::string sExpressions(argCompare.value());
+			std::vector<std::string> parts = StringSplit(sExpressions, ';');
+			if (parts.size() > 1) {
+				bool equal = true;
+				for (size_t part = 1; part < parts.size(); part++) {
+					if (parts[part] != parts[0]) {
+						equal = false;
+					}
+				}
+				return equal ? "1" : "0";
+			}
+		} else if (OptArgument argStar = MatchCommand(key, "star ")) {
+			const std::string sKeybase(argStar.value());
+			// Create set of variables with values
+			mapss values;
+			// For this property set and all base sets
+			for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
+				mapss::const_iterator it = psf->props.lower_bound(sKeybase);
+				while ((it != psf->props.end()) && (it->first.starts_with(sKeybase))) {
+					const mapss::iterator itDestination = values.find(it->first);
+					if (itDestination == values.end()) {
+						// Not present so add
+						values[it->first] = it->second;
+					}
+					++it;
+				}
+			}
+			// Concatenate all variables
+			std::string combination;
+			for (mapss::const_iterator itV = values.begin(); itV != values.end(); ++itV) {
+				combination += itV->second;
+			}
+			return combination;
+		} else if (OptArgument argScale = MatchCommand(key, "scale ")) {
+			constexpr int divisor = 100;
+			const int scaleFactor = GetInt("ScaleFactor", divisor);
+			std::string val(argScale.value());
+			if (scaleFactor == divisor) {
+				return val;
+			}
+			const int value = IntegerFromString(val, 1);
+			return StdStringFromInteger(value * scaleFactor / divisor);
+		}
+	} else {
+		return std::string(Get(key));
+	}
+	return "";
+}
+
+namespace {
+
+constexpr int maxIterations = 200;
+
+// There is some inconsistency between GetExpanded("foo") and Expand("$(foo)").
+// A solution is to keep a stack of variables that have been expanded, so that
+// recursive expansions can be skipped.  For now I'll just use the C++ stack
+// for that, through a recursive function and a simple chain of pointers.
+
+struct VarChain {
+	VarChain() = default;
+	explicit VarChain(std::string_view var_, const VarChain *link_ = nullptr) noexcept : var(var_), link(link_) {}
+
+	[[nodiscard]] bool contains(std::string_view testVar) const {
+		return (var == testVar)
+			|| (link && link->contains(testVar));
+	}
+
+	const std::string_view var;
+	const VarChain *link = nullptr;
+};
+
+// When variables is set, each variable evaluated is appended to it.
+int ExpandAllInPlace(const PropSetFile &props, std::string &withVars, int maxExpands, const VarChain &blankVars = VarChain(),
+	std::vector<std::string> *variables = nullptr) {
+	size_t varStart = withVars.find("$(");
+	while ((varStart != std::string::npos) && (maxExpands > 0)) {
+		const size_t varEnd = withVars.find(')', varStart + 2);
+		if (varEnd == std::string::npos) {
+			break;
+		}
+
+		// For consistency, when we see '$(ab$(cde))', expand the inner variable first,
+		// regardless whether there is actually a degenerate variable named 'ab$(cde'.
+		size_t innerVarStart = withVars.find("$(", varStart + 2);
+		while ((innerVarStart != std::string::npos) && (innerVarStart < varEnd)) {
+			varStart = innerVarStart;
+			innerVarStart = withVars.find("$(", varStart + 2);
+		}
+
+		std::string var(withVars, varStart + 2, varEnd - (varStart + 2));
+		if (variables) {
+			variables->push_back(var);
+		}
+		std::string val;
+		try {
+			val = props.Evaluate(var);
+		} catch (std::bad_optional_access &) {
+			// This can't actually happen but Coverity thinks it can.
+		}
+
+		if (blankVars.contains(var)) {
+			val.clear(); // treat blankVar as an empty string (e.g. to block self-reference)
+		}
+
+		if (--maxExpands >= 0) {
+			maxExpands = ExpandAllInPlace(props, val, maxExpands, VarChain(var, &blankVars), variables);
+		}
+
+		withVars.erase(varStart, varEnd - varStart + 1);
+		withVars.insert(varStart, val);
+
+		varStart = withVars.find("$(");
+	}
+
+	return maxExpands;
+}
+
+}
+
+std::string PropSetFile::GetExpandedString(std::string_view key) const {
+	std::string val(Get(key));
+	ExpandAllInPlace(*this, val, maxIterations, VarChain(key));
+	return val;
+}
+
+std::string PropSetFile::Expand(std::string_view withVars, int maxExpands) const {
+	std::string val(withVars);
+	ExpandAllInPlace(*this, val, maxExpands);
+	return val;
+}
+
+int PropSetFile::GetInt(std::string_view key, int defaultValue) const {
+	return IntegerFromString(GetExpandedString(key), defaultValue);
+}
+
+intptr_t PropSetFile::GetInteger(std::string_view key, intptr_t defaultValue) const {
+	return IntPtrFromString(GetExpandedString(key), defaultValue);
+}
+
+long long PropSetFile::GetLongLong(std::string_view key, long long defaultValue) const {
+	return LongLongFromString(GetExpandedString(key), defaultValue);
+}
+
+namespace {
+
+/**
+ * Get a line of input. If end of line escaped with '\\' then continue reading.
+ */
+void GetFullLine(std::string_view &data, std::string &lineBuffer) {
+	lineBuffer.clear();
+	while (!data.empty()) {
+		const char ch = data[0];
+		data.remove_prefix(1);
+		if ((ch == '\r') || (ch == '\n')) {
+			if ((ch == '\r') && data.starts_with('\n')) {
+				// munch the second half of a crlf
+				data.remove_prefix(1);
+			}
+			return;
+		} else if ((ch == '\\') && !data.empty() && ((data[0] == '\r') || (data[0] == '\n'))) {
+			const char next = data[0];
+			data.remove_prefix(1);
+			if ((next == '\r') && data.starts_with('\n')) {
+				data.remove_prefix(1);
+			}
+		} else {
+			lineBuffer.push_back(ch);
+		}
+	}
+}
+
+bool IsCommentLine(std::string_view line) noexcept {
+	while (!line.empty() && IsSpaceOrTab(line.front()))
+		line.remove_prefix(1);
+	return line.starts_with('#');
+}
+
+// Sorted and joined names of properties files to detect files being added or removed.
+std::string PropertiesFileNames(const FilePathSet &files) {
+	std::vector<std::string> names;
+	for (const FilePath &fpFile : files) {
+		if (IsPropertiesFile(fpFile)) {
+			names.push_back(fpFile.Name().AsUTF8());
+		}
+	}
+	std::ranges::sort(names);
+	std::string joined;
+	for (const std::string &name : names) {
+		joined += name;
+		joined += '\n';
+	}
+	return joined;
+}
+
+bool GenericPropertiesFile(const FilePath &filename) {
+	std::string name = filename.BaseName().AsUTF8();
+	if (name == "abbrev" || name == "Embedded")
+		return true;
+	return name.find("SciTE") != std::string::npos;
+}
+
+constexpr int maxDepthImport = 20;
+
+}
+
+void PropSetFile::Import(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
+			 FilePathSet *imports, size_t depth) {
+	if (depth > maxDepthImport)	// Possibly recursive import so give up to avoid crash
+		return;
+	if (Read(filename, directoryForImports, filter, imports, depth)) {
+		if (imports && (std::ranges::find(*imports, filename) == imports->end())) {
+			imports->push_back(filename);
+		}
+	}
+}
+
+PropSetFile::ReadLineState PropSetFile::ReadLine(const std::string &lineBuffer, ReadLineState rls, const FilePath &directoryForImports,
+		const ImportFilter &filter, FilePathSet *imports, size_t depth) {
+	if (lineBuffer.empty()) {
+		return rls;
+	}
+	if ((rls == ReadLineState::conditionFalse) && (!IsSpaceOrTab(lineBuffer[0])))    // If clause ends with first non-indented line
+		rls = ReadLineState::active;
+	if (lineBuffer.starts_with("module ")) {
+		std::string moduleName = lineBuffer.substr(strlen("module") + 1);
+		if (moduleName.empty() || filter.IsValid(moduleName)) {
+			rls = ReadLineState::active;
+		} else {
+			rls = ReadLineState::excludedModule;
+		}
+		return rls;
+	}
+	if (rls != ReadLineState::active) {
+		return rls;
+	}
+	if (lineBuffer.starts_with("if ")) {
+		std::string_view expr = lineBuffer;
+		expr.remove_prefix(strlen("if") + 1);
+		std::vector<std::string> variables;
+		std::string value(expr);
+		ExpandAllInPlace(*this, value, maxIterations, VarChain(), &variables);
+		if (value == "0" || value.empty()) {
+			rls = ReadLineState::conditionFalse;
+		} else if (value == "1") {
+			rls = ReadLineState::active;
+		} else {
+			// Same as GetInt(value) but recording variables
+			variables.push_back(value);
+			std::string valueProperty(Get(value));
+			ExpandAllInPlace(*this, valueProperty, maxIterations, VarChain(value), &variables);
+			rls = (IntegerFromString(valueProperty, 0) != 0) ? ReadLineState::active : ReadLineState::conditionFalse;
+		}
+		if (recording) {
+			readRecord->variables.insert(readRecord->variables.end(), variables.begin(), variables.end());
+		}
+		if (conditionVariables) {
+			conditionVariables->insert(conditionVariables->end(), variables.begin(), variables.end());
+		}
+	} else if (superPS && lineBuffer.starts_with("match ")) {
+		// Don't match on stand-alone property sets like localiser
+		const std::string pattern = lineBuffer.substr(strlen("match") + 1);
+		if (recording) {
+			readRecord->variables.emplace_back("RelativePath");
+		}
+		const std::string relPath(Get("RelativePath"));
+		const bool matches = PathMatch(pattern, relPath);
+		rls = matches ? ReadLineState::active : ReadLineState::conditionFalse;
+	} else if (lineBuffer.starts_with("import ")) {
+		if (directoryForImports.IsSet()) {
+			std::string importName = lineBuffer.substr(strlen("import") + 1);
+			if (importName == "*") {
+				// Import all .properties files in this directory except for system properties
+				FilePathSet directories;
+				FilePathSet files;
+				directoryForImports.List(directories, files);
+				if (recording) {
+					readRecord->directories.emplace_back(directoryForImports.AsUTF8(), PropertiesFileNames(files));
+				}
+				FilePathSet lazyFiles;
+				for (const FilePath &fpFile : files) {
+					if (IsPropertiesFile(fpFile) &&
+							!GenericPropertiesFile(fpFile) &&
+							filter.IsValid(fpFile.BaseName().AsUTF8())) {
+						FilePath importPath(directoryForImports, fpFile);
+						if (filter.lazy) {
+							lazyFiles.push_back(importPath);
+						} else {
+							Import(importPath, directoryForImports, filter, imports, depth + 1);
+						}
+					}
+				}
+				if (!lazyFiles.empty()) {
+					IndexImports(lazyFiles, directoryForImports, filter, imports, depth + 1);
+				}
+			} else if (filter.IsValid(importName)) {
+				importName += ".properties";
+				FilePath importPath(directoryForImports, FilePath(GUI::StringFromUTF8(importName)));
+				Import(importPath, directoryForImports, filter, imports, depth + 1);
+			}
+		}
+	} else if (!IsCommentLine(lineBuffer)) {
+		SetLine(lineBuffer.c_str(), true);
+	}
+	return rls;
+}
+
+void PropSetFile::ReadFromMemory(std::string_view data, const FilePath &directoryForImports,
+				 const ImportFilter &filter, FilePathSet *imports, size_t depth) {
+	std::string lineBuffer;
+	ReadLineState rls = ReadLineState::active;
+	while (!data.empty()) {
+		GetFullLine(data, lineBuffer);
+		if (lowerKeys) {
+			for (char &ch : lineBuffer) {
+				if (ch == '=')
+					break;
+				ch = MakeLowerCase(ch);
+			}
+		}
+		rls = ReadLine(lineBuffer, rls, directoryForImports, filter, imports, depth);
+	}
+}
+
+namespace {
+
+// Keys kept when a file is indexed: the names, patterns, and filters gathered with
+// $(star ...) for the Language menu and file dialogs and the lexer.* keys that
+// decide when the file is imported.
+bool IndexKey(std::string_view key) noexcept {
+	return key.starts_with('*') || key.starts_with("file.patterns.") ||
+		key.starts_with("filter.") || key.starts_with("lexer.");
+}
+
+void AddVariableReferences(std::string_view text, std::set<std::string, std::less<>> &references) {
+	size_t start = text.find("$(");
+	while (start != std::string_view::npos) {
+		const size_t end = text.find(')', start + 2);
+		if (end == std::string_view::npos) {
+			return;
+		}
+		references.emplace(text.substr(start + 2, end - start - 2));
+		start = text.find("$(", end);
+	}
+}
+
+}
+
+// Read a file into another property set that uses this one for conditions while recording
+// the files and variables for the cache of this set.
+void PropSetFile::ReadSeparately(PropSetFile &separate, const FilePath &filename, const FilePath &directoryForImports,
+				 const ImportFilter &filter, FilePathSet *imports, size_t depth) {
+	separate.superPS = this;
+	separate.readRecord = std::move(readRecord);
+	separate.recording = recording;
+	separate.Import(filename, directoryForImports, filter, imports, depth);
+	readRecord = std::move(separate.readRecord);
+}
+
+/**
+ * Read the files found by 'import *' with a lazy filter but only keep their index keys
+ * and the variables those use. ImportLazy imports a file once one of its lexers is used
+ * along with the files that define variables it uses.
+ */
+void PropSetFile::IndexImports(const FilePathSet &files, const FilePath &directoryForImports, const ImportFilter &filter,
+			       FilePathSet *imports, size_t depth) {
+	ImportFilter filterFull = filter;
+	filterFull.lazy = false;
+	const size_t first = lazyImports.size();
+	std::vector<PropSetFile> languages;
+	std::vector<std::vector<std::string>> conditions(files.size());
+	std::map<std::string, std::vector<size_t>, std::less<>> definers;
+	std::set<std::string, std::less<>> indexReferences;
+	for (const FilePath &file : files) {
+		const size_t index = lazyImports.size();
+		LazyImport &lazy = lazyImports.emplace_back();
+		lazy.path = file;
+		lazy.directoryForImports = directoryForImports;
+		lazy.filter = filterFull;
+		PropSetFile &language = languages.emplace_back(lowerKeys);
+		language.conditionVariables = &conditions[index - first];
+		ReadSeparately(language, file, directoryForImports, filterFull, imports, depth);
+		language.conditionVariables = nullptr;
+		for (const auto &[key, value] : language.props) {
+			definers[key].push_back(index);
+			if (IndexKey(key)) {
+				Set(key, value);
+				AddVariableReferences(key, indexReferences);
+				AddVariableReferences(value, indexReferences);
+				if (key.starts_with("lexer.")) {
+					lazy.lexers.insert(value);
+					lazy.patterns.push_back(key.substr(strlen("lexer.")));
+				}
+			}
+		}
+	}
+
+	// Variables used by index keys like forth.extensions in filter.forth are kept too
+	std::set<std::string, std::less<>> kept;
+	while (!indexReferences.empty()) {
+		const std::string variable = indexReferences.extract(indexReferences.begin()).value();
+		const auto it = definers.find(variable);
+		if ((it != definers.end()) && !IndexKey(variable) && kept.insert(variable).second) {
+			// The last file read wins as it would when imported
+			const std::string_view value = languages[it->second.back() - first].props.find(variable)->second;
+			Set(variable, value);
+			AddVariableReferences(value, indexReferences);
+		}
+	}
+
+	for (size_t index = first; index < lazyImports.size(); index++) {
+		CompileLazyPatterns(lazyImports[index]);
+	}
+
+	// Depend on other files for variables that are used but not defined in a file
+	for (size_t index = first; index < lazyImports.size(); index++) {
+		const mapss &languageProps = languages[index - first].props;
+		std::set<std::string, std::less<>> references;
+		for (const auto &[key, value] : languageProps) {
+			AddVariableReferences(key, references);
+			AddVariableReferences(value, references);
+		}
+		std::vector<size_t> &dependencies = lazyImports[index].dependencies;
+		for (const std::string &reference : references) {
+			const auto it = definers.find(reference);
+			if ((it != definers.end()) && !IndexKey(reference) && !languageProps.contains(reference)) {
+				for (const size_t definer : it->second) {
+					if (std::ranges::find(dependencies, definer) == dependencies.end()) {
+						dependencies.push_back(definer);
+					}
+				}
+			}
+		}
+		// Conditions were evaluated against the files read before this one so only those are imported first
+		for (const std::string &variable : conditions[index - first]) {
+			const auto it = definers.find(variable);
+			if ((it != definers.end()) && !languageProps.contains(variable)) {
+				for (const size_t definer : it->second) {
+					if ((definer < index) && (std::ranges::find(dependencies, definer) == dependencies.end())) {
+						dependencies.push_back(definer);
+					}
+				}
+			}
+		}
+	}
+}
+
+void PropSetFile::CompileLazyPatterns(LazyImport &lazy) const {
+	lazy.filePatterns.clear();
+	for (const std::string &pattern : lazy.patterns) {
+		const FilePatterns compiled = CompilePatternSet(Expand(pattern));
+		lazy.filePatterns.insert(lazy.filePatterns.end(), compiled.begin(), compiled.end());
+	}
+}
+
+void PropSetFile::ImportLazyFile(size_t index) {
+	LazyImport &lazy = lazyImports[index];
+	lazy.imported = true;
+	// Dependencies are imported in the order 'import *' would read them so conditions
+	// see the same values and later files still replace values of earlier files
+	for (const size_t dependency : lazy.dependencies) {
+		if ((dependency < index) && !lazyImports[dependency].imported) {
+			ImportLazyFile(dependency);
+		}
+	}
+	PropSetFile language(lowerKeys);
+	ReadSeparately(language, lazy.path, lazy.directoryForImports, lazy.filter, nullptr, 1);
+	for (const auto &[key, value] : language.props) {
+		Set(key, value);
+	}
+	for (const size_t dependency : lazy.dependencies) {
+		if ((dependency > index) && !lazyImports[dependency].imported) {
+			ImportLazyFile(dependency);
+		}
+	}
+}
+
+/**
+ * Import the files indexed by 'import *' that use a lexer or set the lexer of a file
+ * as these may define other settings for that file.
+ * Returns true if any were imported.
+ */
+bool PropSetFile::ImportLazy(std::string_view lexer, std::string_view filename) {
+	bool importedAny = false;
+	for (size_t index = 0; index < lazyImports.size(); index++) {
+		const LazyImport &lazy = lazyImports[index];
+		if (lazy.imported) {
+			continue;
+		}
+		bool use = lazy.lexers.contains(lexer);
+		if (!use && !filename.empty()) {
+			use = MatchPatterns(lazy.filePatterns, filename, caseSensitiveFilenames);
+		}
+		if (use) {
+			ImportLazyFile(index);
+			importedAny = true;
+		}
+	}
+	return importedAny;
+}
+
+bool PropSetFile::Read(const FilePath &filename, const FilePath &directoryForImports,
+		       const ImportFilter &filter, FilePathSet *imports, size_t depth) {
+	const std::string propsData = filename.Read();
+	if (recording) {
+		readRecord->files.push_back({ filename.AsUTF8(), filename.ModifiedTime(), filename.GetFileLength(),
+			ContentHash(propsData) });
+	}
+	if (!propsData.empty()) {
+		std::string_view data(propsData);
+		const std::string_view svUtf8BOM(UTF8BOM);
+		if (data.starts_with(svUtf8BOM)) {
+			data.remove_prefix(svUtf8BOM.length());
+		}
+		ReadFromMemory(data, directoryForImports, filter, imports, depth);
+		return true;
+	}
+	return false;
+}
+
+namespace {
+
+// The cache is only read on the machine that wrote it but numbers are written
+// in a fixed byte order so a damaged or foreign file is safely rejected.
+
+constexpr std::string_view cacheMagic = "SciTE properties cache 3";
+
+class CacheWriter {
+public:
+	std::string data;
+	void Number(long long value) {
+		for (int byte = 0; byte < 8; byte++) {
+			data.push_back(static_cast<char>(static_cast<unsigned long long>(value) >> (byte * 8)));
+		}
+	}
+	void String(std::string_view text) {
+		Number(text.length());
+		data.append(text);
+	}
+};
+
+class CacheReader {
+	std::string_view data;
+	bool valid = true;
+public:
+	explicit CacheReader(std::string_view data_) noexcept : data(data_) {
+	}
+	[[nodiscard]] bool Valid() const noexcept {
+		return valid;
+	}
+	[[nodiscard]] bool AtEnd() const noexcept {
+		return valid && data.empty();
+	}
+	long long Number() noexcept {
+		if (data.length() < 8) {
+			valid = false;
+			return 0;
+		}
+		unsigned long long value = 0;
+		for (int byte = 0; byte < 8; byte++) {
+			value |= static_cast<unsigned long long>(static_cast<unsigned char>(data[byte])) << (byte * 8);
+		}
+		data.remove_prefix(8);
+		return static_cast<long long>(value);
+	}
+	std::string_view String() noexcept {
+		const long long length = Number();
+		if (!valid || (length < 0) || (static_cast<unsigned long long>(length) > data.length())) {
+			valid = false;
+			return {};
+		}
+		const std::string_view text = data.substr(0, static_cast<size_t>(length));
+		data.remove_prefix(static_cast<size_t>(length));
+		return text;
+	}
+};
+
+std::string FilterText(const ImportFilter &filter) {
+	std::string text = "exclude";
+	for (const std::string &exclude : filter.excludes) {
+		text += ' ';
+		text += exclude;
+	}
+	text += "\ninclude";
+	for (const std::string &include : filter.includes) {
+		text += ' ';
+		text += include;
+	}
+	if (filter.lazy) {
+		text += "\nlazy";
+	}
+	return text;
+}
+
+}
+
+/**
+ * Read a properties file or, if it is still valid, a cache of the result of an earlier read.
+ * The cache holds the final keys and values so directives and imports do not have to be processed.
+ * It is valid when the files read have the same modification times and lengths, and the same contents
+ * if they were modified just before being read, directories imported
+ * with 'import *' contain the same properties files, and variables used by 'if' and 'match' have
+ * the same values in the base property sets.
+ * When anyFilter is set, a cache made with a different import filter is accepted as the caller will
+ * read again once it knows the filter.
+ * Returns true if the cache was used.
+ */
+bool PropSetFile::ReadCached(const FilePath &cacheFile, const FilePath &filename, const FilePath &directoryForImports,
+			     const ImportFilter &filter, FilePathSet *imports, bool anyFilter) {
+	std::unique_ptr<ReadRecord> record = std::make_unique<ReadRecord>();
+	record->filename = filename.AsUTF8();
+	record->directory = directoryForImports.AsUTF8();
+	record->filter = FilterText(filter);
+	record->lowerKeys = lowerKeys;
+	record->recorded = static_cast<long long>(time(nullptr));
+
+	if (props.empty()) {
+		const std::string data = cacheFile.Read();
+		if (!data.empty() && LoadCache(data, *record, filter, anyFilter, imports)) {
+			readRecord.reset();
+			return true;
+		}
+	}
+
+	readRecord = std::move(record);
+	FilePathSet importsRead;
+	recording = true;
+	Read(filename, directoryForImports, filter, &importsRead, 0);
+	recording = false;
+
+	for (const std::string &variable : readRecord->variables) {
+		readRecord->dependencies[variable] = superPS ? superPS->Get(variable) : "";
+	}
+	for (const FilePath &import : importsRead) {
+		readRecord->imports.push_back(import.AsUTF8());
+		if (imports && (std::ranges::find(*imports, import) == imports->end())) {
+			imports->push_back(import);
+		}
+	}
+	return false;
+}
+
+bool PropSetFile::LoadCache(std::string_view data, const ReadRecord &expected, const ImportFilter &filter, bool anyFilter,
+			    FilePathSet *imports) {
+	CacheReader reader(data);
+	if ((reader.String() != cacheMagic) ||
+		(reader.String() != expected.filename) ||
+		(reader.String() != expected.directory) ||
+		((reader.String() != expected.filter) && !anyFilter) ||
+		((reader.Number() != 0) != expected.lowerKeys)) {
+		return false;
+	}
+	const long long recorded = reader.Number();
+
+	const long long files = reader.Number();
+	for (long long file = 0; file < files && reader.Valid(); file++) {
+		const FilePath path(GUI::StringFromUTF8(reader.String()));
+		const long long modified = reader.Number();
+		const long long length = reader.Number();
+		const unsigned long long hash = static_cast<unsigned long long>(reader.Number());
+		if ((path.ModifiedTime() != modified) || (path.GetFileLength() != length)) {
+			return false;
+		}
+		if ((modified >= recorded - racySeconds) && (ContentHash(path.Read()) != hash)) {
+			return false;
+		}
+	}
+
+	const long long directories = reader.Number();
+	for (long long directory = 0; directory < directories && reader.Valid(); directory++) {
+		const FilePath path(GUI::StringFromUTF8(reader.String()));
+		FilePathSet directoriesListed;
+		FilePathSet filesListed;
+		path.List(directoriesListed, filesListed);
+		if (PropertiesFileNames(filesListed) != reader.String()) {
+			return false;
+		}
+	}
+
+	const long long dependencies = reader.Number();
+	for (long long dependency = 0; dependency < dependencies && reader.Valid(); dependency++) {
+		const std::string_view variable = reader.String();
+		const std::string_view value = superPS ? superPS->Get(variable) : "";
+		if (value != reader.String()) {
+			return false;
+		}
+	}
+
+	FilePathSet importsCached;
+	const long long importCount = reader.Number();
+	for (long long import = 0; import < importCount && reader.Valid(); import++) {
+		importsCached.emplace_back(GUI::StringFromUTF8(reader.String()));
+	}
+
+	// Keys were written in order so each can be appended at the end
+	const long long keys = reader.Number();
+	for (long long key = 0; key < keys && reader.Valid(); key++) {
+		const std::string_view name = reader.String();
+		const std::string_view value = reader.String();
+		props.emplace_hint(props.end(), name, value);
+	}
+
+	ImportFilter filterFull = filter;
+	filterFull.lazy = false;
+	const long long lazyCount = reader.Number();
+	for (long long lazyIndex = 0; lazyIndex < lazyCount && reader.Valid(); lazyIndex++) {
+		LazyImport &lazy = lazyImports.emplace_back();
+		lazy.path = FilePath(GUI::StringFromUTF8(reader.String()));
+		lazy.directoryForImports = FilePath(GUI::StringFromUTF8(reader.String()));
+		lazy.filter = filterFull;
+		const long long lexers = reader.Number();
+		for (long long lexer = 0; lexer < lexers && reader.Valid(); lexer++) {
+			lazy.lexers.emplace(reader.String());
+		}
+		const long long patterns = reader.Number();
+		for (long long pattern = 0; pattern < patterns && reader.Valid(); pattern++) {
+			lazy.patterns.emplace_back(reader.String());
+		}
+		const long long dependencies = reader.Number();
+		for (long long dependency = 0; dependency < dependencies && reader.Valid(); dependency++) {
+			const long long definer = reader.Number();
+			if ((definer < 0) || (definer >= lazyCount)) {
+				break;
+			}
+			lazy.dependencies.push_back(static_cast<size_t>(definer));
+		}
+	}
+
+	if (!reader.AtEnd() || (lazyImports.size() != static_cast<size_t>(lazyCount))) {
+		props.clear();
+		lazyImports.clear();
+		return false;
+	}
+	for (LazyImport &lazy : lazyImports) {
+		CompileLazyPatterns(lazy);
+	}
+
+	if (!props.empty()) {
+		generation++;
+	}
+	if (imports) {
+		for (const FilePath &import : importsCached) {
+			if (std::ranges::find(*imports, import) == imports->end()) {
+				imports->push_back(import);
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Write the result of the most recent ReadCached, if it read the properties files, so it can be
+ * reused by later calls.
+ */
+void PropSetFile::WriteCache(const FilePath &cacheFile) const {
+	if (!readRecord) {
+		return;
+	}
+	for (const auto &[variable, value] : readRecord->dependencies) {
+		if (variable.find(' ') != std::string::npos) {
+			// Commands like 'star' depend on more than the value of a single variable
+			return;
+		}
+	}
+
+	CacheWriter writer;
+	writer.String(cacheMagic);
+	writer.String(readRecord->filename);
+	writer.String(readRecord->directory);
+	writer.String(readRecord->filter);
+	writer.Number(readRecord->lowerKeys ? 1 : 0);
+	writer.Number(readRecord->recorded);
+
+	writer.Number(readRecord->files.size());
+	for (const SourceFile &file : readRecord->files) {
+		writer.String(file.path);
+		writer.Number(file.modified);
+		writer.Number(file.length);
+		writer.Number(static_cast<long long>(file.hash));
+	}
+
+	writer.Number(readRecord->directories.size());
+	for (const auto &[directory, names] : readRecord->directories) {
+		writer.String(directory);
+		writer.String(names);
+	}
+
+	writer.Number(readRecord->dependencies.size());
+	for (const auto &[variable, value] : readRecord->dependencies) {
+		writer.String(variable);
+		writer.String(value);
+	}
+
+	writer.Number(readRecord->imports.size());
+	for (const std::string &import : readRecord->imports) {
+		writer.String(import);
+	}
+
+	writer.Number(props.size());
+	for (const auto &[key, value] : props) {
+		writer.String(key);
+		writer.String(value);
+	}
+
+	writer.Number(lazyImports.size());
+	for (const LazyImport &lazy : lazyImports) {
+		writer.String(lazy.path.AsUTF8());
+		writer.String(lazy.directoryForImports.AsUTF8());
+		writer.Number(lazy.lexers.size());
+		for (const std::string &lexer : lazy.lexers) {
+			writer.String(lexer);
+		}
+		writer.Number(lazy.patterns.size());
+		for (const std::string &pattern : lazy.patterns) {
+			writer.String(pattern);
+		}
+		writer.Number(lazy.dependencies.size());
+		for (const size_t dependency : lazy.dependencies) {
+			writer.Number(dependency);
+		}
+	}
+
+	FileHolder fp(cacheFile.Open(GUI_TEXT("wb")));
+	if (fp) {
+		fwrite(writer.data.c_str(), 1, writer.data.length(), fp.get());
+	}
+}
+
+namespace {
+
+bool StringEqual(std::string_view a, std::string_view b, bool caseSensitive) noexcept {
+	if (caseSensitive) {
+		return a == b;
+	}
+	return EqualCaseInsensitive(a, b);
+}
+
+// Match file names to patterns allowing for '*' and '?'.
+
+bool MatchWild(std::string_view pattern, std::string_view text, bool caseSensitive) {
+	if (StringEqual(pattern, text, caseSensitive)) {
+		return true;
+	} else if (pattern.empty()) {
+		return false;
+	} else if (pattern.front() == '*') {
+		pattern.remove_prefix(1);
+		if (pattern.empty()) {
+			return true;
+		}
+		while (!text.empty()) {
+			if (MatchWild(pattern, text, caseSensitive)) {
+				return true;
+			}
+			text.remove_prefix(1);
+		}
+	} else if (text.empty()) {
+		return false;
+	} else if (pattern.front() == '?') {
+		pattern.remove_prefix(1);
+		text.remove_prefix(1);
+		return MatchWild(pattern, text, caseSensitive);
+	} else if (caseSensitive && pattern.front() == text.front()) {
+		pattern.remove_prefix(1);
+		text.remove_prefix(1);
+		return MatchWild(pattern, text, caseSensitive);
+	} else if (!caseSensitive && MakeUpperCase(pattern.front()) == MakeUpperCase(text.front())) {
+		pattern.remove_prefix(1);
+		text.remove_prefix(1);
+		return MatchWild(pattern, text, caseSensitive);
+	}
+	return false;
+}
+
+// Split a ';' separated set of patterns and classify each one.
+
+FilePatterns CompilePatternSet(std::string_view patternSet) {
+	FilePatterns patterns;
+	while (!patternSet.empty()) {
+		const size_t sepPos = patternSet.find_first_of(';');
+		const std::string_view pattern = patternSet.substr(0, sepPos);
+		const size_t wildPos = pattern.find_first_of("*?");
+		if (wildPos == std::string_view::npos) {
+			patterns.push_back({ FilePattern::Kind::exact, std::string(pattern) });
+		} else if (pattern == "*") {
+			patterns.push_back({ FilePattern::Kind::all, {} });
+		} else if ((pattern.front() == '*') && (pattern.find_first_of("*?", 1) == std::string_view::npos)) {
+			patterns.push_back({ FilePattern::Kind::suffix, std::string(pattern.substr(1)) });
+		} else {
+			patterns.push_back({ FilePattern::Kind::wild, std::string(pattern) });
+		}
+		// Move to next
+		patternSet = (sepPos == std::string_view::npos) ? "" : patternSet.substr(sepPos + 1);
+	}
+	return patterns;
+}
+
+bool MatchPatterns(const FilePatterns &patterns, std::string_view text, bool caseSensitive) {
+	for (const FilePattern &pattern : patterns) {
+		switch (pattern.kind) {
+		case FilePattern::Kind::exact:
+			if (StringEqual(pattern.text, text, caseSensitive)) {
+				return true;
+			}
+			break;
+		case FilePattern::Kind::suffix:
+			if ((text.length() >= pattern.text.length()) &&
+				StringEqual(pattern.text, text.substr(text.length() - pattern.text.length()), caseSensitive)) {
+				return true;
+			}
+			break;
+		case FilePattern::Kind::all:
+			return true;
+		case FilePattern::Kind::wild:
+			if (MatchWild(pattern.text, text, caseSensitive)) {
+				return true;
+			}
+			break;
+		}
+	}
+	return false;
+}
+
+}
+
+std::string_view PropSetFile::GetWildUsingStart(const PropSetFile &psStart, std::string_view keybase, std::string_view filename,
+	WildCache *cache, bool &cacheable) const {
+	const PropSetFile *psf = this;
+	while (psf) {
+		mapss::const_iterator it = psf->props.lower_bound(keybase);
+		while ((it != psf->props.end()) && it->first.starts_with(keybase)) {
+			if (it->first == keybase) {
+				return it->second;
+			}
+			const std::string_view first = it->first;
+			const std::string_view orgkeyfile = first.substr(keybase.length());
+
+			const FilePatterns *patterns = nullptr;
+			FilePatterns patternsUncached;
+			if (cache) {
+				const auto itPatterns = cache->patterns.find(orgkeyfile);
+				if (itPatterns != cache->patterns.end()) {
+					patterns = &itPatterns->second;
+				}
+			}
+			if (!patterns) {
+				std::string key;	// keyFile may point into key so key lifetime must cover keyFile
+				std::string_view keyFile = orgkeyfile;
+				bool stable = true;
+
+				if (orgkeyfile.starts_with("$(")) {
+					// $(X) is a variable so extract X and find its value
+					const size_t endVar = orgkeyfile.find_first_of(')');
+					if (endVar != std::string_view::npos) {
+						const std::string_view var = orgkeyfile.substr(2, endVar-2);
+						std::vector<std::string> variables;
+						key = psStart.Get(var);
+						ExpandAllInPlace(psStart, key, maxIterations, VarChain(var), &variables);
+						keyFile = key;
+						stable = WildCacheable(var) && std::ranges::all_of(variables, WildCacheable);
+					}
+				}
+
+				if (cache && stable) {
+					patterns = &cache->patterns.emplace(orgkeyfile, CompilePatternSet(keyFile)).first->second;
+				} else {
+					cacheable = cacheable && stable;
+					patternsUncached = CompilePatternSet(keyFile);
+					patterns = &patternsUncached;
+				}
+			}
+
+			if (MatchPatterns(*patterns, filename, caseSensitiveFilenames)) {
+				return it->second;
+			}
+
+			++it;
+		}
+		// Failed here, so try in base property set
+		psf = psf->superPS;
+	}
+	return "";
+}
+
+std::string_view PropSetFile::GetWild(std::string_view keybase, std::string_view filename) const {
+	bool cacheable = WildCacheable(keybase);
+	if (!cacheable) {
+		return GetWildUsingStart(*this, keybase, filename, nullptr, cacheable);
+	}
+
+	const size_t generationChain = ChainGeneration();
+	if (!wildCache || (wildCache->generation != generationChain) || (wildCache->caseSensitive != caseSensitiveFilenames)) {
+		wildCache = std::make_unique<WildCache>();
+		wildCache->generation = generationChain;
+		wildCache->caseSensitive = caseSensitiveFilenames;
+	}
+
+	auto itFile = wildCache->results.find(filename);
+	if (itFile == wildCache->results.end()) {
+		if (wildCache->results.size() >= maxCachedFiles) {
+			wildCache->results.clear();
+		}
+		itFile = wildCache->results.emplace(filename, std::map<std::string, std::string_view, std::less<>>()).first;
+	}
+	const auto itResult = itFile->second.find(keybase);
+	if (itResult != itFile->second.end()) {
+		return itResult->second;
+	}
+
+	const std::string_view value = GetWildUsingStart(*this, keybase, filename, wildCache.get(), cacheable);
+	if (cacheable) {
+		itFile->second.emplace(keybase, value);
+	}
+	return value;
+}
+
+// GetNewExpandString does not use Expand as it has to use GetWild with the filename for each
+// variable reference found.
+
+std::string PropSetFile::GetNewExpandString(std::string_view keybase, std::string_view filename) const {
+	std::string withVars(GetWild(keybase, filename));
+	size_t varStart = withVars.find("$(");
+	int maxExpands = maxIterations;	// Avoid infinite expansion of recursive definitions
+	while ((varStart != std::string::npos) && (maxExpands > 0)) {
+		const size_t varEnd = withVars.find(')', varStart+2);
+		if (varEnd == std::string::npos) {
+			break;
+		}
+		const std::string_view var = std::string_view(withVars).substr(
+			varStart + 2, varEnd - varStart - 2);	// Subtract the $(
+		std::string val;
+		if (var != keybase)	// Self-references evaluate to empty string
+			val = GetWild(var, filename);
+		withVars.replace(varStart, varEnd - varStart + 1, val);
+		varStart = withVars.find("$(");
+		maxExpands--;
+	}
+	return withVars;
+}
+
+/**
+ * Initiate enumeration.
+ */
+bool PropSetFile::GetFirst(const char *&key, const char *&val) const {
+	const mapss::const_iterator it = props.begin();
+	if (it != props.end()) {
+		key = it->first.c_str();
+		val = it->second.c_str();
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Continue enumeration.
+ */
+bool PropSetFile::GetNext(const char *&key, const char *&val) const {
+	mapss::const_iterator it = props.find(key);
+	if (it != props.end()) {
+		++it;
+		if (it != props.end()) {
+			key = it->first.c_str();
+			val = it->second.c_str();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool IsPropertiesFile(const FilePath &filename) {
+	const FilePath ext = filename.Extension();
+	return EqualCaseInsensitive(ext.AsUTF8(), extensionProperties + 1);
+}
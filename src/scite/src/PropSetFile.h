@@ -1,70 +1,106 @@
-// SciTE - Scintilla based Text Editor
-/** @file PropSetFile.h
- ** Definition of platform independent base class of editor.
- **/
-// Copyright 1998-2009 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef PROPSETFILE_H
-#define PROPSETFILE_H
-
-/**
- */
-
-using mapss = std::map<std::string, std::string, std::less<>>;
-
-class ImportFilter {
-public:
-	std::set<std::string> excludes;
-	std::set<std::string> includes;
-	void SetFilter(const std::string &sExcludes, const std::string &sIncludes);
-	bool IsValid(const std::string &name) const;
-};
-
-class PropSetFile {
-	bool lowerKeys;
-	std::string_view GetWildUsingStart(const PropSetFile &psStart, std::string_view keybase, std::string_view filename) const;
-	static bool caseSensitiveFilenames;
-	mapss props;
-public:
-	PropSetFile *superPS;
-	explicit PropSetFile(bool lowerKeys_=false);
-
-	void Set(std::string_view key, std::string_view val);
-	void SetPath(std::string_view key, const FilePath &path);
-	void SetLine(const char *keyVal, bool unescape);
-	void Unset(std::string_view key);
-	void Clear() noexcept;
-
-	bool Exists(std::string_view key) const;
-	[[nodiscard]] std::string_view Get(std::string_view key) const;
-	std::string GetString(std::string_view key) const;
-	std::string Evaluate(std::string_view key) const;
-	std::string GetExpandedString(std::string_view key) const;
-	std::string Expand(std::string_view withVars, int maxExpands=200) const;
-	int GetInt(std::string_view key, int defaultValue=0) const;
-	intptr_t GetInteger(std::string_view key, intptr_t defaultValue=0) const;
-	long long GetLongLong(std::string_view key, long long defaultValue=0) const;
-
-	enum class ReadLineState { active, excludedModule, conditionFalse };
-	ReadLineState ReadLine(const std::string &lineBuffer, ReadLineState rls, const FilePath &directoryForImports, const ImportFilter &filter,
-			       FilePathSet *imports, size_t depth);
-	void ReadFromMemory(std::string_view data, const FilePath &directoryForImports, const ImportFilter &filter,
-			    FilePathSet *imports, size_t depth);
-	void Import(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
-		    FilePathSet *imports, size_t depth);
-	bool Read(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
-		  FilePathSet *imports, size_t depth);
-	std::string_view GetWild(std::string_view keybase, std::string_view filename) const;
-	std::string GetNewExpandString(std::string_view keybase, std::string_view filename = "") const;
-	bool GetFirst(const char *&key, const char *&val) const;
-	bool GetNext(const char *&key, const char *&val) const;
-	static void SetCaseSensitiveFilenames(bool caseSensitiveFilenames_) noexcept {
-		caseSensitiveFilenames = caseSensitiveFilenames_;
-	}
-};
-
-constexpr const char *extensionProperties = ".properties";
-bool IsPropertiesFile(const FilePath &filename);
-
-#endif
+// SciTE - Scintilla based Text Editor
+/** @file PropSetFile.h
+ ** Definition of platform independent base class of editor.
+ **/
+// Copyright 1998-2009 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef PROPSETFILE_H
+#define PROPSETFILE_H
+
+/**
+ */
+
+using mapss = std::map<std::string, std::string, std::less<>>;
+
+class ImportFilter {
+public:
+	std::set<std::string> excludes;
+	std::set<std::string> includes;
+	// Files found by 'import *' are only indexed until one of their lexers is used
+	bool lazy = false;
+	void SetFilter(const std::string &sExcludes, const std::string &sIncludes);
+	bool IsValid(const std::string &name) const;
+};
+
+class PropSetFile {
+	bool lowerKeys;
+	size_t generation;	// Incremented when a key that may be found by GetWild changes
+	// Results of GetWild and compiled file patterns, discarded when generation changes
+	struct WildCache;
+	mutable std::unique_ptr<WildCache> wildCache;
+	std::string_view GetWildUsingStart(const PropSetFile &psStart, std::string_view keybase, std::string_view filename,
+		WildCache *cache, bool &cacheable) const;
+	[[nodiscard]] size_t ChainGeneration() const noexcept;
+	void Changed(std::string_view key) noexcept;
+	// What the most recent ReadCached depended on so WriteCache can save it
+	struct ReadRecord;
+	std::unique_ptr<ReadRecord> readRecord;
+	bool recording;
+	bool LoadCache(std::string_view data, const ReadRecord &expected, const ImportFilter &filter, bool anyFilter,
+		       FilePathSet *imports);
+	// Files indexed by 'import *' with a lazy filter
+	struct LazyImport;
+	std::vector<LazyImport> lazyImports;
+	// Set while indexing a lazy import to collect the variables its 'if' conditions test
+	std::vector<std::string> *conditionVariables;
+	void ReadSeparately(PropSetFile &separate, const FilePath &filename, const FilePath &directoryForImports,
+			    const ImportFilter &filter, FilePathSet *imports, size_t depth);
+	void IndexImports(const FilePathSet &files, const FilePath &directoryForImports, const ImportFilter &filter,
+			  FilePathSet *imports, size_t depth);
+	void CompileLazyPatterns(LazyImport &lazy) const;
+	void ImportLazyFile(size_t index);
+	static bool caseSensitiveFilenames;
+	mapss props;
+public:
+	PropSetFile *superPS;
+	explicit PropSetFile(bool lowerKeys_=false);
+	// The wildcard cache is not copied as it refers into the source's properties.
+	PropSetFile(const PropSetFile &other);
+	PropSetFile(PropSetFile &&) noexcept;
+	PropSetFile &operator=(const PropSetFile &other);
+	PropSetFile &operator=(PropSetFile &&) noexcept;
+	~PropSetFile();
+
+	void Set(std::string_view key, std::string_view val);
+	void SetPath(std::string_view key, const FilePath &path);
+	void SetLine(const char *keyVal, bool unescape);
+	void Unset(std::string_view key);
+	void Clear() noexcept;
+
+	bool Exists(std::string_view key) const;
+	[[nodiscard]] std::string_view Get(std::string_view key) const;
+	std::string GetString(std::string_view key) const;
+	std::string Evaluate(std::string_view key) const;
+	std::string GetExpandedString(std::string_view key) const;
+	std::string Expand(std::string_view withVars, int maxExpands=200) const;
+	int GetInt(std::string_view key, int defaultValue=0) const;
+	intptr_t GetInteger(std::string_view key, intptr_t defaultValue=0) const;
+	long long GetLongLong(std::string_view key, long long defaultValue=0) const;
+
+	enum class ReadLineState { active, excludedModule, conditionFalse };
+	ReadLineState ReadLine(const std::string &lineBuffer, ReadLineState rls, const FilePath &directoryForImports, const ImportFilter &filter,
+			       FilePathSet *imports, size_t depth);
+	void ReadFromMemory(std::string_view data, const FilePath &directoryForImports, const ImportFilter &filter,
+			    FilePathSet *imports, size_t depth);
+	void Import(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
+		    FilePathSet *imports, size_t depth);
+	bool Read(const FilePath &filename, const FilePath &directoryForImports, const ImportFilter &filter,
+		  FilePathSet *imports, size_t depth);
+	bool ReadCached(const FilePath &cacheFile, const FilePath &filename, const FilePath &directoryForImports,
+			const ImportFilter &filter, FilePathSet *imports, bool anyFilter=false);
+	void WriteCache(const FilePath &cacheFile) const;
+	bool ImportLazy(std::string_view lexer, std::string_view filename);
+	std::string_view GetWild(std::string_view keybase, std::string_view filename) const;
+	std::string GetNewExpandString(std::string_view keybase, std::string_view filename = "") const;
+	bool GetFirst(const char *&key, const char *&val) const;
+	bool GetNext(const char *&key, const char *&val) const;
+	static void SetCaseSensitiveFilenames(bool caseSensitiveFilenames_) noexcept {
+		caseSensitiveFilenames = caseSensitiveFilenames_;
+	}
+};
+
+constexpr const char *extensionProperties = ".properties";
+bool IsPropertiesFile(const FilePath &filename);
+
+#endif
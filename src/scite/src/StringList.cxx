@@ -1,294 +1,498 @@
-// SciTE - Scintilla based Text Editor
-/** @file StringList.cxx
- ** Implementation of class holding a list of strings.
- **/
-// Copyright 1998-2005 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#include <cstddef>
-#include <cstdlib>
-#include <cassert>
-#include <cstring>
-
-#include <tuple>
-#include <string>
-#include <string_view>
-#include <vector>
-#include <map>
-#include <set>
-#include <algorithm>
-#include <chrono>
-
-#include "GUI.h"
-#include "StringList.h"
-#include "StringHelpers.h"
-
-namespace {
-
-int CompareNCaseInsensitive(const char *a, const char *b, size_t len) noexcept {
-	while (*a && *b && len) {
-		if (*a != *b) {
-			const char upperA = MakeUpperCase(*a);
-			const char upperB = MakeUpperCase(*b);
-			if (upperA != upperB)
-				return upperA - upperB;
-		}
-		a++;
-		b++;
-		len--;
-	}
-	if (len == 0)
-		return 0;
-	else
-		// Either *a or *b is nul
-		return *a - *b;
-}
-
-/**
- * Creates an array that points into each word in the string and puts \0 terminators
- * after each word.
- */
-std::vector<char *> ArrayFromStringList(char *stringList, bool onlyLineEnds = false) {
-	int prev = '\n';
-	int words = 0;
-	// For rapid determination of whether a character is a separator, build
-	// a look up table.
-	bool wordSeparator[256] = {};
-	wordSeparator[static_cast<unsigned int>('\r')] = true;
-	wordSeparator[static_cast<unsigned int>('\n')] = true;
-	if (!onlyLineEnds) {
-		wordSeparator[static_cast<unsigned int>(' ')] = true;
-		wordSeparator[static_cast<unsigned int>('\t')] = true;
-	}
-	for (int j = 0; stringList[j]; j++) {
-		const int curr = static_cast<unsigned char>(stringList[j]);
-		if (!wordSeparator[curr] && wordSeparator[prev])
-			words++;
-		prev = curr;
-	}
-	std::vector<char *> keywords;
-	const size_t slen = strlen(stringList);
-	if (words) {
-		prev = '\0';
-		for (size_t k = 0; k < slen; k++) {
-			if (!wordSeparator[static_cast<unsigned char>(stringList[k])]) {
-				if (!prev) {
-					keywords.push_back(&stringList[k]);
-				}
-			} else {
-				stringList[k] = '\0';
-			}
-			prev = stringList[k];
-		}
-	}
-	return keywords;
-}
-
-bool CmpString(const char *a, const char *b) noexcept {
-	return strcmp(a, b) < 0;
-}
-
-bool CmpStringNoCase(const char *a, const char *b) noexcept {
-	return CompareNoCase(a, b) < 0;
-}
-
-// Functors used to find elements given a prefix
-
-struct CompareString {
-	size_t searchLen;
-	explicit CompareString(size_t searchLen_) noexcept : searchLen(searchLen_) {}
-	bool operator()(const char *a, const char *b) const noexcept {
-		return strncmp(a, b, searchLen) < 0;
-	}
-};
-
-struct CompareStringInsensitive {
-	size_t searchLen;
-	explicit CompareStringInsensitive(size_t searchLen_) noexcept : searchLen(searchLen_) {}
-	bool operator()(const char *a, const char *b) const noexcept {
-		return CompareNCaseInsensitive(a, b, searchLen) < 0;
-	}
-};
-
-template<typename Compare>
-std::string GetMatch(std::vector<char *>::iterator start, std::vector<char *>::iterator end,
-	const char *wordStart, const std::string &wordCharacters, ptrdiff_t wordIndex, Compare comp) {
-	std::vector<char *>::iterator elem = std::lower_bound(start, end, wordStart, comp);
-	if (!comp(wordStart, *elem) && !comp(*elem, wordStart)) {
-		// Found a matching element, now move forward wordIndex matching elements
-		for (; elem < end; ++elem) {
-			const char *word = *elem;
-			if (!word[comp.searchLen] || !Contains(wordCharacters, word[comp.searchLen])) {
-				if (wordIndex <= 0) {
-					return std::string(word);
-				}
-				wordIndex--;
-			}
-		}
-	}
-	return std::string();
-}
-
-/**
- * Find the length of a 'word' which is actually an identifier in a string
- * which looks like "identifier(..." or "identifier" and where
- * there may be extra spaces after the identifier that should not be
- * counted in the length.
- */
-size_t LengthWord(const char *word, char otherSeparator) noexcept {
-	const char *endWord = nullptr;
-	// Find an otherSeparator
-	if (otherSeparator)
-		endWord = strchr(word, otherSeparator);
-	// Find a '('. If that fails go to the end of the string.
-	if (!endWord)
-		endWord = strchr(word, '(');
-	if (!endWord)
-		endWord = word + strlen(word);
-	assert(endWord);
-	// Last case always succeeds so endWord != 0
-
-	// Drop any space characters.
-	if (endWord > word) {
-		endWord--;	// Back from the '(', otherSeparator, or '\0'
-		// Move backwards over any spaces
-		while ((endWord > word) && (IsASpace(*endWord))) {
-			endWord--;
-		}
-	}
-	return endWord - word + 1;
-}
-
-template<typename Compare>
-StringVector GetMatches(std::vector<char *>::iterator start, std::vector<char *>::iterator end, const char *wordStart, char otherSeparator, bool exactLen, Compare comp) {
-	StringVector wordList;
-	const size_t wordStartLength = LengthWord(wordStart, otherSeparator);
-	std::vector<char *>::iterator elem = std::lower_bound(start, end, wordStart, comp);
-	// Found a matching element, now accumulate all matches
-	for (; elem < end; ++elem) {
-		if (comp(wordStart, *elem) || comp(*elem, wordStart))
-			break;	// Not a match so stop
-		// length of the word part (before the '(' brace) of the api array element
-		const size_t wordlen = LengthWord(*elem, otherSeparator);
-		if (!exactLen || (wordlen == wordStartLength)) {
-			wordList.emplace_back(*elem, wordlen);
-		}
-	}
-	return wordList;
-}
-
-}
-
-void StringList::SetFromListText() {
-	sorted = false;
-	sortedNoCase = false;
-	words = ArrayFromStringList(listText.data(), onlyLineEnds);
-	wordsNoCase = words;
-}
-
-void StringList::SortIfNeeded(bool ignoreCase) {
-	// In both cases, the final empty sentinel element is not sorted.
-	if (ignoreCase) {
-		if (!sortedNoCase) {
-			sortedNoCase = true;
-			std::sort(wordsNoCase.begin(), wordsNoCase.end(), CmpStringNoCase);
-		}
-	} else {
-		if (!sorted) {
-			sorted = true;
-			std::sort(words.begin(), words.end(), CmpString);
-		}
-	}
-}
-
-void StringList::Clear() noexcept {
-	words.clear();
-	wordsNoCase.clear();
-	listText.clear();
-	sorted = false;
-	sortedNoCase = false;
-}
-
-void StringList::Set(const char *s) {
-	listText.assign(s, s+strlen(s)+1);
-	SetFromListText();
-}
-
-void StringList::Set(const std::vector<char> &data) {
-	listText.assign(data.begin(), data.end());
-	listText.push_back('\0');
-	SetFromListText();
-}
-
-/**
- * Returns an element (complete) of the StringList array which has
- * the same beginning as the passed string.
- * The length of the word to compare is passed too.
- * Letter case can be ignored or preserved.
- */
-std::string StringList::GetNearestWord(const char *wordStart, size_t searchLen, bool ignoreCase, const std::string &wordCharacters, ptrdiff_t wordIndex) {
-	if (words.empty())
-		return std::string();
-	SortIfNeeded(ignoreCase);
-	if (ignoreCase) {
-		return GetMatch(wordsNoCase.begin(), wordsNoCase.end(), wordStart, wordCharacters, wordIndex, CompareStringInsensitive(searchLen));
-	} else { // preserve the letter case
-		return GetMatch(words.begin(), words.end(), wordStart, wordCharacters, wordIndex, CompareString(searchLen));
-	}
-}
-
-/**
- * Returns elements (first words of them) of the StringList array which have
- * the same beginning as the passed string.
- * The length of the word to compare is passed too.
- * Letter case can be ignored or preserved (default).
- * If there are more words meeting the condition they are returned all of
- * them in the ascending order separated with spaces.
- */
-StringVector StringList::GetNearestWords(
-	const char *wordStart,
-	size_t searchLen,
-	bool ignoreCase,
-	char otherSeparator /*= '\0'*/,
-	bool exactLen /*=false*/) {
-
-	if (words.empty())
-		return {};
-	SortIfNeeded(ignoreCase);
-	if (ignoreCase) {
-		return GetMatches(wordsNoCase.begin(), wordsNoCase.end(), wordStart, otherSeparator, exactLen, CompareStringInsensitive(searchLen));
-	} else {
-		// Preserve the letter case
-		return GetMatches(words.begin(), words.end(), wordStart, otherSeparator, exactLen, CompareString(searchLen));
-	}
-}
-
-bool AutoCompleteWordList::Add(const std::string& word) {
-	const auto [_, ok] = words.insert(word);
-	if (ok) {
-		const size_t length = word.length();
-		totalLength += 1 + length;
-		minWordLength = std::min(minWordLength, length);
-		return true;
-	}
-	return ok;
-}
-
-std::string AutoCompleteWordList::Sorted(bool ignoreCase) const {
-	std::vector<std::string> wv(words.begin(), words.end());
-	if (ignoreCase) {
-		std::ranges::sort(wv,
-			[](const std::string &a, const std::string &b) noexcept -> bool {
-				return CmpStringNoCase(a.c_str(), b.c_str());
-			});
-	}
-	std::string result;
-	if (totalLength) {
-		for (const std::string &word : wv) {
-			if (!result.empty())
-				result.push_back('\n');
-			result.append(word);
-		}
-	}
-	return result;
-}
+// SciTE - Scintilla based Text Editor
+/** @file StringList.cxx
+ ** Implementation of class holding a list of strings.
+ **/
+// Copyright 1998-2005 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <chrono>
+
+#include "GUI.h"
+#include "StringList.h"
+#include "StringHelpers.h"
+
+namespace {
+
+int CompareNCaseInsensitive(const char *a, const char *b, size_t len) noexcept {
+	while (*a && *b && len) {
+		if (*a != *b) {
+			const char upperA = MakeUpperCase(*a);
+			const char upperB = MakeUpperCase(*b);
+			if (upperA != upperB)
+				return upperA - upperB;
+		}
+		a++;
+		b++;
+		len--;
+	}
+	if (len == 0)
+		return 0;
+	else
+		// Either *a or *b is nul
+		return *a - *b;
+}
+
+/**
+ * Creates an array that points into each word in the string and puts \0 terminators
+ * after each word.
+ */
+std::vector<char *> ArrayFromStringList(char *stringList, bool onlyLineEnds = false) {
+	int prev = '\n';
+	int words = 0;
+	// For rapid determination of whether a character is a separator, build
+	// a look up table.
+	bool wordSeparator[256] = {};
+	wordSeparator[static_cast<unsigned int>('\r')] = true;
+	wordSeparator[static_cast<unsigned int>('\n')] = true;
+	if (!onlyLineEnds) {
+		wordSeparator[static_cast<unsigned int>(' ')] = true;
+		wordSeparator[static_cast<unsigned int>('\t')] = true;
+	}
+	for (int j = 0; stringList[j]; j++) {
+		const int curr = static_cast<unsigned char>(stringList[j]);
+		if (!wordSeparator[curr] && wordSeparator[prev])
+			words++;
+		prev = curr;
+	}
+	std::vector<char *> keywords;
+	const size_t slen = strlen(stringList);
+	if (words) {
+		prev = '\0';
+		for (size_t k = 0; k < slen; k++) {
+			if (!wordSeparator[static_cast<unsigned char>(stringList[k])]) {
+				if (!prev) {
+					keywords.push_back(&stringList[k]);
+				}
+			} else {
+				stringList[k] = '\0';
+			}
+			prev = stringList[k];
+		}
+	}
+	return keywords;
+}
+
+bool CmpString(const char *a, const char *b) noexcept {
+	return strcmp(a, b) < 0;
+}
+
+bool CmpStringNoCase(const char *a, const char *b) noexcept {
+	return CompareNoCase(a, b) < 0;
+}
+
+// Functors used to find elements given a prefix
+
+struct CompareString {
+	size_t searchLen;
+	explicit CompareString(size_t searchLen_) noexcept : searchLen(searchLen_) {}
+	bool operator()(const char *a, const char *b) const noexcept {
+		return strncmp(a, b, searchLen) < 0;
+	}
+};
+
+struct CompareStringInsensitive {
+	size_t searchLen;
+	explicit CompareStringInsensitive(size_t searchLen_) noexcept : searchLen(searchLen_) {}
+	bool operator()(const char *a, const char *b) const noexcept {
+		return CompareNCaseInsensitive(a, b, searchLen) < 0;
+	}
+};
+
+// The compiled index is the magic string, the text length and word count, each word's
+// offset and length in case-sensitive order, then the offsets in case-insensitive order.
+// All numbers are 4 bytes, least significant first.
+
+constexpr std::string_view indexMagic = "SciTE word index 1\n";
+constexpr size_t indexNumberSize = 4;
+
+void AppendIndexNumber(std::string &index, size_t value) {
+	for (size_t byte = 0; byte < indexNumberSize; byte++) {
+		index.push_back(static_cast<char>(value >> (byte * 8)));
+	}
+}
+
+size_t IndexNumberAt(std::string_view index, size_t position) noexcept {
+	size_t value = 0;
+	for (size_t byte = 0; byte < indexNumberSize; byte++) {
+		value |= static_cast<size_t>(static_cast<unsigned char>(index[position + byte])) << (byte * 8);
+	}
+	return value;
+}
+
+bool IsWordSeparator(char ch, bool onlyLineEnds) noexcept {
+	return ch == '\0' || ch == '\r' || ch == '\n' || (!onlyLineEnds && (ch == ' ' || ch == '\t'));
+}
+
+template<typename Compare>
+std::string GetMatch(std::vector<char *>::iterator start, std::vector<char *>::iterator end,
+	const char *wordStart, const std::string &wordCharacters, ptrdiff_t wordIndex, Compare comp) {
+	std::vector<char *>::iterator elem = std::lower_bound(start, end, wordStart, comp);
+	if (!comp(wordStart, *elem) && !comp(*elem, wordStart)) {
+		// Found a matching element, now move forward wordIndex matching elements
+		for (; elem < end; ++elem) {
+			const char *word = *elem;
+			if (!word[comp.searchLen] || !Contains(wordCharacters, word[comp.searchLen])) {
+				if (wordIndex <= 0) {
+					return std::string(word);
+				}
+				wordIndex--;
+			}
+		}
+	}
+	return std::string();
+}
+
+/**
+ * Find the length of a 'word' which is actually an identifier in a string
+ * which looks like "identifier(..." or "identifier" and where
+ * there may be extra spaces after the identifier that should not be
+ * counted in the length.
+ */
+size_t LengthWord(const char *word, char otherSeparator) noexcept {
+	const char *endWord = nullptr;
+	// Find an otherSeparator
+	if (otherSeparator)
+		endWord = strchr(word, otherSeparator);
+	// Find a '('. If that fails go to the end of the string.
+	if (!endWord)
+		endWord = strchr(word, '(');
+	if (!endWord)
+		endWord = word + strlen(word);
+	assert(endWord);
+	// Last case always succeeds so endWord != 0
+
+	// Drop any space characters.
+	if (endWord > word) {
+		endWord--;	// Back from the '(', otherSeparator, or '\0'
+		// Move backwards over any spaces
+		while ((endWord > word) && (IsASpace(*endWord))) {
+			endWord--;
+		}
+	}
+	return endWord - word + 1;
+}
+
+template<typename Compare>
+StringVector GetMatches(std::vector<char *>::iterator start, std::vector<char *>::iterator end, const char *wordStart, char otherSeparator, bool exactLen, Compare comp) {
+	StringVector wordList;
+	const size_t wordStartLength = LengthWord(wordStart, otherSeparator);
+	std::vector<char *>::iterator elem = std::lower_bound(start, end, wordStart, comp);
+	// Found a matching element, now accumulate all matches
+	for (; elem < end; ++elem) {
+		if (comp(wordStart, *elem) || comp(*elem, wordStart))
+			break;	// Not a match so stop
+		// length of the word part (before the '(' brace) of the api array element
+		const size_t wordlen = LengthWord(*elem, otherSeparator);
+		if (!exactLen || (wordlen == wordStartLength)) {
+			wordList.emplace_back(*elem, wordlen);
+		}
+	}
+	return wordList;
+}
+
+}
+
+void StringList::SetFromListText() {
+	sorted = false;
+	sortedNoCase = false;
+	words = ArrayFromStringList(listText.data(), onlyLineEnds);
+	wordsNoCase = words;
+}
+
+void StringList::SortIfNeeded(bool ignoreCase) {
+	// In both cases, the final empty sentinel element is not sorted.
+	if (ignoreCase) {
+		if (!sortedNoCase) {
+			sortedNoCase = true;
+			std::sort(wordsNoCase.begin(), wordsNoCase.end(), CmpStringNoCase);
+		}
+	} else {
+		if (!sorted) {
+			sorted = true;
+			std::sort(words.begin(), words.end(), CmpString);
+		}
+	}
+}
+
+void StringList::Clear() noexcept {
+	words.clear();
+	wordsNoCase.clear();
+	listText.clear();
+	sorted = false;
+	sortedNoCase = false;
+}
+
+void StringList::Set(const char *s) {
+	listText.assign(s, s+strlen(s)+1);
+	SetFromListText();
+}
+
+void StringList::Set(const std::vector<char> &data) {
+	listText.assign(data.begin(), data.end());
+	listText.push_back('\0');
+	SetFromListText();
+}
+
+bool StringList::Set(const std::vector<char> &data, std::string_view index) {
+	listText.assign(data.begin(), data.end());
+	listText.push_back('\0');
+	if (!index.starts_with(indexMagic)) {
+		SetFromListText();
+		return false;
+	}
+	index.remove_prefix(indexMagic.length());
+	const size_t count = (index.length() >= 2 * indexNumberSize) ? IndexNumberAt(index, indexNumberSize) : 0;
+	if ((index.length() != (2 + count * 3) * indexNumberSize) || (IndexNumberAt(index, 0) != data.size())) {
+		SetFromListText();
+		return false;
+	}
+
+	// Check every word lies between separators so terminating them can not go astray
+	const size_t lengthText = data.size();
+	const size_t startWords = 2 * indexNumberSize;
+	for (size_t word = 0; word < count; word++) {
+		const size_t offset = IndexNumberAt(index, startWords + word * 2 * indexNumberSize);
+		const size_t length = IndexNumberAt(index, startWords + (word * 2 + 1) * indexNumberSize);
+		if ((length == 0) || (offset >= lengthText) || (length > lengthText - offset) ||
+			((offset > 0) && !IsWordSeparator(listText[offset - 1], onlyLineEnds)) ||
+			!IsWordSeparator(listText[offset + length], onlyLineEnds)) {
+			SetFromListText();
+			return false;
+		}
+	}
+	const size_t startNoCase = startWords + count * 2 * indexNumberSize;
+	for (size_t word = 0; word < count; word++) {
+		const size_t offset = IndexNumberAt(index, startNoCase + word * indexNumberSize);
+		if ((offset >= lengthText) || ((offset > 0) && !IsWordSeparator(listText[offset - 1], onlyLineEnds))) {
+			SetFromListText();
+			return false;
+		}
+	}
+
+	words.resize(count);
+	for (size_t word = 0; word < count; word++) {
+		const size_t offset = IndexNumberAt(index, startWords + word * 2 * indexNumberSize);
+		const size_t length = IndexNumberAt(index, startWords + (word * 2 + 1) * indexNumberSize);
+		listText[offset + length] = '\0';
+		words[word] = listText.data() + offset;
+	}
+	wordsNoCase.resize(count);
+	for (size_t word = 0; word < count; word++) {
+		wordsNoCase[word] = listText.data() + IndexNumberAt(index, startNoCase + word * indexNumberSize);
+	}
+	sorted = true;
+	sortedNoCase = true;
+	return true;
+}
+
+std::string StringList::CompiledIndex() {
+	if (listText.size() > UINT32_MAX) {
+		return {};
+	}
+	SortIfNeeded(false);
+	SortIfNeeded(true);
+	std::string index(indexMagic);
+	index.reserve(index.length() + (2 + words.size() * 3) * indexNumberSize);
+	AppendIndexNumber(index, listText.size() - 1);
+	AppendIndexNumber(index, words.size());
+	for (const char *word : words) {
+		AppendIndexNumber(index, word - listText.data());
+		AppendIndexNumber(index, strlen(word));
+	}
+	for (const char *word : wordsNoCase) {
+		AppendIndexNumber(index, word - listText.data());
+	}
+	return index;
+}
+
+/**
+ * Returns an element (complete) of the StringList array which has
+ * the same beginning as the passed string.
+ * The length of the word to compare is passed too.
+ * Letter case can be ignored or preserved.
+ */
+std::string StringList::GetNearestWord(const char *wordStart, size_t searchLen, bool ignoreCase, const std::string &wordCharacters, ptrdiff_t wordIndex) {
+	if (words.empty())
+		return std::string();
+	SortIfNeeded(ignoreCase);
+	if (ignoreCase) {
+		return GetMatch(wordsNoCase.begin(), wordsNoCase.end(), wordStart, wordCharacters, wordIndex, CompareStringInsensitive(searchLen));
+	} else { // preserve the letter case
+		return GetMatch(words.begin(), words.end(), wordStart, wordCharacters, wordIndex, CompareString(searchLen));
+	}
+}
+
+/**
+ * Returns elements (first words of them) of the StringList array which have
+ * the same beginning as the passed string.
+ * The length of the word to compare is passed too.
+ * Letter case can be ignored or preserved (default).
+ * If there are more words meeting the condition they are returned all of
+ * them in the ascending order separated with spaces.
+ */
+StringVector StringList::GetNearestWords(
+	const char *wordStart,
+	size_t searchLen,
+	bool ignoreCase,
+	char otherSeparator /*= '\0'*/,
+	bool exactLen /*=false*/) {
+
+	if (words.empty())
+		return {};
+	SortIfNeeded(ignoreCase);
+	if (ignoreCase) {
+		return GetMatches(wordsNoCase.begin(), wordsNoCase.end(), wordStart, otherSeparator, exactLen, CompareStringInsensitive(searchLen));
+	} else {
+		// Preserve the letter case
+		return GetMatches(words.begin(), words.end(), wordStart, otherSeparator, exactLen, CompareString(searchLen));
+	}
+}
+
+bool AutoCompleteWordList::Add(const std::string& word) {
+	const auto [_, ok] = words.insert(word);
+	if (ok) {
+		const size_t length = word.length();
+		totalLength += 1 + length;
+		minWordLength = std::min(minWordLength, length);
+		return true;
+	}
+	return ok;
+}
+
+std::string AutoCompleteWordList::Sorted(bool ignoreCase) const {
+	std::vector<std::string> wv(words.begin(), words.end());
+	if (ignoreCase) {
+		std::ranges::sort(wv,
+			[](const std::string &a, const std::string &b) noexcept -> bool {
+				return CmpStringNoCase(a.c_str(), b.c_str());
+			});
+	}
+	std::string result;
+	if (totalLength) {
+		for (const std::string &word : wv) {
+			if (!result.empty())
+				result.push_back('\n');
+			result.append(word);
+		}
+	}
+	return result;
+}
+
+namespace {
+
+int CompareUpper(char a, char b) noexcept {
+	return static_cast<unsigned char>(MakeUpperCase(a)) - static_cast<unsigned char>(MakeUpperCase(b));
+}
+
+}
+
+bool WordIndex::WordOrder::operator()(std::string_view a, std::string_view b) const noexcept {
+	const size_t common = std::min(a.length(), b.length());
+	for (size_t i = 0; i < common; i++) {
+		const int difference = CompareUpper(a[i], b[i]);
+		if (difference) {
+			return difference < 0;
+		}
+	}
+	if (a.length() != b.length()) {
+		return a.length() < b.length();
+	}
+	return a < b;
+}
+
+WordIndex::WordIndex(const std::string &wordCharacters_, bool building_) :
+	wordCharacters(wordCharacters_), building(building_) {
+	for (const char ch : wordCharacters) {
+		isWordCharacter[static_cast<unsigned char>(ch)] = true;
+	}
+}
+
+void WordIndex::Change(Counts &target, std::string_view text, ptrdiff_t delta) {
+	size_t start = 0;
+	while (start < text.length()) {
+		while (start < text.length() && !IsWordCharacter(text[start])) {
+			start++;
+		}
+		size_t end = start;
+		while (end < text.length() && IsWordCharacter(text[end])) {
+			end++;
+		}
+		// Single characters are never offered as they must be longer than the typed prefix
+		if (end - start > 1) {
+			const std::string_view word = text.substr(start, end - start);
+			Counts::iterator it = target.find(word);
+			if (it == target.end()) {
+				it = target.emplace(word, 0).first;
+			}
+			it->second += delta;
+			if (it->second == 0) {
+				target.erase(it);
+			}
+		}
+		start = end;
+	}
+}
+
+void WordIndex::Update(std::string_view text, ptrdiff_t delta) {
+	Change(building ? pending : counts, text, delta);
+}
+
+void WordIndex::Clear() noexcept {
+	counts.clear();
+	pending.clear();
+	clearedWhileBuilding = building;
+}
+
+void WordIndex::Complete(WordIndex &&built) {
+	if (!clearedWhileBuilding) {
+		counts = std::move(built.counts);
+	}
+	for (const auto &[word, delta] : pending) {
+		Counts::iterator it = counts.find(word);
+		if (it == counts.end()) {
+			it = counts.emplace(word, 0).first;
+		}
+		it->second += delta;
+		if (it->second <= 0) {
+			counts.erase(it);
+		}
+	}
+	pending.clear();
+	building = false;
+	clearedWhileBuilding = false;
+}
+
+void WordIndex::AddMatches(AutoCompleteWordList &wordList, std::string_view root, bool ignoreCase,
+	std::string_view excluded, size_t limit) const {
+	for (Counts::const_iterator it = counts.lower_bound(root); it != counts.end(); ++it) {
+		const std::string &word = it->first;
+		if ((word.length() < root.length()) ||
+			!std::equal(root.begin(), root.end(), word.begin(),
+				[](char a, char b) noexcept { return CompareUpper(a, b) == 0; })) {
+			break;
+		}
+		if ((word.length() == root.length()) || (!ignoreCase && !word.starts_with(root))) {
+			continue;
+		}
+		const ptrdiff_t occurrences = it->second - ((word == excluded) ? 1 : 0);
+		if (occurrences > 0) {
+			wordList.Add(word);
+			if (wordList.Count() >= limit) {
+				return;
+			}
+		}
+	}
+}
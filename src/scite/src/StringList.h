@@ -1,55 +1,112 @@
-// SciTE - Scintilla based Text Editor
-/** @file StringList.h
- ** Definition of class holding a list of strings.
- **/
-// Copyright 1998-2005 by Neil Hodgson <neilh@scintilla.org>
-// The License.txt file describes the conditions under which this software may be distributed.
-
-#ifndef STRINGLIST_H
-#define STRINGLIST_H
-
-using StringVector = std::vector<std::string>;
-
-class StringList {
-	// Text pointed into by words and wordsNoCase
-	std::string listText;
-	// Each word contains at least one character.
-	std::vector<char *> words;
-	std::vector<char *> wordsNoCase;
-	bool onlyLineEnds;	///< Delimited by any white space or only line ends
-	bool sorted;
-	bool sortedNoCase;
-	void SetFromListText();
-	void SortIfNeeded(bool ignoreCase);
-public:
-	explicit StringList(bool onlyLineEnds_ = false) :
-		words(0), wordsNoCase(0), onlyLineEnds(onlyLineEnds_),
-		sorted(false), sortedNoCase(false) {}
-	size_t Length() const noexcept { return words.size(); }
-	operator bool() const noexcept { return !words.empty(); }
-	char *operator[](size_t ind) noexcept { return words[ind]; }
-	void Clear() noexcept;
-	void Set(const char *s);
-	void Set(const std::vector<char> &data);
-	std::string GetNearestWord(const char *wordStart, size_t searchLen,
-				   bool ignoreCase, const std::string &wordCharacters, ptrdiff_t wordIndex);
-	StringVector GetNearestWords(const char *wordStart, size_t searchLen,
-				    bool ignoreCase, char otherSeparator='\0', bool exactLen=false);
-};
-
-class AutoCompleteWordList {
-	std::set<std::string> words;
-	size_t totalLength = 0;
-	size_t minWordLength = SIZE_MAX;
-public:
-	size_t Count() const noexcept {
-		return words.size();
-	}
-	size_t MinWordLength() const noexcept {
-		return minWordLength;
-	}
-	bool Add(const std::string& word);
-	std::string Sorted(bool ignoreCase) const;
-};
-
-#endif
+// SciTE - Scintilla based Text Editor
+/** @file StringList.h
+ ** Definition of class holding a list of strings.
+ **/
+// Copyright 1998-2005 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef STRINGLIST_H
+#define STRINGLIST_H
+
+using StringVector = std::vector<std::string>;
+
+class StringList {
+	// Text pointed into by words and wordsNoCase. A vector so moving keeps the pointers valid.
+	std::vector<char> listText;
+	// Each word contains at least one character.
+	std::vector<char *> words;
+	std::vector<char *> wordsNoCase;
+	bool onlyLineEnds;	///< Delimited by any white space or only line ends
+	bool sorted;
+	bool sortedNoCase;
+	void SetFromListText();
+	void SortIfNeeded(bool ignoreCase);
+public:
+	explicit StringList(bool onlyLineEnds_ = false) :
+		words(0), wordsNoCase(0), onlyLineEnds(onlyLineEnds_),
+		sorted(false), sortedNoCase(false) {}
+	// Words point into listText so copying is not allowed
+	StringList(const StringList &) = delete;
+	StringList(StringList &&) noexcept = default;
+	StringList &operator=(const StringList &) = delete;
+	StringList &operator=(StringList &&) noexcept = default;
+	~StringList() = default;
+	size_t Length() const noexcept { return words.size(); }
+	operator bool() const noexcept { return !words.empty(); }
+	char *operator[](size_t ind) noexcept { return words[ind]; }
+	void Clear() noexcept;
+	void Set(const char *s);
+	void Set(const std::vector<char> &data);
+	/// Set from data using the word positions and orders from CompiledIndex instead of
+	/// splitting and sorting. Falls back to Set(data) and returns false if index does not fit data.
+	bool Set(const std::vector<char> &data, std::string_view index);
+	/// Both sorted orders of the words so they can be stored and given back to Set.
+	std::string CompiledIndex();
+	std::string GetNearestWord(const char *wordStart, size_t searchLen,
+				   bool ignoreCase, const std::string &wordCharacters, ptrdiff_t wordIndex);
+	StringVector GetNearestWords(const char *wordStart, size_t searchLen,
+				    bool ignoreCase, char otherSeparator='\0', bool exactLen=false);
+};
+
+class AutoCompleteWordList {
+	std::set<std::string> words;
+	size_t totalLength = 0;
+	size_t minWordLength = SIZE_MAX;
+public:
+	size_t Count() const noexcept {
+		return words.size();
+	}
+	size_t MinWordLength() const noexcept {
+		return minWordLength;
+	}
+	bool Add(const std::string& word);
+	std::string Sorted(bool ignoreCase) const;
+};
+
+// Counts of the words in a document so autocompletion can find those starting with a prefix
+// without searching the document. Updated by removing the words around a change before it
+// is made then adding the words around it afterwards.
+// While the counts are built from a copy of the document, changes accumulate in pending.
+
+class WordIndex {
+public:
+	// Ignoring case then by case so the words starting with a prefix are together in either mode
+	struct WordOrder {
+		using is_transparent = void;
+		bool operator()(std::string_view a, std::string_view b) const noexcept;
+	};
+	using Counts = std::map<std::string, ptrdiff_t, WordOrder>;
+private:
+	std::string wordCharacters;
+	bool isWordCharacter[256] {};
+	Counts counts;
+	Counts pending;
+	bool building = false;
+	bool clearedWhileBuilding = false;
+	void Change(Counts &target, std::string_view text, ptrdiff_t delta);
+public:
+	explicit WordIndex(const std::string &wordCharacters_, bool building_=false);
+	const std::string &WordCharacters() const noexcept {
+		return wordCharacters;
+	}
+	bool IsWordCharacter(char ch) const noexcept {
+		return isWordCharacter[static_cast<unsigned char>(ch)];
+	}
+	bool Building() const noexcept {
+		return building;
+	}
+	size_t Count() const noexcept {
+		return counts.size();
+	}
+	/// Add delta to the count of each word in text.
+	void Update(std::string_view text, ptrdiff_t delta);
+	void Clear() noexcept;
+	/// Take the counts from an index built from a copy of the document then apply pending changes.
+	void Complete(WordIndex &&built);
+	/// Add the words that start with root and are longer than it, up to a total of limit words.
+	/// excluded is the word being typed so one occurrence of it is not counted.
+	void AddMatches(AutoCompleteWordList &wordList, std::string_view root, bool ignoreCase,
+		std::string_view excluded, size_t limit) const;
+};
+
+#endif
@@ -0,0 +1,45 @@
+/** @file GUIForTests.cxx
+ ** Minimal platform functions needed by the tested files.
+ ** Only handles ASCII text which is all the tests use.
+ **/
+
+#include <cstddef>
+
+#include <string>
+#include <string_view>
+#include <chrono>
+
+#include "GUI.h"
+
+namespace GUI {
+
+gui_string StringFromUTF8(const char *s) {
+	return StringFromUTF8(std::string_view(s ? s : ""));
+}
+
+gui_string StringFromUTF8(const std::string &s) {
+	return StringFromUTF8(std::string_view(s));
+}
+
+gui_string StringFromUTF8(std::string_view sv) {
+	return gui_string(sv.begin(), sv.end());
+}
+
+std::string UTF8FromString(gui_string_view sv) {
+	std::string s;
+	for (const gui_char ch : sv) {
+		s.push_back(static_cast<char>(ch));
+	}
+	return s;
+}
+
+std::string LowerCaseUTF8(std::string_view sv) {
+	std::string s(sv);
+	for (char &ch : s) {
+		if (ch >= 'A' && ch <= 'Z')
+			ch = static_cast<char>(ch - 'A' + 'a');
+	}
+	return s;
+}
+
+}
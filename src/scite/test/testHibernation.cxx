@@ -0,0 +1,241 @@
+/** @file testHibernation.cxx
+ ** Unit Tests for SciTE internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <ctime>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+
+#include "GUI.h"
+#include "FilePath.h"
+#include "PropSetFile.h"
+#include "Hibernation.h"
+
+#include "catch.hpp"
+
+namespace {
+
+constexpr time_t delay = 60;
+constexpr time_t start = 1'000'000;
+
+// A buffer that was last current at start
+IdleBuffer Idle() {
+	IdleBuffer buffer;
+	buffer.hasDocument = true;
+	buffer.activeTime = start;
+	return buffer;
+}
+
+void WriteFile(const FilePath &file, std::string_view text) {
+	FileHolder fp(file.Open(GUI_TEXT("wb")));
+	REQUIRE(fp);
+	REQUIRE(fwrite(text.data(), 1, text.length(), fp.get()) == text.length());
+}
+
+// Lines read from the text given to SCI_SETCONTRACTEDFOLDS in the same way as Editor::SetContractedFolds
+std::vector<intptr_t> ContractedFoldsLines(const std::string &text) {
+	std::vector<intptr_t> lines;
+	const char *s = text.c_str();
+	while (*s) {
+		if ((*s >= '0') && (*s <= '9')) {
+			char *end = nullptr;
+			lines.push_back(std::strtoll(s, &end, 10));
+			s = end;
+		} else {
+			s++;
+		}
+	}
+	return lines;
+}
+
+}
+
+TEST_CASE("Hibernation") {
+
+	SECTION("Threshold") {
+		const IdleBuffer buffer = Idle();
+		REQUIRE(ChooseIdleAction(buffer, start, delay) == IdleAction::none);
+		REQUIRE(ChooseIdleAction(buffer, start + delay - 1, delay) == IdleAction::none);
+		// Must be idle for longer than the delay
+		REQUIRE(ChooseIdleAction(buffer, start + delay, delay) == IdleAction::none);
+		REQUIRE(ChooseIdleAction(buffer, start + delay + 1, delay) == IdleAction::hibernate);
+	}
+
+	SECTION("StartIdle") {
+		// Buffers never seen idle start timing rather than hibernating at once
+		IdleBuffer buffer = Idle();
+		buffer.activeTime = 0;
+		REQUIRE(ChooseIdleAction(buffer, start, delay) == IdleAction::startIdle);
+		buffer.activeTime = start;
+		REQUIRE(ChooseIdleAction(buffer, start + delay, delay) == IdleAction::none);
+	}
+
+	SECTION("Ineligible") {
+		const time_t later = start + delay * 10;
+		IdleBuffer buffer = Idle();
+		buffer.current = true;
+		REQUIRE(ChooseIdleAction(buffer, later, delay) == IdleAction::none);
+
+		buffer = Idle();
+		buffer.hasDocument = false;
+		REQUIRE(ChooseIdleAction(buffer, later, delay) == IdleAction::none);
+
+		buffer = Idle();
+		buffer.busy = true;
+		REQUIRE(ChooseIdleAction(buffer, later, delay) == IdleAction::none);
+
+		// Already hibernating in any way
+		for (const Hibernation hibernation : { Hibernation::compressed, Hibernation::released, Hibernation::unloaded }) {
+			buffer = Idle();
+			buffer.hibernation = hibernation;
+			REQUIRE(ChooseIdleAction(buffer, later, delay) == IdleAction::none);
+		}
+		// Even when not yet timed
+		buffer.activeTime = 0;
+		REQUIRE(ChooseIdleAction(buffer, later, delay) == IdleAction::none);
+	}
+
+	SECTION("ReleaseOrCompress") {
+		REQUIRE(HibernationFor(false, false, false) == Hibernation::released);
+		// Changes are only in the document so it is compressed
+		REQUIRE(HibernationFor(true, false, false) == Hibernation::compressed);
+		REQUIRE(HibernationFor(false, true, false) == Hibernation::compressed);
+		// Reading the file again would not give the text that is shown
+		REQUIRE(HibernationFor(false, false, true) == Hibernation::compressed);
+		REQUIRE(HibernationFor(true, true, true) == Hibernation::compressed);
+	}
+
+	SECTION("Wake") {
+		WakeSteps steps = StepsToWake(Hibernation::none);
+		REQUIRE(!steps.readFile);
+		REQUIRE(!steps.notifyOpen);
+
+		// Scintilla wakes compressed documents with their text and undo history
+		steps = StepsToWake(Hibernation::compressed);
+		REQUIRE(!steps.readFile);
+		REQUIRE(!steps.readOnlyFromProperties);
+		REQUIRE(!steps.keepEncoding);
+		REQUIRE(!steps.notifyOpen);
+
+		// Released buffers are read again as they were so keep their encoding
+		// and are not opened again for extensions
+		steps = StepsToWake(Hibernation::released);
+		REQUIRE(steps.readFile);
+		REQUIRE(!steps.readOnlyFromProperties);
+		REQUIRE(steps.keepEncoding);
+		REQUIRE(!steps.notifyOpen);
+
+		// Unloaded buffers from a session are read for the first time
+		steps = StepsToWake(Hibernation::unloaded);
+		REQUIRE(steps.readFile);
+		REQUIRE(steps.readOnlyFromProperties);
+		REQUIRE(!steps.keepEncoding);
+		REQUIRE(steps.notifyOpen);
+	}
+
+	SECTION("ReleasedReadsSameText") {
+		// A released buffer is read again from its file so that must still hold the text
+		// it was released with and the file's time shows when it does not.
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / "SciTETestHibernation.txt";
+		const std::string text = "line 1\nline 2\n\tline 3\n";
+		const FilePath file(path.native());
+		WriteFile(file, text);
+		const time_t fileModTime = file.ModifiedTime();
+
+		bool changedOnDisk = file.ModifiedTime() != fileModTime;
+		REQUIRE(HibernationFor(false, false, changedOnDisk) == Hibernation::released);
+		REQUIRE(file.Read() == text);
+
+		// Changed by another application while released
+		WriteFile(file, "other\n");
+		std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(10));
+		changedOnDisk = file.ModifiedTime() != fileModTime;
+		REQUIRE(changedOnDisk);
+		REQUIRE(HibernationFor(false, false, changedOnDisk) == Hibernation::compressed);
+
+		std::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("LazySession") {
+
+	SECTION("SessionLines") {
+		// Saved as 1-based
+		REQUIRE(LinesFromString("").empty());
+		REQUIRE(LinesFromString("1") == std::vector<intptr_t>{ 0 });
+		REQUIRE(LinesFromString("1,5,12") == std::vector<intptr_t>{ 0, 4, 11 });
+		REQUIRE(StringFromLines({}).empty());
+		REQUIRE(StringFromLines({ 0, 4, 11 }) == "1,5,12");
+		const std::vector<intptr_t> lines{ 2, 3, 100, 65535 };
+		REQUIRE(LinesFromString(StringFromLines(lines)) == lines);
+	}
+
+	SECTION("ContractedFolds") {
+		REQUIRE(ContractedFoldsText({}).empty());
+		REQUIRE(ContractedFoldsText({ 2, 5 }) == "2 5 ");
+		const std::vector<intptr_t> folds{ 0, 7, 1200 };
+		REQUIRE(ContractedFoldsLines(ContractedFoldsText(folds)) == folds);
+	}
+
+	SECTION("Prefetch") {
+		//                               0      1     2      3     4     5
+		const std::vector<bool> waiting{ false, true, false, true, true, true };
+		REQUIRE(PrefetchCandidates(waiting, 0, 3) == std::vector<int>{ 1, 3 });
+		REQUIRE(PrefetchCandidates(waiting, 0, 5) == std::vector<int>{ 1, 3, 4, 5 });
+		// Only buffers after the current one
+		REQUIRE(PrefetchCandidates(waiting, 3, 1) == std::vector<int>{ 4 });
+		// Limited to the buffers there are
+		REQUIRE(PrefetchCandidates(waiting, 2, 100) == std::vector<int>{ 3, 4, 5 });
+		REQUIRE(PrefetchCandidates(waiting, 5, 3).empty());
+		// Turned off
+		REQUIRE(PrefetchCandidates(waiting, 0, 0).empty());
+		REQUIRE(PrefetchCandidates(waiting, 0, -1).empty());
+	}
+
+	SECTION("DeferredBuffer") {
+		// A buffer saved in a session and restored unloaded keeps its position, folds and bookmarks
+		// until read so is then shown as it was saved.
+		const intptr_t position = 1234;
+		const intptr_t scroll = 40;
+		const std::vector<intptr_t> folds{ 10, 52, 300 };
+		const std::vector<intptr_t> bookmarks{ 0, 60 };
+		const std::vector<intptr_t> userBookmarks{ 61 };
+		// Written as SaveSessionFile does
+		std::string session = "buffer.1.path=/tmp/a.cxx\n";
+		session += "buffer.1.position=" + std::to_string(position + 1) + "\n";
+		session += "buffer.1.scroll=" + std::to_string(scroll) + "\n";
+		session += "buffer.1.current=1\n";
+		session += "buffer.1.bookmarks=" + StringFromLines(bookmarks) + "\n";
+		session += "buffer.1.userBookmarks=" + StringFromLines(userBookmarks) + "\n";
+		session += "buffer.1.folds=" + StringFromLines(folds) + "\n";
+
+		PropSetFile propsSession;
+		propsSession.ReadFromMemory(session, FilePath(), ImportFilter(), nullptr, 0);
+		// Read as RestoreSession does
+		REQUIRE(propsSession.GetInteger("buffer.1.position") - 1 == position);
+		REQUIRE(propsSession.GetInteger("buffer.1.scroll") == scroll);
+		REQUIRE(LinesFromString(propsSession.GetString("buffer.1.bookmarks")) == bookmarks);
+		REQUIRE(LinesFromString(propsSession.GetString("buffer.1.userBookmarks")) == userBookmarks);
+		const std::vector<intptr_t> foldState = LinesFromString(propsSession.GetString("buffer.1.folds"));
+		REQUIRE(foldState == folds);
+
+		// When shown the file is read for the first time, then the folds are contracted together
+		const WakeSteps steps = StepsToWake(Hibernation::unloaded);
+		REQUIRE(steps.readFile);
+		REQUIRE(steps.notifyOpen);
+		REQUIRE(ContractedFoldsLines(ContractedFoldsText(foldState)) == folds);
+	}
+}
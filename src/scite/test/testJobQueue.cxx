@@ -0,0 +1,128 @@
+/** @file testJobQueue.cxx
+ ** Unit Tests for SciTE internal data structures
+ **/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+
+#include "GUI.h"
+#include "FilePath.h"
+#include "PropSetFile.h"
+#include "JobQueue.h"
+
+#include "catch.hpp"
+
+using namespace std::literals;
+
+TEST_CASE("JobOutput") {
+
+	SECTION("Unprefixed") {
+		// Output of a job run on its own passes through unchanged
+		JobOutput output;
+		REQUIRE(!output.Prefixed());
+		REQUIRE(output.Lines("abc") == "abc");
+		REQUIRE(output.Lines("def\nghi") == "def\nghi");
+		REQUIRE(output.Finish().empty());
+		REQUIRE(output.Message("make") == ">make\n");
+	}
+
+	SECTION("Lines") {
+		JobOutput output(3);
+		REQUIRE(output.Prefixed());
+		REQUIRE(output.Prefix() == "[3] ");
+		REQUIRE(output.Message("make") == ">[3] make\n");
+		REQUIRE(output.Lines("one\ntwo\n") == "[3] one\n[3] two\n");
+		// Partial lines are held until their end arrives
+		REQUIRE(output.Lines("thr").empty());
+		REQUIRE(output.Lines("ee").empty());
+		REQUIRE(output.Lines("\nfo") == "[3] three\n");
+		REQUIRE(output.Lines("ur\r\nfi") == "[3] four\r\n");
+		REQUIRE(output.Lines("\n") == "[3] fi\n");
+		REQUIRE(output.Lines("").empty());
+		REQUIRE(output.Finish().empty());
+	}
+
+	SECTION("Finish") {
+		JobOutput output(12);
+		REQUIRE(output.Lines("last line without end").empty());
+		REQUIRE(output.Finish() == "[12] last line without end\n");
+		// Only finished once
+		REQUIRE(output.Finish().empty());
+	}
+}
+
+TEST_CASE("RemoveJobPrefix") {
+	REQUIRE(RemoveJobPrefix("[1] make") == "make");
+	REQUIRE(RemoveJobPrefix("[123] x.c:1: error") == "x.c:1: error");
+	REQUIRE(RemoveJobPrefix("[1] ") == "");
+	// Not job prefixes
+	REQUIRE(RemoveJobPrefix("make") == "make");
+	REQUIRE(RemoveJobPrefix("") == "");
+	REQUIRE(RemoveJobPrefix("[] make") == "[] make");
+	REQUIRE(RemoveJobPrefix("[x] make") == "[x] make");
+	REQUIRE(RemoveJobPrefix("[1]make") == "[1]make");
+	REQUIRE(RemoveJobPrefix("[1") == "[1");
+	REQUIRE(RemoveJobPrefix(" [1] make") == " [1] make");
+	// Only one prefix is removed
+	REQUIRE(RemoveJobPrefix("[1] [2] make") == "[2] make");
+}
+
+TEST_CASE("JobQueue") {
+
+	const FilePath directory;
+
+	SECTION("GroupEnd") {
+		JobQueue jobQueue;
+		jobQueue.AddCommand("a", directory, JobSubsystem::cli, "", jobParallel);
+		jobQueue.AddCommand("b", directory, JobSubsystem::cli, "", jobParallel);
+		jobQueue.AddCommand("c", directory, JobSubsystem::cli, "", 0);
+		jobQueue.AddCommand("d", directory, JobSubsystem::cli, "", jobParallel);
+		// A parallel job that is not a console command runs on its own
+		jobQueue.AddCommand("e", directory, JobSubsystem::gui, "", jobParallel);
+		jobQueue.AddCommand("f", directory, JobSubsystem::cli, "", jobParallel);
+		jobQueue.AddCommand("g", directory, JobSubsystem::cli, "", jobParallel);
+		jobQueue.AddCommand("h", directory, JobSubsystem::cli, "", jobParallel);
+		REQUIRE(jobQueue.GroupEnd(0) == 2);
+		REQUIRE(jobQueue.GroupEnd(1) == 2);
+		REQUIRE(jobQueue.GroupEnd(2) == 3);
+		REQUIRE(jobQueue.GroupEnd(3) == 4);
+		REQUIRE(jobQueue.GroupEnd(4) == 5);
+		// Group reaches the end of the queue
+		REQUIRE(jobQueue.GroupEnd(5) == 8);
+
+		// Running one at a time makes each job its own group
+		jobQueue.parallelMax = 1;
+		REQUIRE(jobQueue.GroupEnd(0) == 1);
+		REQUIRE(jobQueue.GroupEnd(5) == 6);
+	}
+
+	SECTION("GroupEndFullQueue") {
+		JobQueue jobQueue;
+		for (size_t job = 0; job < JobQueue::commandMax + 2; job++) {
+			jobQueue.AddCommand("a", directory, JobSubsystem::cli, "", jobParallel);
+		}
+		// Commands beyond the maximum are dropped
+		REQUIRE(jobQueue.commandCurrent == JobQueue::commandMax);
+		REQUIRE(jobQueue.GroupEnd(0) == JobQueue::commandMax);
+		REQUIRE(jobQueue.GroupEnd(JobQueue::commandMax - 1) == JobQueue::commandMax);
+
+		jobQueue.ClearJobs();
+		REQUIRE(!jobQueue.HasCommandToRun());
+	}
+}
@@ -0,0 +1,471 @@
+/** @file testPropSetFile.cxx
+ ** Unit Tests for SciTE internal data structures
+ **/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+#include <filesystem>
+
+#include "GUI.h"
+#include "FilePath.h"
+#include "PropSetFile.h"
+
+#include "catch.hpp"
+
+using namespace std::literals;
+
+namespace {
+
+// A directory of properties files in the system temporary directory that is removed afterwards
+class TempDirectory {
+	std::filesystem::path path;
+public:
+	TempDirectory() : path(std::filesystem::temp_directory_path() / "SciTETestPropSetFile") {
+		std::filesystem::remove_all(path);
+		std::filesystem::create_directories(path);
+	}
+	// Deleted so TempDirectory objects can not be copied.
+	TempDirectory(const TempDirectory &) = delete;
+	TempDirectory(TempDirectory &&) = delete;
+	TempDirectory &operator=(const TempDirectory &) = delete;
+	TempDirectory &operator=(TempDirectory &&) = delete;
+	~TempDirectory() {
+		std::error_code ec;
+		std::filesystem::remove_all(path, ec);
+	}
+	[[nodiscard]] FilePath Directory() const {
+		return FilePath(path.native());
+	}
+	[[nodiscard]] FilePath File(std::string_view name) const {
+		return FilePath((path / name).native());
+	}
+	void Write(std::string_view name, std::string_view text) const {
+		std::filesystem::create_directories((path / name).parent_path());
+		FileHolder fp(File(name).Open(GUI_TEXT("wb")));
+		REQUIRE(fp);
+		REQUIRE(fwrite(text.data(), 1, text.length(), fp.get()) == text.length());
+	}
+	// Replace the contents of a file but keep its modification time
+	void Rewrite(std::string_view name, std::string_view text) const {
+		const std::filesystem::file_time_type modified = std::filesystem::last_write_time(path / name);
+		Write(name, text);
+		std::filesystem::last_write_time(path / name, modified);
+	}
+	void Remove(std::string_view name) const {
+		std::filesystem::remove(path / name);
+	}
+};
+
+constexpr std::string_view userProperties = "SciTEUser.properties";
+
+// Read the user properties through the cache then write the cache for the next read.
+// Returns true if the cache was used.
+bool ReadThroughCache(PropSetFile &props, const TempDirectory &dir, const ImportFilter &filter = ImportFilter()) {
+	FilePathSet imports;
+	const bool cached = props.ReadCached(dir.File("props.cache"), dir.File(userProperties),
+		dir.Directory(), filter, &imports);
+	props.WriteCache(dir.File("props.cache"));
+	return cached;
+}
+
+// Read the global properties with 'import *' performed lazily or eagerly
+void ReadGlobal(PropSetFile &props, const TempDirectory &dir, bool lazy) {
+	ImportFilter filter;
+	filter.lazy = lazy;
+	FilePathSet imports;
+	props.Read(dir.File("SciTEGlobal.properties"), dir.Directory(), filter, &imports, 0);
+}
+
+// Language files with a dependency between them and imports depending on 'if' and 'match'
+void WriteLanguages(const TempDirectory &dir) {
+	dir.Write("SciTEGlobal.properties", "import *\n");
+	dir.Write("cpp.properties",
+		"file.patterns.cpp=*.c;*.cxx\n"
+		"lexer.$(file.patterns.cpp)=cpp\n"
+		"keywords.$(file.patterns.cpp)=int char\n"
+		"comment.block.cpp=//~\n"
+		"import sub/cppshared\n"
+		"if PLAT_TEST\n"
+		"\tcpp.test=on\n"
+		"match src/*\n"
+		"\tcpp.src=on\n"
+		"if asm.inline\n"
+		"\tcpp.inline=on\n");
+	dir.Write("sub/cppshared.properties", "cpp.shared=on\n");
+	dir.Write("python.properties",
+		"file.patterns.py=*.py\n"
+		"lexer.$(file.patterns.py)=python\n"
+		"keywords.$(file.patterns.py)=def class\n");
+	// Uses a variable defined by cpp.properties and defines one tested by cpp.properties
+	dir.Write("asm.properties",
+		"lexer.*.asm=asm\n"
+		"comment.block.asm=$(comment.block.cpp)asm\n"
+		"asm.inline=1\n");
+}
+
+// All the keys and values of a property set in one string for comparisons
+std::string AllProperties(const PropSetFile &props) {
+	std::string all;
+	const char *key = nullptr;
+	const char *val = nullptr;
+	bool more = props.GetFirst(key, val);
+	while (more) {
+		all += key;
+		all += '=';
+		all += val;
+		all += '\n';
+		more = props.GetNext(key, val);
+	}
+	return all;
+}
+
+}
+
+TEST_CASE("PropSetFile") {
+
+	SECTION("GetWild") {
+		PropSetFile props;
+		props.Set("lexer.*.cxx", "cpp");
+		props.Set("lexer.*.py", "python");
+		REQUIRE(props.GetWild("lexer.", "x.cxx") == "cpp");
+		REQUIRE(props.GetWild("lexer.", "x.py") == "python");
+		REQUIRE(props.GetWild("lexer.", "x.txt").empty());
+		// Repeated lookups are answered from the cache
+		REQUIRE(props.GetWild("lexer.", "x.cxx") == "cpp");
+	}
+
+	SECTION("ChangedValue") {
+		PropSetFile props;
+		props.Set("command.name.1.*.my file", "Old");
+		REQUIRE(props.GetWild("command.name.1.", "a.my file") == "Old");
+		// Longer value so the string storage is replaced
+		props.Set("command.name.1.*.my file", "A much longer value than fits in the old storage");
+		REQUIRE(props.GetWild("command.name.1.", "a.my file") == "A much longer value than fits in the old storage");
+		props.Unset("command.name.1.*.my file");
+		REQUIRE(props.GetWild("command.name.1.", "a.my file").empty());
+	}
+
+	SECTION("ChangedPattern") {
+		PropSetFile props;
+		props.Set("file.patterns.cpp", "*.cxx");
+		props.Set("lexer.$(file.patterns.cpp)", "cpp");
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "cpp");
+		REQUIRE(props.GetWild("lexer.", "a.cpp").empty());
+		props.Set("file.patterns.cpp", "*.cpp");
+		REQUIRE(props.GetWild("lexer.", "a.cxx").empty());
+		REQUIRE(props.GetWild("lexer.", "a.cpp") == "cpp");
+	}
+
+	SECTION("ChangedBase") {
+		PropSetFile base;
+		PropSetFile props;
+		props.superPS = &base;
+		base.Set("lexer.*.cxx", "cpp");
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "cpp");
+		base.Set("lexer.*.cxx", "cplusplus");
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "cplusplus");
+		props.Set("lexer.*.cxx", "local");
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "local");
+		props.Unset("lexer.*.cxx");
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "cplusplus");
+	}
+
+	SECTION("ManyFiles") {
+		PropSetFile props;
+		props.Set("lexer.*.cxx", "cpp");
+		for (int i = 0; i < 1000; i++) {
+			const std::string name = "f" + std::to_string(i) + ((i % 2) ? ".cxx" : ".txt");
+			REQUIRE(props.GetWild("lexer.", name) == ((i % 2) ? "cpp"sv : ""sv));
+		}
+		REQUIRE(props.GetWild("lexer.", "f1.cxx") == "cpp");
+		props.Set("lexer.*.cxx", "cplusplus");
+		REQUIRE(props.GetWild("lexer.", "f1.cxx") == "cplusplus");
+	}
+}
+
+TEST_CASE("PropSetFileCache") {
+
+	TempDirectory dir;
+
+	SECTION("RoundTrip") {
+		dir.Write(userProperties, "a=1\nb=$(a)2\nimport sub\n");
+		dir.Write("sub.properties", "c=3\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		PropSetFile propsCached;
+		REQUIRE(ReadThroughCache(propsCached, dir));
+		REQUIRE(AllProperties(propsCached) == AllProperties(props));
+		REQUIRE(propsCached.Get("c") == "3");
+		REQUIRE(propsCached.GetExpandedString("b") == "12");
+	}
+
+	SECTION("Imports") {
+		dir.Write(userProperties, "import sub\n");
+		dir.Write("sub.properties", "c=3\n");
+		PropSetFile props;
+		FilePathSet imports;
+		REQUIRE(!props.ReadCached(dir.File("props.cache"), dir.File(userProperties), dir.Directory(),
+			ImportFilter(), &imports));
+		props.WriteCache(dir.File("props.cache"));
+		PropSetFile propsCached;
+		FilePathSet importsCached;
+		REQUIRE(propsCached.ReadCached(dir.File("props.cache"), dir.File(userProperties), dir.Directory(),
+			ImportFilter(), &importsCached));
+		REQUIRE(importsCached == imports);
+		REQUIRE(importsCached.size() == 1);
+	}
+
+	SECTION("EditedSameLengthAndTime") {
+		dir.Write(userProperties, "a=1\nimport sub\n");
+		dir.Write("sub.properties", "c=3\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		// Only the contents differ so the cache has to compare them
+		dir.Rewrite("sub.properties", "c=4\n");
+		PropSetFile propsEdited;
+		REQUIRE(!ReadThroughCache(propsEdited, dir));
+		REQUIRE(propsEdited.Get("c") == "4");
+		PropSetFile propsCached;
+		REQUIRE(ReadThroughCache(propsCached, dir));
+		REQUIRE(propsCached.Get("c") == "4");
+	}
+
+	SECTION("EditedLength") {
+		dir.Write(userProperties, "a=1\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		dir.Write(userProperties, "a=12\n");
+		PropSetFile propsEdited;
+		REQUIRE(!ReadThroughCache(propsEdited, dir));
+		REQUIRE(propsEdited.Get("a") == "12");
+	}
+
+	SECTION("ImportRemoved") {
+		dir.Write(userProperties, "import sub\n");
+		dir.Write("sub.properties", "c=3\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		dir.Remove("sub.properties");
+		PropSetFile propsEdited;
+		REQUIRE(!ReadThroughCache(propsEdited, dir));
+		REQUIRE(!propsEdited.Exists("c"));
+	}
+
+	SECTION("DirectoryListing") {
+		dir.Write(userProperties, "import *\n");
+		dir.Write("x.properties", "x=1\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		PropSetFile propsCached;
+		REQUIRE(ReadThroughCache(propsCached, dir));
+		REQUIRE(propsCached.Get("x") == "1");
+		// A new properties file is imported by 'import *'
+		dir.Write("y.properties", "y=2\n");
+		PropSetFile propsAdded;
+		REQUIRE(!ReadThroughCache(propsAdded, dir));
+		REQUIRE(propsAdded.Get("y") == "2");
+		// Other files do not matter
+		dir.Write("notes.txt", "y=3\n");
+		PropSetFile propsOther;
+		REQUIRE(ReadThroughCache(propsOther, dir));
+		REQUIRE(propsOther.Get("y") == "2");
+	}
+
+	SECTION("Dependency") {
+		dir.Write(userProperties, "if PLAT_TEST\n\tp=on\n");
+		PropSetFile base;
+		base.Set("PLAT_TEST", "1");
+		PropSetFile props;
+		props.superPS = &base;
+		REQUIRE(!ReadThroughCache(props, dir));
+		REQUIRE(props.Get("p") == "on");
+		PropSetFile propsCached;
+		propsCached.superPS = &base;
+		REQUIRE(ReadThroughCache(propsCached, dir));
+		REQUIRE(propsCached.Get("p") == "on");
+		base.Set("PLAT_TEST", "0");
+		PropSetFile propsChanged;
+		propsChanged.superPS = &base;
+		REQUIRE(!ReadThroughCache(propsChanged, dir));
+		REQUIRE(!propsChanged.Exists("p"));
+	}
+
+	SECTION("Filter") {
+		dir.Write(userProperties, "import sub\n");
+		dir.Write("sub.properties", "c=3\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		ImportFilter filter;
+		filter.SetFilter("sub", "");
+		PropSetFile propsFiltered;
+		REQUIRE(!ReadThroughCache(propsFiltered, dir, filter));
+		REQUIRE(!propsFiltered.Exists("c"));
+	}
+
+	SECTION("Corrupt") {
+		dir.Write(userProperties, "a=1\nb=2\n");
+		PropSetFile props;
+		REQUIRE(!ReadThroughCache(props, dir));
+		const std::string cache = dir.File("props.cache").Read();
+		REQUIRE(!cache.empty());
+		// Truncated at every length, a flipped byte, and extra bytes at the end
+		std::vector<std::string> corruptions;
+		for (size_t length = 0; length < cache.length(); length++) {
+			corruptions.push_back(cache.substr(0, length));
+		}
+		for (size_t position = 0; position < cache.length(); position++) {
+			std::string flipped = cache;
+			flipped[position] = static_cast<char>(flipped[position] ^ 0x80);
+			corruptions.push_back(flipped);
+		}
+		corruptions.push_back(cache + "x");
+		for (const std::string &corrupt : corruptions) {
+			dir.Write("props.cache", corrupt);
+			PropSetFile propsCorrupt;
+			FilePathSet imports;
+			// A flipped byte inside a stored value may still load but must not crash
+			const bool cached = propsCorrupt.ReadCached(dir.File("props.cache"), dir.File(userProperties),
+				dir.Directory(), ImportFilter(), &imports);
+			if (!cached) {
+				REQUIRE(AllProperties(propsCorrupt) == AllProperties(props));
+			}
+		}
+	}
+}
+
+TEST_CASE("PropSetFileLazy") {
+
+	TempDirectory dir;
+	WriteLanguages(dir);
+	PropSetFile base;
+	base.Set("PLAT_TEST", "1");
+	base.Set("RelativePath", "src/a.cxx");
+
+	SECTION("IndexOnly") {
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		// Index keys are available so the lexer for a file can be found
+		REQUIRE(props.GetWild("lexer.", "a.cxx") == "cpp");
+		REQUIRE(props.GetWild("lexer.", "a.py") == "python");
+		REQUIRE(props.Get("file.patterns.cpp") == "*.c;*.cxx");
+		// Other settings wait until the language is used
+		REQUIRE(props.GetWild("keywords.", "a.cxx").empty());
+		REQUIRE(!props.Exists("comment.block.cpp"));
+		REQUIRE(!props.Exists("cpp.test"));
+		REQUIRE(!props.Exists("cpp.shared"));
+	}
+
+	SECTION("ImportConditionDependency") {
+		// cpp.properties tests asm.inline from asm.properties which is read before it
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		REQUIRE(props.ImportLazy("cpp", ""));
+		REQUIRE(props.Get("asm.inline") == "1");
+		REQUIRE(props.Get("cpp.inline") == "on");
+	}
+
+	SECTION("ImportByLexer") {
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		REQUIRE(props.ImportLazy("cpp", ""));
+		REQUIRE(props.GetWild("keywords.", "a.cxx") == "int char");
+		REQUIRE(props.Get("comment.block.cpp") == "//~");
+		// Explicit imports inside the file are read with it
+		REQUIRE(props.Get("cpp.shared") == "on");
+		// Other languages are not imported
+		REQUIRE(props.GetWild("keywords.", "a.py").empty());
+		// Only imported once
+		REQUIRE(!props.ImportLazy("cpp", ""));
+	}
+
+	SECTION("ImportByFileName") {
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		REQUIRE(!props.ImportLazy("", "a.txt"));
+		REQUIRE(props.ImportLazy("", "a.py"));
+		REQUIRE(props.GetWild("keywords.", "a.py") == "def class");
+		REQUIRE(props.GetWild("keywords.", "a.cxx").empty());
+	}
+
+	SECTION("ImportDependency") {
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		// asm.properties uses comment.block.cpp so cpp.properties is imported first
+		REQUIRE(props.ImportLazy("asm", ""));
+		REQUIRE(props.Get("comment.block.cpp") == "//~");
+		REQUIRE(props.GetExpandedString("comment.block.asm") == "//~asm");
+		REQUIRE(props.GetWild("keywords.", "a.cxx") == "int char");
+	}
+
+	SECTION("ImportConditional") {
+		// 'if' and 'match' are evaluated when the language is imported
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		props.ImportLazy("cpp", "");
+		REQUIRE(props.Get("cpp.test") == "on");
+		REQUIRE(props.Get("cpp.src") == "on");
+
+		PropSetFile baseOff;
+		baseOff.Set("PLAT_TEST", "0");
+		baseOff.Set("RelativePath", "other/a.cxx");
+		PropSetFile propsOff;
+		propsOff.superPS = &baseOff;
+		ReadGlobal(propsOff, dir, true);
+		propsOff.ImportLazy("cpp", "");
+		REQUIRE(propsOff.Get("comment.block.cpp") == "//~");
+		REQUIRE(!propsOff.Exists("cpp.test"));
+		REQUIRE(!propsOff.Exists("cpp.src"));
+	}
+
+	SECTION("SameAsEager") {
+		PropSetFile propsEager;
+		propsEager.superPS = &base;
+		ReadGlobal(propsEager, dir, false);
+		PropSetFile props;
+		props.superPS = &base;
+		ReadGlobal(props, dir, true);
+		REQUIRE(AllProperties(props) != AllProperties(propsEager));
+		for (const std::string_view lexer : { "python", "asm", "cpp" }) {
+			props.ImportLazy(lexer, "");
+		}
+		REQUIRE(AllProperties(props) == AllProperties(propsEager));
+	}
+
+	SECTION("ThroughCache") {
+		ImportFilter filter;
+		filter.lazy = true;
+		FilePathSet imports;
+		const FilePath cacheFile = dir.File("props.cache");
+		PropSetFile props;
+		props.superPS = &base;
+		REQUIRE(!props.ReadCached(cacheFile, dir.File("SciTEGlobal.properties"), dir.Directory(), filter, &imports));
+		props.WriteCache(cacheFile);
+		PropSetFile propsCached;
+		propsCached.superPS = &base;
+		REQUIRE(propsCached.ReadCached(cacheFile, dir.File("SciTEGlobal.properties"), dir.Directory(), filter, &imports));
+		REQUIRE(AllProperties(propsCached) == AllProperties(props));
+		REQUIRE(propsCached.ImportLazy("", "a.cxx"));
+		REQUIRE(propsCached.GetWild("keywords.", "a.cxx") == "int char");
+		REQUIRE(propsCached.Get("cpp.test") == "on");
+	}
+}
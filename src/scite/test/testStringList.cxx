@@ -0,0 +1,247 @@
+/** @file testStringList.cxx
+ ** Unit Tests for SciTE internal data structures
+ **/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <chrono>
+
+#include "GUI.h"
+#include "StringList.h"
+
+#include "catch.hpp"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr std::string_view apiText = "zeta\nAlpha(x)\nalpha\nBeta gamma\r\nbeta\n";
+
+std::vector<char> VectorFromString(std::string_view sv) {
+	return std::vector<char>(sv.begin(), sv.end());
+}
+
+// Layout of CompiledIndex: magic line, text length, word count, offset and length of each
+// word in case-sensitive order, then the offset of each word in case-insensitive order.
+constexpr size_t numberSize = 4;
+constexpr size_t headerLength = "SciTE word index 1\n"sv.length();
+
+void SetIndexNumber(std::string &index, size_t position, size_t value) {
+	for (size_t byte = 0; byte < numberSize; byte++) {
+		index[position + byte] = static_cast<char>(value >> (byte * 8));
+	}
+}
+
+// Check list gives the same matches as a list split and sorted from the text
+void RequireSameMatches(StringList &list, std::string_view text) {
+	StringList expected;
+	expected.Set(VectorFromString(text));
+	REQUIRE(list.Length() == expected.Length());
+	for (const char *root : { "", "a", "Al", "b", "z", "zeta", "q" }) {
+		for (const bool ignoreCase : { false, true }) {
+			REQUIRE(list.GetNearestWords(root, strlen(root), ignoreCase) ==
+				expected.GetNearestWords(root, strlen(root), ignoreCase));
+			REQUIRE(list.GetNearestWords(root, strlen(root), ignoreCase, '(') ==
+				expected.GetNearestWords(root, strlen(root), ignoreCase, '('));
+		}
+	}
+}
+
+}
+
+TEST_CASE("StringList") {
+
+	SECTION("CompiledIndexRoundTrip") {
+		StringList source;
+		source.Set(VectorFromString(apiText));
+		const std::string index = source.CompiledIndex();
+		REQUIRE(index.starts_with("SciTE word index 1\n"));
+
+		StringList list;
+		REQUIRE(list.Set(VectorFromString(apiText), index));
+		RequireSameMatches(list, apiText);
+		// Compiling again gives the same index
+		REQUIRE(list.CompiledIndex() == index);
+	}
+
+	SECTION("CompiledIndexOnlyLineEnds") {
+		StringList source(true);
+		source.Set(VectorFromString(apiText));
+		const std::string index = source.CompiledIndex();
+		StringList list(true);
+		REQUIRE(list.Set(VectorFromString(apiText), index));
+		REQUIRE(list.Length() == source.Length());
+		REQUIRE(list.GetNearestWords("Beta", 4, false) == StringVector{ "Beta gamma" });
+	}
+
+	SECTION("CompiledIndexEmpty") {
+		StringList source;
+		source.Set(VectorFromString(""));
+		const std::string index = source.CompiledIndex();
+		StringList list;
+		REQUIRE(list.Set(VectorFromString(""), index));
+		REQUIRE(!list);
+	}
+
+	SECTION("CompiledIndexCorrupt") {
+		StringList source;
+		source.Set(VectorFromString(apiText));
+		const std::string index = source.CompiledIndex();
+		const size_t firstWord = headerLength + 2 * numberSize;
+		const size_t firstNoCase = firstWord + source.Length() * 2 * numberSize;
+
+		std::vector<std::string> corrupt;
+		// Missing, wrong magic, and truncated
+		corrupt.push_back("");
+		corrupt.push_back("SciTE word index 0\n" + index.substr(headerLength));
+		corrupt.push_back(index.substr(0, index.length() - 1));
+		corrupt.push_back(index.substr(0, headerLength + numberSize));
+		// Extended
+		corrupt.push_back(index + "x");
+		// Text length does not match
+		std::string changed = index;
+		SetIndexNumber(changed, headerLength, apiText.length() + 1);
+		corrupt.push_back(changed);
+		// Word count too large, which would read past the end
+		changed = index;
+		SetIndexNumber(changed, headerLength + numberSize, 0xFFFFFFFF);
+		corrupt.push_back(changed);
+		// Word beyond the text
+		changed = index;
+		SetIndexNumber(changed, firstWord, apiText.length());
+		corrupt.push_back(changed);
+		// Word starting inside another word
+		changed = index;
+		SetIndexNumber(changed, firstWord, 1);
+		corrupt.push_back(changed);
+		// Word ending inside another word
+		changed = index;
+		SetIndexNumber(changed, firstWord + numberSize, 1);
+		corrupt.push_back(changed);
+		// Empty word
+		changed = index;
+		SetIndexNumber(changed, firstWord + numberSize, 0);
+		corrupt.push_back(changed);
+		// Word running past the end of the text
+		changed = index;
+		SetIndexNumber(changed, firstWord + numberSize, 0xFFFFFFFF);
+		corrupt.push_back(changed);
+		// Case-insensitive word beyond the text or inside another word
+		changed = index;
+		SetIndexNumber(changed, firstNoCase, apiText.length() + 10);
+		corrupt.push_back(changed);
+		changed = index;
+		SetIndexNumber(changed, firstNoCase, 2);
+		corrupt.push_back(changed);
+
+		for (const std::string &bad : corrupt) {
+			StringList list;
+			// Falls back to splitting and sorting the text
+			REQUIRE(!list.Set(VectorFromString(apiText), bad));
+			RequireSameMatches(list, apiText);
+		}
+
+		// Index for different text of the same length
+		const std::string_view otherText = "zeta\nAlpha(x)\nalpha\nBetagamma\r\n beta\n";
+		REQUIRE(otherText.length() == apiText.length());
+		StringList other;
+		REQUIRE(!other.Set(VectorFromString(otherText), index));
+		RequireSameMatches(other, otherText);
+	}
+}
+
+namespace {
+
+const std::string wordCharacters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+std::string Matches(const WordIndex &index, std::string_view root, bool ignoreCase,
+	std::string_view excluded = {}, size_t limit = SIZE_MAX) {
+	AutoCompleteWordList wordList;
+	index.AddMatches(wordList, root, ignoreCase, excluded, limit);
+	return wordList.Sorted(false);
+}
+
+}
+
+TEST_CASE("WordIndex") {
+
+	SECTION("Update") {
+		WordIndex index(wordCharacters);
+		index.Update("alpha beta, alpha-gamma x", 1);
+		// Single characters are not counted
+		REQUIRE(index.Count() == 3);
+		REQUIRE(Matches(index, "a", false) == "alpha");
+		index.Update("alpha", -1);
+		REQUIRE(Matches(index, "a", false) == "alpha");
+		index.Update("alpha", -1);
+		REQUIRE(Matches(index, "a", false).empty());
+		REQUIRE(index.Count() == 2);
+		index.Clear();
+		REQUIRE(index.Count() == 0);
+	}
+
+	SECTION("CompleteWithPending") {
+		WordIndex index(wordCharacters, true);
+		REQUIRE(index.Building());
+		// Changes made while building are held until Complete
+		index.Update("delta alpha", 1);
+		index.Update("gamma", -1);
+		REQUIRE(index.Count() == 0);
+
+		WordIndex built(wordCharacters);
+		built.Update("alpha beta gamma", 1);
+		index.Complete(std::move(built));
+		REQUIRE(!index.Building());
+		REQUIRE(index.Count() == 3);
+		REQUIRE(Matches(index, "al", false) == "alpha");
+		REQUIRE(Matches(index, "de", false) == "delta");
+		REQUIRE(Matches(index, "ga", false).empty());
+		// Two occurrences of alpha so excluding the one being typed still offers it
+		REQUIRE(Matches(index, "al", false, "alpha") == "alpha");
+		REQUIRE(Matches(index, "de", false, "delta").empty());
+	}
+
+	SECTION("ClearedWhileBuilding") {
+		WordIndex index(wordCharacters, true);
+		index.Clear();
+		index.Update("omega", 1);
+		WordIndex built(wordCharacters);
+		built.Update("alpha", 1);
+		index.Complete(std::move(built));
+		// The built counts are from text that has been removed
+		REQUIRE(index.Count() == 1);
+		REQUIRE(Matches(index, "o", false) == "omega");
+	}
+
+	SECTION("AddMatchesIgnoreCase") {
+		WordIndex index(wordCharacters);
+		index.Update("Alpha alpha ALPHABET alps al Beta aLtitude", 1);
+		REQUIRE(Matches(index, "al", false) == "alpha\nalps");
+		REQUIRE(Matches(index, "al", true) == "ALPHABET\nAlpha\naLtitude\nalpha\nalps");
+		REQUIRE(Matches(index, "AL", false) == "ALPHABET");
+		REQUIRE(Matches(index, "alph", true) == "ALPHABET\nAlpha\nalpha");
+		// Words no longer than the root are not offered
+		REQUIRE(Matches(index, "alps", true).empty());
+		REQUIRE(Matches(index, "be", true) == "Beta");
+		REQUIRE(Matches(index, "c", true).empty());
+		// The word being typed is not offered when it is the only occurrence
+		REQUIRE(Matches(index, "al", true, "alps") == "ALPHABET\nAlpha\naLtitude\nalpha");
+		// Stops at the limit
+		REQUIRE(Matches(index, "al", true, {}, 2).find('\n') != std::string::npos);
+		REQUIRE(Matches(index, "al", true, {}, 1).find('\n') == std::string::npos);
+	}
+}